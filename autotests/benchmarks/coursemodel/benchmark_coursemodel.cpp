@@ -0,0 +1,54 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "benchmark_coursemodel.h"
+#include "allocationcounter.h"
+#include "coursestub.h"
+#include "languagestub.h"
+#include "resourcerepositorystub.h"
+#include "src/core/icourse.h"
+#include "src/core/language.h"
+#include "src/core/phrase.h"
+#include "src/core/unit.h"
+
+#include <QTest>
+
+void BenchmarkCourseModel::rangeAllocations()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    std::vector<std::shared_ptr<ILanguage>> languages;
+    languages.push_back(language);
+    std::vector<std::shared_ptr<ICourse>> courses;
+    for (int i = 0; i < 10; ++i) {
+        QVector<std::shared_ptr<Unit>> units;
+        for (int j = 0; j < 10; ++j) {
+            auto unit = Unit::create();
+            for (int k = 0; k < 10; ++k) {
+                unit->addPhrase(Phrase::create(), unit->phraseCount());
+            }
+            units.append(unit);
+        }
+        courses.push_back(CourseStub::create(language, units));
+    }
+    ResourceRepositoryStub repository(languages, courses);
+
+    const quint64 allocations = AllocationCounter::count();
+    int phrases = 0;
+    for (const auto &course : repository.courseRange()) {
+        for (const auto &unit : course->unitRange()) {
+            for (const auto &phrase : unit->phraseRange()) {
+                if (phrase) {
+                    ++phrases;
+                }
+            }
+        }
+    }
+    const quint64 rangeAllocations = AllocationCounter::count() - allocations;
+    QCOMPARE(phrases, 1000);
+    QCOMPARE(rangeAllocations, quint64(0));
+}
+
+QTEST_GUILESS_MAIN(BenchmarkCourseModel)
@@ -0,0 +1,26 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef BENCHMARK_COURSEMODEL_H
+#define BENCHMARK_COURSEMODEL_H
+
+#include <QObject>
+
+class BenchmarkCourseModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    BenchmarkCourseModel() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that walking all units and phrases of the repository through range views does not allocate
+     */
+    void rangeAllocations();
+};
+
+#endif
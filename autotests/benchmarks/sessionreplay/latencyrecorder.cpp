@@ -0,0 +1,105 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "latencyrecorder.h"
+#include <QJsonObject>
+#include <algorithm>
+
+namespace
+{
+struct Statistics {
+    int samples {0};
+    double mean {0};
+    double p50 {0};
+    double p90 {0};
+    double p99 {0};
+    double max {0};
+    double allocationsMean {0};
+    quint64 allocationsTotal {0};
+};
+
+// nearest rank percentile of sorted values
+double percentile(const QVector<qint64> &sorted, double rank)
+{
+    if (sorted.isEmpty()) {
+        return 0;
+    }
+    const int index = qBound(0, static_cast<int>(rank * sorted.count() + 0.5) - 1, sorted.count() - 1);
+    return sorted.at(index) / 1000.0;
+}
+
+Statistics compute(const QVector<LatencyRecorder::Sample> &samples)
+{
+    Statistics statistics;
+    statistics.samples = samples.count();
+    if (samples.isEmpty()) {
+        return statistics;
+    }
+    QVector<qint64> durations;
+    durations.reserve(samples.count());
+    qint64 sum {0};
+    for (const auto &sample : samples) {
+        durations.append(sample.nanoseconds);
+        sum += sample.nanoseconds;
+        statistics.allocationsTotal += sample.allocations;
+    }
+    std::sort(durations.begin(), durations.end());
+    statistics.mean = sum / 1000.0 / samples.count();
+    statistics.p50 = percentile(durations, 0.5);
+    statistics.p90 = percentile(durations, 0.9);
+    statistics.p99 = percentile(durations, 0.99);
+    statistics.max = durations.constLast() / 1000.0;
+    statistics.allocationsMean = static_cast<double>(statistics.allocationsTotal) / samples.count();
+    return statistics;
+}
+}
+
+void LatencyRecorder::record(const QString &operation, const Sample &sample)
+{
+    m_samples[operation].append(sample);
+}
+
+QJsonArray LatencyRecorder::toJson() const
+{
+    QJsonArray operations;
+    for (auto iter = m_samples.constBegin(); iter != m_samples.constEnd(); ++iter) {
+        const Statistics statistics = compute(iter.value());
+        QJsonObject operation;
+        operation[QStringLiteral("name")] = iter.key();
+        operation[QStringLiteral("samples")] = statistics.samples;
+        operation[QStringLiteral("mean_us")] = statistics.mean;
+        operation[QStringLiteral("p50_us")] = statistics.p50;
+        operation[QStringLiteral("p90_us")] = statistics.p90;
+        operation[QStringLiteral("p99_us")] = statistics.p99;
+        operation[QStringLiteral("max_us")] = statistics.max;
+        operation[QStringLiteral("allocations_mean")] = statistics.allocationsMean;
+        operation[QStringLiteral("allocations_total")] = static_cast<double>(statistics.allocationsTotal);
+        operations.append(operation);
+    }
+    return operations;
+}
+
+QString LatencyRecorder::summary() const
+{
+    QString result = QStringLiteral("%1 %2 %3 %4 %5 %6\n")
+                         .arg(QStringLiteral("operation"), -28)
+                         .arg(QStringLiteral("samples"), 8)
+                         .arg(QStringLiteral("p50 us"), 10)
+                         .arg(QStringLiteral("p90 us"), 10)
+                         .arg(QStringLiteral("p99 us"), 10)
+                         .arg(QStringLiteral("allocs"), 8);
+    for (auto iter = m_samples.constBegin(); iter != m_samples.constEnd(); ++iter) {
+        const Statistics statistics = compute(iter.value());
+        result += QStringLiteral("%1 %2 %3 %4 %5 %6\n")
+                      .arg(iter.key(), -28)
+                      .arg(statistics.samples, 8)
+                      .arg(statistics.p50, 10, 'f', 1)
+                      .arg(statistics.p90, 10, 'f', 1)
+                      .arg(statistics.p99, 10, 'f', 1)
+                      .arg(statistics.allocationsMean, 8, 'f', 1);
+    }
+    return result;
+}
@@ -0,0 +1,57 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef LATENCYRECORDER_H
+#define LATENCYRECORDER_H
+
+#include "allocationcounter.h"
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QMap>
+#include <QString>
+#include <QVector>
+
+/**
+ * \class LatencyRecorder
+ * Collects duration and allocation samples per named operation and reports percentiles.
+ */
+class LatencyRecorder
+{
+public:
+    struct Sample {
+        qint64 nanoseconds {0};
+        quint64 allocations {0};
+    };
+
+    void record(const QString &operation, const Sample &sample);
+    /**
+     * @brief run @p function and record its duration and allocations as a sample of @p operation
+     */
+    template<typename Function> void measure(const QString &operation, Function function)
+    {
+        const quint64 allocations = AllocationCounter::count();
+        QElapsedTimer timer;
+        timer.start();
+        function();
+        Sample sample;
+        sample.nanoseconds = timer.nsecsElapsed();
+        sample.allocations = AllocationCounter::count() - allocations;
+        record(operation, sample);
+    }
+    /**
+     * @return one object per operation with sample count, latency percentiles in microseconds and allocations
+     */
+    QJsonArray toJson() const;
+    /**
+     * @return human readable table of the results
+     */
+    QString summary() const;
+
+private:
+    QMap<QString, QVector<Sample>> m_samples;
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "allocationcounter.h"
+#include "latencyrecorder.h"
+#include "libsound/src/backendinterface.h"
+#include "libsound/src/backendregistry.h"
+#include "sessionreplay.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+namespace
+{
+// one second of silent 8 kHz mono PCM
+bool writeSilentSoundFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    const quint32 dataSize {16000};
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData("RIFF", 4);
+    stream << quint32(36 + dataSize);
+    stream.writeRawData("WAVEfmt ", 8);
+    stream << quint32(16) << quint16(1) << quint16(1) << quint32(8000) << quint32(16000) << quint16(2) << quint16(16);
+    stream.writeRawData("data", 4);
+    stream << dataSize;
+    file.write(QByteArray(static_cast<int>(dataSize), 0));
+    return true;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("benchmark_sessionreplay"));
+    // learner database and configuration of test mode, such that no user profile is touched
+    QStandardPaths::setTestModeEnabled(true);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Replays scripted training and editor sessions and reports per-operation latencies."));
+    parser.addHelpOption();
+    QCommandLineOption unitsOption(QStringLiteral("units"), QStringLiteral("Number of units per course."), QStringLiteral("count"), QStringLiteral("20"));
+    QCommandLineOption phrasesOption(QStringLiteral("phrases"), QStringLiteral("Number of phrases per unit."), QStringLiteral("count"), QStringLiteral("100"));
+    QCommandLineOption stepsOption(QStringLiteral("steps"), QStringLiteral("Number of scripted steps per session."), QStringLiteral("count"), QStringLiteral("1000"));
+    QCommandLineOption seedOption(QStringLiteral("seed"), QStringLiteral("Seed of the scripted interactions."), QStringLiteral("seed"), QStringLiteral("1"));
+    QCommandLineOption outputOption(QStringLiteral("output"), QStringLiteral("Write JSON results to file instead of stdout."), QStringLiteral("file"));
+    QCommandLineOption noSoundOption(QStringLiteral("no-sound"), QStringLiteral("Do not play sounds through the null sound backend."));
+    parser.addOptions({unitsOption, phrasesOption, stepsOption, seedOption, outputOption, noSoundOption});
+    parser.process(app);
+
+    QTemporaryDir soundDirectory;
+    SessionReplay::Configuration configuration;
+    configuration.units = qMax(1, parser.value(unitsOption).toInt());
+    configuration.phrasesPerUnit = qMax(2, parser.value(phrasesOption).toInt());
+    configuration.steps = qMax(0, parser.value(stepsOption).toInt());
+    configuration.seed = parser.value(seedOption).toUInt();
+    configuration.soundFile = soundDirectory.filePath(QStringLiteral("silence.wav"));
+    if (!soundDirectory.isValid() || !writeSilentSoundFile(configuration.soundFile)) {
+        qCritical() << "Could not create sound file";
+        return 1;
+    }
+
+    // sound is only measured with the device independent null backend
+    QString backendName;
+    if (!parser.isSet(noSoundOption)) {
+        BackendRegistry::self().setPreferredBackend(QStringLiteral("artikulate_null_backend"));
+        BackendInterface *backend = BackendRegistry::self().backend();
+        if (backend && backend->name() == QLatin1String("null")) {
+            QMetaObject::invokeMethod(backend, "setLatency", Q_ARG(int, 0));
+            QMetaObject::invokeMethod(backend, "setJitter", Q_ARG(int, 0));
+            configuration.playSound = true;
+            backendName = backend->name();
+        }
+    }
+
+    LatencyRecorder recorder;
+    SessionReplay replay(configuration, &recorder);
+    replay.runTraining();
+    replay.runEditor();
+
+    QJsonObject settings;
+    settings[QStringLiteral("units")] = configuration.units;
+    settings[QStringLiteral("phrasesPerUnit")] = configuration.phrasesPerUnit;
+    settings[QStringLiteral("steps")] = configuration.steps;
+    settings[QStringLiteral("seed")] = static_cast<double>(configuration.seed);
+    settings[QStringLiteral("soundBackend")] = backendName;
+    QJsonObject result;
+    result[QStringLiteral("benchmark")] = QStringLiteral("sessionreplay");
+    result[QStringLiteral("formatVersion")] = 1;
+    result[QStringLiteral("date")] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    result[QStringLiteral("configuration")] = settings;
+    result[QStringLiteral("allocationCounter")] = QString::fromLatin1(AllocationCounter::source());
+    result[QStringLiteral("operations")] = recorder.toJson();
+    const QByteArray json = QJsonDocument(result).toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly)) {
+            qCritical() << "Could not write results to" << file.fileName();
+            return 1;
+        }
+        file.write(json);
+        QTextStream(stderr) << recorder.summary();
+    } else {
+        QTextStream(stdout) << json;
+    }
+    return 0;
+}
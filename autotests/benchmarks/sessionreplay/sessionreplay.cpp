@@ -0,0 +1,166 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "sessionreplay.h"
+#include "coursestub.h"
+#include "editablecoursestub.h"
+#include "editablerepositorystub.h"
+#include "languagestub.h"
+#include "latencyrecorder.h"
+#include "liblearnerprofile/src/learner.h"
+#include "liblearnerprofile/src/profilemanager.h"
+#include "libsound/src/outputdevicecontroller.h"
+#include "src/core/editorsession.h"
+#include "src/core/phrase.h"
+#include "src/core/trainingsession.h"
+#include "src/core/unit.h"
+#include "src/models/learningprogressmodel.h"
+#include "src/models/phraselistmodel.h"
+#include <QCoreApplication>
+
+SessionReplay::SessionReplay(const Configuration &configuration, LatencyRecorder *recorder)
+    : m_configuration(configuration)
+    , m_recorder(recorder)
+    , m_random(configuration.seed)
+{
+}
+
+QVector<std::shared_ptr<Unit>> SessionReplay::createUnits(const QString &prefix) const
+{
+    const QUrl sound = QUrl::fromLocalFile(m_configuration.soundFile);
+    const int typeCount = static_cast<int>(IPhrase::Type::AllTypes);
+    QVector<std::shared_ptr<Unit>> units;
+    units.reserve(m_configuration.units);
+    for (int i = 0; i < m_configuration.units; ++i) {
+        auto unit = Unit::create();
+        unit->setId(QStringLiteral("%1-unit-%2").arg(prefix).arg(i));
+        unit->setTitle(unit->id());
+        for (int j = 0; j < m_configuration.phrasesPerUnit; ++j) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(QStringLiteral("%1-%2").arg(unit->id()).arg(j));
+            phrase->setText(phrase->id());
+            phrase->setType(static_cast<IPhrase::Type>(j % typeCount));
+            phrase->setSound(sound);
+            unit->addPhrase(phrase, unit->phraseCount());
+        }
+        units.append(unit);
+    }
+    return units;
+}
+
+void SessionReplay::runTraining()
+{
+    auto language = std::make_shared<LanguageStub>("replay");
+    const auto units = createUnits(QStringLiteral("training"));
+    CourseStub course(language, units);
+
+    LearnerProfile::ProfileManager manager;
+    LearnerProfile::Learner *learner = manager.addProfile(QStringLiteral("replay"));
+    manager.setActiveProfile(learner);
+
+    // models as connected by the training pages
+    TrainingSession session(&manager);
+    PhraseListModel phraseModel;
+    LearningProgressModel progressModel;
+    progressModel.setSession(&session);
+    QObject::connect(&session, &TrainingSession::phraseChanged, &phraseModel, [&session, &phraseModel]() {
+        phraseModel.setUnit(qobject_cast<Unit *>(session.activeUnit()));
+    });
+
+    m_recorder->measure(QStringLiteral("training.setCourse"), [&]() {
+        session.setCourse(&course);
+    });
+
+    for (int step = 0; step < m_configuration.steps; ++step) {
+        // restart at a random phrase when the course is completed and in every 10th step
+        if (!session.hasNext() || step % 10 == 0) {
+            const auto &unit = units.at(m_random.bounded(units.count()));
+            IPhrase *phrase = unit->phraseRange().at(m_random.bounded(unit->phraseCount())).get();
+            m_recorder->measure(QStringLiteral("training.setActivePhrase"), [&]() {
+                session.setActivePhrase(phrase);
+            });
+        }
+        if (m_configuration.playSound) {
+            const QUrl sound = session.activePhrase()->sound();
+            m_recorder->measure(QStringLiteral("sound.play"), [&]() {
+                OutputDeviceController::self().play(sound);
+            });
+            OutputDeviceController::self().stop();
+        }
+        if (m_random.bounded(4) == 0) {
+            m_recorder->measure(QStringLiteral("training.skip"), [&]() {
+                session.skip();
+            });
+        } else {
+            m_recorder->measure(QStringLiteral("training.accept"), [&]() {
+                session.accept();
+            });
+        }
+        // deliver queued events, e.g. of finished prefetch jobs, outside of the measurement
+        QCoreApplication::processEvents();
+    }
+
+    manager.removeProfile(learner);
+}
+
+void SessionReplay::runEditor()
+{
+    auto language = std::make_shared<LanguageStub>("replay");
+    const auto units = createUnits(QStringLiteral("editor"));
+    auto course = EditableCourseStub::create(language, units);
+    EditableRepositoryStub repository {
+        {language}, // languages
+        {},         // skeletons
+        {course}    // courses
+    };
+
+    EditorSession session;
+    session.setRepository(&repository);
+    PhraseListModel phraseModel;
+    QObject::connect(&session, &EditorSession::phraseChanged, &phraseModel, [&session, &phraseModel]() {
+        phraseModel.setUnit(qobject_cast<Unit *>(session.activeUnit()));
+    });
+
+    m_recorder->measure(QStringLiteral("editor.setCourse"), [&]() {
+        session.setCourse(course.get());
+    });
+
+    int created {0};
+    for (int step = 0; step < m_configuration.steps; ++step) {
+        const auto &unit = units.at(m_random.bounded(units.count()));
+        const int operation = m_random.bounded(10);
+        if (operation < 5) {
+            m_recorder->measure(QStringLiteral("editor.switchToNextPhrase"), [&]() {
+                session.switchToNextPhrase();
+            });
+        } else if (operation < 8) {
+            IPhrase *phrase = unit->phraseRange().at(m_random.bounded(unit->phraseCount())).get();
+            m_recorder->measure(QStringLiteral("editor.setActivePhrase"), [&]() {
+                session.setActivePhrase(phrase);
+            });
+        } else if (operation == 8 || unit->phraseCount() <= 1) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(QStringLiteral("%1-created-%2").arg(unit->id()).arg(created++));
+            phrase->setSound(QUrl::fromLocalFile(m_configuration.soundFile));
+            const int index = m_random.bounded(unit->phraseCount() + 1);
+            m_recorder->measure(QStringLiteral("editor.insertPhrase"), [&]() {
+                unit->addPhrase(phrase, index);
+                course->triggerUnitChanged(unit);
+            });
+        } else {
+            // keep the active phrase, such that the removal does not depend on the selection
+            std::shared_ptr<IPhrase> phrase = unit->phraseRange().at(m_random.bounded(unit->phraseCount()));
+            if (phrase.get() == session.activePhrase()) {
+                continue;
+            }
+            m_recorder->measure(QStringLiteral("editor.removePhrase"), [&]() {
+                unit->removePhrase(phrase);
+                course->triggerUnitChanged(unit);
+            });
+        }
+        QCoreApplication::processEvents();
+    }
+}
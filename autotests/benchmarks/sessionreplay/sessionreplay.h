@@ -0,0 +1,49 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef SESSIONREPLAY_H
+#define SESSIONREPLAY_H
+
+#include <QRandomGenerator>
+#include <QString>
+#include <QVector>
+#include <memory>
+
+class LatencyRecorder;
+class Unit;
+
+/**
+ * \class SessionReplay
+ * Drives training and editor sessions over synthetic courses through scripted interactions.
+ *
+ * Every step is measured with the same call sequence the QML user interface triggers, including
+ * connected models, learner storage and, if enabled, sound playback.
+ */
+class SessionReplay
+{
+public:
+    struct Configuration {
+        int units {20};
+        int phrasesPerUnit {100};
+        int steps {1000};
+        quint32 seed {1};
+        bool playSound {false};
+        QString soundFile; //!< sound file assigned to all phrases
+    };
+
+    SessionReplay(const Configuration &configuration, LatencyRecorder *recorder);
+    void runTraining();
+    void runEditor();
+
+private:
+    QVector<std::shared_ptr<Unit>> createUnits(const QString &prefix) const;
+
+    Configuration m_configuration;
+    LatencyRecorder *m_recorder;
+    QRandomGenerator m_random;
+};
+
+#endif
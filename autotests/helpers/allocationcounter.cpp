@@ -0,0 +1,110 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "allocationcounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<quint64> s_allocations {0};
+
+void countAllocation()
+{
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+}
+
+quint64 AllocationCounter::count()
+{
+    return s_allocations.load(std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+
+const char *AllocationCounter::source()
+{
+    return "malloc";
+}
+
+// the executable interposes the allocation functions of the C library for all libraries of the process,
+// operator new of libstdc++ allocates through malloc and thus is counted as well
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *pointer, std::size_t size);
+
+void *malloc(std::size_t size)
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size)
+{
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, std::size_t size)
+{
+    countAllocation();
+    return __libc_realloc(pointer, size);
+}
+}
+
+#else
+
+const char *AllocationCounter::source()
+{
+    return "operator new";
+}
+
+namespace
+{
+void *allocate(std::size_t size)
+{
+    countAllocation();
+    if (void *pointer = std::malloc(size > 0 ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+}
+
+// without a known C library only the global allocation functions of C++ are replaced
+void *operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+#endif
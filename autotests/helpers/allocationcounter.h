@@ -0,0 +1,28 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+namespace AllocationCounter
+{
+/**
+ * @return number of allocation calls since program start
+ *
+ * With glibc, calls of malloc, calloc and realloc are counted, which includes operator new and
+ * container storage of Qt. Otherwise only calls of the global operator new are counted.
+ */
+quint64 count();
+
+/**
+ * @return name of the counted allocation functions, "malloc" or "operator new"
+ */
+const char *source();
+}
+
+#endif
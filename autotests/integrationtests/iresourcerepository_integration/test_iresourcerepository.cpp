@@ -11,6 +11,7 @@
 #include "../src/settings.h"
 #include "core/contributorrepository.h"
 #include "core/icourse.h"
+#include "core/ieditablecourse.h"
 #include "core/language.h"
 #include "core/resourcerepository.h"
 #include "core/unit.h"
@@ -42,6 +43,52 @@ void TestIResourceRepository::contributorRepository()
     performInterfaceTests(&repository);
 }
 
+void TestIResourceRepository::skeletonUpdate()
+{
+    ContributorRepository repository(QUrl::fromLocalFile(m_repositoryLocation.toLocalFile() + "/contributorrepository/"));
+    repository.reloadCourses();
+    const auto skeleton = repository.skeleton("skeleton-testdata");
+    QVERIFY(skeleton != nullptr);
+    const auto courses = repository.editableCourses();
+    QCOMPARE(courses.count(), 2);
+    std::shared_ptr<IEditableCourse> german;
+    for (const auto &course : courses) {
+        course->setForeignId(skeleton->id());
+        if (course->language()->id() == "de") {
+            german = course;
+        }
+    }
+    QVERIFY(german != nullptr);
+
+    // diffs of all languages are computed in parallel and applied on the GUI thread
+    QSignalSpy updatedSpy(&repository, &ContributorRepository::coursesUpdatedFromSkeleton);
+    repository.updateCoursesFromSkeleton(skeleton);
+    QVERIFY(updatedSpy.wait());
+    QCOMPARE(updatedSpy.first().first().toString(), skeleton->id());
+    for (const auto &course : courses) {
+        QCOMPARE(course->unitCount(), 3);
+    }
+
+    // the skeleton state of the last update tells retitles apart from translations
+    std::shared_ptr<Unit> numbers;
+    for (const auto &unit : german->unitRange()) {
+        if (unit->foreignId() == skeleton->unitRange().first()->id()) {
+            numbers = unit;
+        }
+    }
+    QVERIFY(numbers != nullptr);
+    skeleton->unitRange().first()->setTitle("Numbers renamed");
+    repository.updateCourseFromSkeleton(german);
+    QCOMPARE(numbers->title(), QString("Numbers renamed"));
+
+    // removed elements are only unlinked by applying previewed changes
+    const auto changes = repository.skeletonChanges(german);
+    QCOMPARE(changes.changes().count(), 1);
+    QCOMPARE(changes.count(SkeletonDiff::ChangeType::UnitRemoved), 1);
+    repository.applySkeletonChanges(changes);
+    QVERIFY(repository.skeletonChanges(german).isEmpty());
+}
+
 void TestIResourceRepository::performInterfaceTests(IResourceRepository *interface)
 {
     QVERIFY(interface->languages().count() > 0); // automatically load languages
@@ -39,6 +39,12 @@ private Q_SLOTS:
      */
     void contributorRepository();
 
+    /**
+     * @brief test that ContributorRepository updates all courses of a skeleton, detects retitles
+     * against the last update and only unlinks removed elements after a preview
+     */
+    void skeletonUpdate();
+
 private:
     void performInterfaceTests(IResourceRepository *repository);
     QUrl m_repositoryLocation;
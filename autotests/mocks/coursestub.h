@@ -37,7 +37,11 @@ public:
 
     QString id() const override
     {
-        return "courseid";
+        return m_id;
+    }
+    void setId(const QString &id)
+    {
+        m_id = id;
     }
     QString foreignId() const override
     {
@@ -75,12 +79,21 @@ public:
     {
         return m_units;
     }
+    ConstRange<std::shared_ptr<Unit>> unitRange() override
+    {
+        return ConstRange<std::shared_ptr<Unit>>(m_units.constData(), m_units.constData() + m_units.count());
+    }
+    int unitCount() override
+    {
+        return m_units.count();
+    }
     QUrl file() const override
     {
         return QUrl();
     }
 
 private:
+    QString m_id {"courseid"};
     QString m_title {"title"};
     std::weak_ptr<ICourse> m_self;
     std::shared_ptr<ILanguage> m_language;
@@ -105,6 +105,14 @@ public:
     {
         return m_units;
     }
+    ConstRange<std::shared_ptr<Unit>> unitRange() override
+    {
+        return ConstRange<std::shared_ptr<Unit>>(m_units.constData(), m_units.constData() + m_units.count());
+    }
+    int unitCount() override
+    {
+        return m_units.count();
+    }
     std::shared_ptr<Unit> addUnit(std::shared_ptr<Unit> unit) override
     {
         m_units.append(std::move(unit));
@@ -136,6 +144,14 @@ public:
     {
         // not implemented
     }
+    void beginUpdate() override
+    {
+        // not implemented
+    }
+    void endUpdate() override
+    {
+        // not implemented
+    }
     bool isModified() const override
     {
         return false;
@@ -32,6 +32,7 @@ public:
         }
         for (auto &course : courses) {
             m_courses.append(course);
+            m_courseList.append(course);
         }
     }
     ~EditableRepositoryStub() override;
@@ -49,17 +50,30 @@ public:
     }
     QVector<std::shared_ptr<ICourse>> courses() const override
     {
-        QVector<std::shared_ptr<ICourse>> courses;
-        for (auto course : m_courses) {
-            courses.push_back(course);
-        }
-        return courses;
+        return m_courseList;
+    }
+    ConstRange<std::shared_ptr<ICourse>> courseRange() const override
+    {
+        return ConstRange<std::shared_ptr<ICourse>>(m_courseList.constData(), m_courseList.constData() + m_courseList.count());
+    }
+    int courseCount() const override
+    {
+        return m_courseList.count();
+    }
+    std::shared_ptr<ICourse> course(int index) const override
+    {
+        return m_courseList.at(index);
     }
     QVector<std::shared_ptr<ICourse>> courses(const QString &languageId) const override
     {
         Q_UNUSED(languageId);
         return QVector<std::shared_ptr<ICourse>>();
     }
+    ConstRange<std::shared_ptr<ICourse>> courseRange(const QString &languageId) const override
+    {
+        Q_UNUSED(languageId);
+        return ConstRange<std::shared_ptr<ICourse>>();
+    }
     std::shared_ptr<IEditableCourse> editableCourse(std::shared_ptr<ILanguage> language, int index) const override
     {
         Q_UNUSED(language);
@@ -74,10 +88,15 @@ public:
     {
         return m_languages;
     }
+    ConstRange<std::shared_ptr<ILanguage>> languageRange() const override
+    {
+        return ConstRange<std::shared_ptr<ILanguage>>(m_languages.constData(), m_languages.constData() + m_languages.count());
+    }
     void appendCourse(std::shared_ptr<IEditableCourse> course)
     {
         emit courseAboutToBeAdded(course, m_courses.count());
         m_courses.append(course);
+        m_courseList.append(course);
         emit courseAdded();
     }
 
@@ -88,6 +107,7 @@ public:
         if (index >= 0) {
             emit courseAboutToBeRemoved(index);
             m_courses.remove(index);
+            m_courseList.remove(index);
             emit courseRemoved();
         }
     }
@@ -113,11 +133,27 @@ public:
         Q_UNUSED(course);
         // do nothing
     }
+    void updateCoursesFromSkeleton(std::shared_ptr<IEditableCourse> skeleton) override
+    {
+        Q_UNUSED(skeleton);
+        // do nothing
+    }
+    SkeletonDiff skeletonChanges(std::shared_ptr<IEditableCourse> course) const override
+    {
+        Q_UNUSED(course);
+        return SkeletonDiff();
+    }
+    void applySkeletonChanges(const SkeletonDiff &diff) override
+    {
+        Q_UNUSED(diff);
+        // do nothing
+    }
 
 private:
     QVector<std::shared_ptr<ILanguage>> m_languages;
     QVector<std::shared_ptr<IEditableCourse>> m_skeletons;
     QVector<std::shared_ptr<IEditableCourse>> m_courses;
+    QVector<std::shared_ptr<ICourse>> m_courseList; //!< m_courses as ICourse for copy-free access
 };
 
 #endif
@@ -58,12 +58,33 @@ public:
         return m_courses;
     }
 
+    ConstRange<std::shared_ptr<ICourse>> courseRange() const override
+    {
+        return ConstRange<std::shared_ptr<ICourse>>(m_courses.constData(), m_courses.constData() + m_courses.count());
+    }
+
+    int courseCount() const override
+    {
+        return m_courses.count();
+    }
+
+    std::shared_ptr<ICourse> course(int index) const override
+    {
+        return m_courses.at(index);
+    }
+
     QVector<std::shared_ptr<ICourse>> courses(const QString &languageId) const override
     {
         Q_UNUSED(languageId);
         return m_courses; // do not filter by languages
     }
 
+    ConstRange<std::shared_ptr<ICourse>> courseRange(const QString &languageId) const override
+    {
+        Q_UNUSED(languageId);
+        return courseRange(); // do not filter by languages
+    }
+
     void reloadCourses() override
     {
         ; // do nothing, stub shall only provide languages
@@ -74,6 +95,11 @@ public:
         return m_languages;
     }
 
+    ConstRange<std::shared_ptr<ILanguage>> languageRange() const override
+    {
+        return ConstRange<std::shared_ptr<ILanguage>>(m_languages.constData(), m_languages.constData() + m_languages.count());
+    }
+
     void appendCourse(std::shared_ptr<ICourse> course)
     {
         emit courseAboutToBeAdded(course, m_courses.count());
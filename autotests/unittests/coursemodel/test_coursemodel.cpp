@@ -10,6 +10,8 @@
 #include "../mocks/resourcerepositorystub.h"
 #include "src/core/icourse.h"
 #include "src/core/language.h"
+#include "src/core/resourcerepository.h"
+#include "src/models/coursefiltermodel.h"
 #include "src/models/coursemodel.h"
 
 #include <QSignalSpy>
@@ -111,4 +113,58 @@ void TestCourseModel::testDataChangedSignals()
     }
 }
 
+void TestCourseModel::testFilterByLanguage()
+{
+    ResourceRepository repository(QUrl::fromLocalFile(qApp->applicationDirPath() + "/../autotests/unittests/data/courses/"));
+    CourseModel model(&repository);
+    CourseFilterModel filterModel;
+    filterModel.setCourseModel(&model);
+    auto german = std::dynamic_pointer_cast<Language>(repository.language("de"));
+    auto french = std::dynamic_pointer_cast<Language>(repository.language("fr"));
+    QVERIFY(german != nullptr);
+    QVERIFY(french != nullptr);
+
+    // courses are loaded after the filter is set up
+    filterModel.setLanguage(german.get());
+    QCOMPARE(filterModel.filteredCount(), 0);
+    repository.reloadCourses();
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(repository.courses("de").count(), 1);
+    QCOMPARE(repository.courseRange("fr").count(), 1);
+    QCOMPARE(repository.courseRange("unknown").count(), 0);
+    QCOMPARE(repository.courseRange(QString()).count(), 2);
+    QCOMPARE(filterModel.filteredCount(), 1);
+    QCOMPARE(filterModel.course(0).value<QObject *>(), repository.courses("de").first().get());
+
+    filterModel.setLanguage(french.get());
+    QCOMPARE(filterModel.filteredCount(), 1);
+    QCOMPARE(filterModel.course(0).value<QObject *>(), repository.courses("fr").first().get());
+
+    filterModel.setLanguage(nullptr);
+    QCOMPARE(filterModel.filteredCount(), 2);
+}
+
+void TestCourseModel::benchmarkData()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    std::vector<std::shared_ptr<ILanguage>> languages;
+    languages.push_back(language);
+    std::vector<std::shared_ptr<ICourse>> courses;
+    for (int i = 0; i < 500; ++i) {
+        courses.push_back(CourseStub::create(language, QVector<std::shared_ptr<Unit>>({})));
+    }
+    ResourceRepositoryStub repository(languages, courses);
+    CourseModel model(&repository);
+    QCOMPARE(model.rowCount(), 500);
+
+    QBENCHMARK {
+        for (int row = 0; row < model.rowCount(); ++row) {
+            const QModelIndex index = model.index(row, 0);
+            model.data(index, CourseModel::TitleRole);
+            model.data(index, CourseModel::IdRole);
+            model.data(index, CourseModel::DataRole);
+        }
+    }
+}
+
 QTEST_GUILESS_MAIN(TestCourseModel)
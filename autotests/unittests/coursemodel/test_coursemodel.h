@@ -41,6 +41,16 @@ private Q_SLOTS:
      * @brief Test data changed signal emit
      */
     void testDataChangedSignals();
+
+    /**
+     * @brief Test filtering of courses by their language through the per language course lists of the repository
+     */
+    void testFilterByLanguage();
+
+    /**
+     * @brief Benchmark reading all rows of a model with many courses, rows are read without copying the course list
+     */
+    void benchmarkData();
 };
 
 #endif
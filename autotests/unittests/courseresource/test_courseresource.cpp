@@ -64,6 +64,7 @@ void TestCourseResource::loadCourseResource()
     QCOMPARE(unit->foreignId(), "{dd60f04a-eb37-44b7-9787-67aaf7d3578d}");
     QCOMPARE(unit->course(), course);
 
+    unit->ensureLoaded();
     QCOMPARE(unit->phrases().count(), 3);
     // note: this test takes the silent assumption that phrases are added to the list in same
     //   order as they are defined in the file. This assumption should be made explicit or dropped
@@ -7,10 +7,12 @@
 #include "test_editablecourseresource.h"
 #include "../mocks/coursestub.h"
 #include "../mocks/languagestub.h"
+#include "core/editorsession.h"
 #include "core/language.h"
 #include "core/phrase.h"
 #include "core/resources/courseparser.h"
 #include "core/resources/editablecourseresource.h"
+#include "core/trainingaction.h"
 #include "core/unit.h"
 #include "resourcerepositorystub.h"
 
@@ -60,6 +62,7 @@ void TestEditableCourseResource::loadCourseResource()
     QCOMPARE(unit->foreignId(), "{dd60f04a-eb37-44b7-9787-67aaf7d3578d}");
     QCOMPARE(unit->course(), course);
 
+    unit->ensureLoaded();
     QCOMPARE(unit->phrases().count(), 3);
     // note: this test takes the silent assumption that phrases are added to the list in same
     //   order as they are defined in the file. This assumption should be made explicit or dropped
@@ -224,6 +227,8 @@ void TestEditableCourseResource::fileLoadSaveCompleteness()
     QCOMPARE(compareUnit->id(), testUnit->id());
     QCOMPARE(compareUnit->foreignId(), testUnit->foreignId());
     QCOMPARE(compareUnit->title(), testUnit->title());
+    testUnit->ensureLoaded();
+    compareUnit->ensureLoaded();
     QCOMPARE(compareUnit->phrases().count(), testUnit->phrases().count());
 
     std::shared_ptr<IPhrase> testPhrase = testUnit->phrases().constFirst();
@@ -243,6 +248,75 @@ void TestEditableCourseResource::fileLoadSaveCompleteness()
     QVERIFY(testPhrase->phonemes().count() == comparePhrase->phonemes().count());
 }
 
+void TestEditableCourseResource::lazyUnitLoading()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto unit = course->units().constFirst();
+    QVERIFY(!unit->isLoaded());
+    QVERIFY(!unit->source().isEmpty());
+    QCOMPARE(unit->id(), "1");
+    // reading does not load the unit
+    QCOMPARE(unit->phraseCount(), 0);
+    QVERIFY(!unit->isLoaded());
+    unit->ensureLoaded();
+    const int phraseCount = unit->phraseCount();
+    QVERIFY(phraseCount > 0);
+    QVERIFY(unit->isLoaded());
+    QVERIFY(unit->source().isEmpty());
+
+    // store a course with two units, of which none is loaded after reading it again
+    Unit *secondUnit = course->createUnit();
+    std::shared_ptr<Phrase> phrase = Phrase::create();
+    phrase->setId("new-phrase");
+    phrase->setText("neu");
+    secondUnit->addPhrase(phrase, 0);
+    QTemporaryFile twoUnitFile;
+    twoUnitFile.open();
+    QVERIFY(course->exportToFile(QUrl::fromLocalFile(twoUnitFile.fileName())));
+
+    auto loadedCourse = EditableCourseResource::create(QUrl::fromLocalFile(twoUnitFile.fileName()), &repository);
+    QCOMPARE(loadedCourse->unitCount(), 2);
+    auto firstLoadedUnit = loadedCourse->unitRange().at(0);
+    auto secondLoadedUnit = loadedCourse->unitRange().at(1);
+    QVERIFY(!firstLoadedUnit->isLoaded());
+    QVERIFY(!secondLoadedUnit->isLoaded());
+    QCOMPARE(firstLoadedUnit->title(), unit->title());
+    QCOMPARE(secondLoadedUnit->id(), secondUnit->id());
+    const QByteArray untouchedSource = firstLoadedUnit->source();
+
+    // modifying an opened unit only loads this unit
+    QSignalSpy modifiedSpy(loadedCourse.get(), &EditableCourseResource::modifiedChanged);
+    QVERIFY(secondLoadedUnit->findPhrase("new-phrase") == nullptr);
+    secondLoadedUnit->ensureLoaded();
+    auto editedPhrase = std::static_pointer_cast<Phrase>(secondLoadedUnit->findPhrase("new-phrase"));
+    QVERIFY(editedPhrase != nullptr);
+    QVERIFY(secondLoadedUnit->isLoaded());
+    QVERIFY(!firstLoadedUnit->isLoaded());
+    editedPhrase->setText("changed");
+    QCOMPARE(modifiedSpy.count(), 1);
+
+    // the untouched unit is written from its original bytes
+    QTemporaryFile outputFile;
+    outputFile.open();
+    QVERIFY(loadedCourse->exportToFile(QUrl::fromLocalFile(outputFile.fileName())));
+    QFile file(outputFile.fileName());
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(file.readAll().contains(untouchedSource));
+    QVERIFY(!firstLoadedUnit->isLoaded());
+
+    auto savedCourse = EditableCourseResource::create(QUrl::fromLocalFile(outputFile.fileName()), &repository);
+    QCOMPARE(savedCourse->unitCount(), 2);
+    for (const auto &savedUnit : savedCourse->unitRange()) {
+        savedUnit->ensureLoaded();
+    }
+    QCOMPARE(savedCourse->unitRange().at(0)->phraseCount(), phraseCount);
+    QCOMPARE(savedCourse->unitRange().at(0)->phraseRange().first()->id(), unit->phraseRange().first()->id());
+    QCOMPARE(savedCourse->unitRange().at(1)->phraseCount(), 1);
+    QCOMPARE(savedCourse->unitRange().at(1)->phraseRange().first()->text(), "changed");
+}
+
 void TestEditableCourseResource::modifiedStatus()
 {
     // boilerplate
@@ -340,6 +414,9 @@ void TestEditableCourseResource::skeletonUpdate()
     ResourceRepositoryStub repository({language});
     auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
     QCOMPARE(course->units().count(), 1);
+    const auto existingUnit = course->units().first();
+    const QString existingForeignId = existingUnit->foreignId();
+    QVERIFY(!existingForeignId.isEmpty());
 
     // create skeleton stub
     auto importPhrase = Phrase::create();
@@ -374,9 +451,90 @@ void TestEditableCourseResource::skeletonUpdate()
         QCOMPARE(importedPhrase->type(), importPhrase->type());
     }
 
+    // units that are not part of the skeleton stay linked to their skeleton unit
+    QCOMPARE(existingUnit->foreignId(), existingForeignId);
+
     // test that re-import does not change course
     course->updateFrom(skeleton);
     QCOMPARE(course->units().count(), 2);
 }
 
+namespace
+{
+std::shared_ptr<Unit> createSkeletonUnit(const QString &id, int phraseCount)
+{
+    auto unit = Unit::create();
+    unit->setId(id);
+    unit->setTitle(id);
+    for (int i = 0; i < phraseCount; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QStringLiteral("%1-phrase-%2").arg(id).arg(i));
+        phrase->setText(QStringLiteral("text %1").arg(i));
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    return unit;
+}
+}
+
+void TestEditableCourseResource::batchedSkeletonUpdate()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto skeletonUnit = createSkeletonUnit("importId", 10);
+    auto skeleton = CourseStub::create(language, {skeletonUnit});
+
+    EditorSession session;
+    session.setCourse(course.get());
+    QCOMPARE(session.trainingActions().count(), 1);
+
+    // a newly imported unit enters the session once it is complete
+    QSignalSpy unitChangedSpy(course.get(), &IEditableCourse::unitChanged);
+    course->updateFrom(skeleton);
+    QCOMPARE(unitChangedSpy.count(), 1);
+    QCOMPARE(course->units().count(), 2);
+    QCOMPARE(session.trainingActions().count(), 2);
+    QCOMPARE(session.trainingActions().at(1)->actionsCount(), 10);
+
+    // phrases imported into an existing unit are announced as a single reset
+    auto importedUnit = course->units().at(1);
+    QSignalSpy addedSpy(importedUnit.get(), &IUnit::phraseAdded);
+    QSignalSpy aboutToBeResetSpy(importedUnit.get(), &IUnit::phrasesAboutToBeReset);
+    QSignalSpy resetSpy(importedUnit.get(), &IUnit::phrasesReset);
+    for (int i = 0; i < 5; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QStringLiteral("added-%1").arg(i));
+        skeletonUnit->addPhrase(phrase, 0);
+    }
+    unitChangedSpy.clear();
+    course->updateFrom(skeleton);
+    QCOMPARE(addedSpy.count(), 0);
+    QCOMPARE(aboutToBeResetSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(unitChangedSpy.count(), 1);
+    QCOMPARE(importedUnit->phraseCount(), 15);
+    QCOMPARE(session.trainingActions().at(1)->actionsCount(), 15);
+    QVERIFY(session.trainingActions().at(1)->phraseAt(14) == importedUnit->phraseRange().at(14).get());
+
+    // unchanged units do not emit anything
+    course->updateFrom(skeleton);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(unitChangedSpy.count(), 1);
+}
+
+void TestEditableCourseResource::benchmarkSkeletonUpdate()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto skeleton = CourseStub::create(language, {createSkeletonUnit("first", 1000), createSkeletonUnit("second", 1000)});
+
+    QBENCHMARK {
+        auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+        EditorSession session;
+        session.setCourse(course.get());
+        course->updateFrom(skeleton);
+        QCOMPARE(course->units().count(), 3);
+    }
+}
+
 QTEST_GUILESS_MAIN(TestEditableCourseResource)
@@ -53,6 +53,11 @@ private Q_SLOTS:
      */
     void fileLoadSaveCompleteness();
 
+    /**
+     * Test that phrases are only parsed for opened units and untouched units are saved unchanged
+     */
+    void lazyUnitLoading();
+
     /**
      * Test if the modified status is correctly set.
      */
@@ -62,6 +67,16 @@ private Q_SLOTS:
      * Test correct update of course from a skeleton
      */
     void skeletonUpdate();
+
+    /**
+     * Test that a skeleton update notifies about each changed unit only once
+     */
+    void batchedSkeletonUpdate();
+
+    /**
+     * Benchmark the import of a skeleton with 2000 phrases into an edited course
+     */
+    void benchmarkSkeletonUpdate();
 };
 
 #endif
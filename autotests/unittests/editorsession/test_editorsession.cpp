@@ -8,15 +8,21 @@
 #include "../mocks/editablecoursestub.h"
 #include "../mocks/languagestub.h"
 #include "editablerepositorystub.h"
+#include "src/core/contributorrepository.h"
 #include "src/core/editorsession.h"
 #include "src/core/icourse.h"
 #include "src/core/ieditablecourse.h"
+#include "src/core/ieditablephrase.h"
 #include "src/core/ieditablerepository.h"
 #include "src/core/language.h"
+#include "src/core/phrasesearchindex.h"
 #include "src/core/resources/skeletonresource.h"
 #include "src/core/trainingaction.h"
 #include "src/core/unit.h"
+#include <QDir>
+#include <QFile>
 #include <QSignalSpy>
+#include <QTemporaryDir>
 #include <QTest>
 #include <QVector>
 
@@ -273,4 +279,173 @@ void TestEditorSession::updateActionsBehavior()
     }
 }
 
+void TestEditorSession::patchSinglePhraseActions()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unitA = Unit::create();
+    auto unitB = Unit::create();
+    std::shared_ptr<Phrase> phraseA1 = Phrase::create();
+    std::shared_ptr<Phrase> phraseA2 = Phrase::create();
+    std::shared_ptr<Phrase> phraseB1 = Phrase::create();
+    std::shared_ptr<Phrase> phraseNew = Phrase::create();
+    phraseA1->setId("A1");
+    phraseA2->setId("A2");
+    phraseB1->setId("B1");
+    phraseNew->setId("new");
+    unitA->addPhrase(phraseA1, unitA->phrases().size());
+    unitA->addPhrase(phraseA2, unitA->phrases().size());
+    unitB->addPhrase(phraseB1, unitB->phrases().size());
+    auto course = EditableCourseStub::create(language, QVector<std::shared_ptr<Unit>>({unitA, unitB}));
+
+    EditableRepositoryStub repository {
+        {language}, // languages
+        {},         // skeletons
+        {course}    // courses
+    };
+    EditorSession session;
+    session.setRepository(&repository);
+    session.setCourse(course.get());
+    session.setActivePhrase(phraseA2.get());
+    const auto unitActionA = session.trainingActions().at(0);
+    const auto actionA2 = session.activeAction();
+    const auto actionB1 = session.trainingActions().at(1)->action(0);
+
+    // insert in front of active phrase: existing actions are kept, active phrase does not change
+    {
+        QSignalSpy spy(&session, &EditorSession::actionsChanged);
+        unitA->addPhrase(phraseNew, 0);
+        course->triggerUnitChanged(unitA);
+        QCOMPARE(spy.count(), 0);
+    }
+    QCOMPARE(session.trainingActions().at(0), unitActionA);
+    QCOMPARE(unitActionA->actionsCount(), 3);
+    QCOMPARE(unitActionA->action(0)->phrase(), phraseNew.get());
+    QCOMPARE(session.activeAction(), actionA2);
+    QCOMPARE(session.activePhrase(), phraseA2.get());
+    QCOMPARE(session.trainingActions().at(1)->action(0), actionB1);
+
+    // index lookup reflects the new positions
+    session.setActivePhrase(phraseNew.get());
+    QCOMPARE(session.activeAction(), unitActionA->action(0));
+    session.setActivePhrase(phraseA2.get());
+    QCOMPARE(session.activeAction(), actionA2);
+
+    // remove the new phrase again
+    unitA->removePhrase(phraseNew);
+    course->triggerUnitChanged(unitA);
+    QCOMPARE(unitActionA->actionsCount(), 2);
+    QCOMPARE(session.activeAction(), actionA2);
+    session.setActiveUnit(unitB.get());
+    QCOMPARE(session.activeAction(), actionB1);
+}
+
+void TestEditorSession::loadUnitsOnDemand()
+{
+    QTemporaryDir storage;
+    QVERIFY(storage.isValid());
+    QDir storageDir(storage.path());
+    QVERIFY(storageDir.mkpath(QStringLiteral("skeletons")));
+    QVERIFY(storageDir.mkpath(QStringLiteral("courses/coursename/de")));
+    QFile courseFile(storageDir.filePath(QStringLiteral("courses/coursename/de/de.xml")));
+    QVERIFY(courseFile.open(QIODevice::WriteOnly));
+    courseFile.write(R"(<?xml version="1.0"?>
+<course>
+    <id>de</id>
+    <foreignId>lazy-course</foreignId>
+    <title>Lazy Course</title>
+    <description></description>
+    <language>de</language>
+    <units>
+        <unit>
+            <id>1</id>
+            <foreignId></foreignId>
+            <title>Erste</title>
+            <phrases>
+                <phrase><id>1-1</id><foreignId></foreignId><text>Guten Tag.</text><soundFile></soundFile><type>sentence</type><phonemes></phonemes></phrase>
+                <phrase><id>1-2</id><foreignId></foreignId><text>Auf Wiedersehen.</text><soundFile></soundFile><type>sentence</type><phonemes></phonemes></phrase>
+            </phrases>
+        </unit>
+        <unit>
+            <id>2</id>
+            <foreignId></foreignId>
+            <title>Zweite</title>
+            <phrases>
+                <phrase><id>2-1</id><foreignId></foreignId><text>Wie geht es dir?</text><soundFile></soundFile><type>sentence</type><phonemes></phonemes></phrase>
+            </phrases>
+        </unit>
+        <unit>
+            <id>3</id>
+            <foreignId></foreignId>
+            <title>Dritte</title>
+            <phrases>
+                <phrase><id>3-1</id><foreignId></foreignId><text>Regenschirm</text><soundFile></soundFile><type>word</type><phonemes></phonemes></phrase>
+                <phrase><id>3-2</id><foreignId></foreignId><text>Schneeflocke</text><soundFile></soundFile><type>word</type><phonemes></phonemes></phrase>
+            </phrases>
+        </unit>
+    </units>
+</course>
+)");
+    courseFile.close();
+
+    ContributorRepository repository(QUrl::fromLocalFile(storage.path()));
+    repository.reloadCourses();
+    QCOMPARE(repository.editableCourses().count(), 1);
+    auto course = repository.editableCourses().first();
+    QCOMPARE(course->unitCount(), 3);
+    const auto units = course->unitRange();
+    for (const auto &unit : units) {
+        QVERIFY(!unit->isLoaded());
+    }
+
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    QCOMPARE(index.count(), 5);
+    EditorSession session;
+    session.setRepository(&repository);
+    session.setCourse(course.get());
+
+    // only the selected first unit is opened, the others provide their headers
+    QCOMPARE(session.trainingActions().count(), 3);
+    QCOMPARE(session.trainingActions().at(0)->text(), "Erste");
+    QCOMPARE(session.trainingActions().at(0)->actionsCount(), 2);
+    QCOMPARE(session.trainingActions().at(2)->text(), "Dritte");
+    QCOMPARE(session.trainingActions().at(2)->actionsCount(), 0);
+    QVERIFY(units.at(0)->isLoaded());
+    QVERIFY(!units.at(1)->isLoaded());
+    QVERIFY(!units.at(2)->isLoaded());
+    QCOMPARE(session.activePhrase()->id(), "1-1");
+
+    // searching reads the sources of the unopened units
+    const auto results = index.search(QStringLiteral("Schneeflocke"), 1);
+    QCOMPARE(results.count(), 1);
+    const int document = results.first().document;
+    QCOMPARE(index.document(document).unitId, "3");
+    QCOMPARE(index.document(document).phraseId, "3-2");
+    QVERIFY(!units.at(2)->isLoaded());
+
+    // selecting a unit opens only this unit
+    session.setActiveUnit(units.at(1).get());
+    QVERIFY(units.at(1)->isLoaded());
+    QVERIFY(!units.at(2)->isLoaded());
+    QCOMPARE(session.trainingActions().at(1)->actionsCount(), 1);
+    QCOMPARE(session.activePhrase()->id(), "2-1");
+
+    // resolving a search result opens its unit, which is followed by index and session
+    IPhrase *phrase = index.phrase(document);
+    QVERIFY(phrase != nullptr);
+    QCOMPARE(phrase->id(), "3-2");
+    QVERIFY(units.at(2)->isLoaded());
+    QCOMPARE(index.count(), 5);
+    QCOMPARE(session.trainingActions().at(2)->actionsCount(), 2);
+    session.setActivePhrase(phrase);
+    QCOMPARE(session.activePhrase(), phrase);
+    auto editablePhrase = dynamic_cast<IEditablePhrase *>(phrase);
+    QVERIFY(editablePhrase != nullptr);
+    editablePhrase->setText(QStringLiteral("Sonnenschirm"));
+    const auto updatedResults = index.search(QStringLiteral("Sonnenschirm"), 1);
+    QCOMPARE(updatedResults.count(), 1);
+    QCOMPARE(index.document(updatedResults.first().document).phraseId, "3-2");
+    QCOMPARE(index.document(updatedResults.first().document).text, "Sonnenschirm");
+}
+
 QTEST_GUILESS_MAIN(TestEditorSession)
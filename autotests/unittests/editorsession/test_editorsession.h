@@ -51,6 +51,16 @@ private Q_SLOTS:
      * @brief Test that the actions are correctly updated when course changes;
      */
     void updateActionsBehavior();
+
+    /**
+     * @brief Test that adding or removing a single phrase only patches the affected actions
+     */
+    void patchSinglePhraseActions();
+
+    /**
+     * @brief Test that units of a course loaded from a repository are only loaded when they are opened
+     */
+    void loadUnitsOnDemand();
 };
 
 #endif
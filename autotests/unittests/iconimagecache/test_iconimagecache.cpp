@@ -0,0 +1,97 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_iconimagecache.h"
+#include "qmlcontrols/iconimagecache.h"
+#include <QPixmap>
+#include <QTest>
+
+namespace
+{
+QIcon createIcon(const QColor &color)
+{
+    QPixmap pixmap(64, 64);
+    pixmap.fill(color);
+    return QIcon(pixmap);
+}
+}
+
+void TestIconImageCache::keys()
+{
+    const QIcon icon = createIcon(Qt::red);
+    const QIcon copy = icon;
+    const QIcon other = createIcon(Qt::red);
+    const QSize size(16, 16);
+
+    QVERIFY(IconImageCache::key(icon, size, QIcon::Normal, 1.0) == IconImageCache::key(copy, size, QIcon::Normal, 1.0));
+    QVERIFY(!(IconImageCache::key(icon, size, QIcon::Normal, 1.0) == IconImageCache::key(other, size, QIcon::Normal, 1.0)));
+    QVERIFY(!(IconImageCache::key(icon, size, QIcon::Normal, 1.0) == IconImageCache::key(icon, QSize(32, 32), QIcon::Normal, 1.0)));
+    QVERIFY(!(IconImageCache::key(icon, size, QIcon::Normal, 1.0) == IconImageCache::key(icon, size, QIcon::Disabled, 1.0)));
+    QVERIFY(!(IconImageCache::key(icon, size, QIcon::Normal, 1.0) == IconImageCache::key(icon, size, QIcon::Normal, 2.0)));
+    QCOMPARE(qHash(IconImageCache::key(icon, size, QIcon::Normal, 1.0)), qHash(IconImageCache::key(copy, size, QIcon::Normal, 1.0)));
+}
+
+void TestIconImageCache::rasterization()
+{
+    IconImageCache cache;
+    const QIcon icon = createIcon(Qt::red);
+    const auto key = IconImageCache::key(icon, QSize(16, 16), QIcon::Normal, 1.0);
+
+    QImage image;
+    QVERIFY(!cache.lookup(key, &image));
+    QCOMPARE(cache.misses(), 1);
+    image = cache.request(icon, key);
+    QCOMPARE(image.size(), QSize(16, 16));
+    QCOMPARE(image.pixelColor(8, 8), QColor(Qt::red));
+    QCOMPARE(cache.request(icon, key).cacheKey(), image.cacheKey());
+    // requests are neither hits nor misses
+    QCOMPARE(cache.hits(), 0);
+    QCOMPARE(cache.misses(), 1);
+
+    // all lookups share one image, which allows sharing its texture
+    QImage cachedImage;
+    QVERIFY(cache.lookup(key, &cachedImage));
+    QCOMPARE(cachedImage.cacheKey(), image.cacheKey());
+    QCOMPARE(cache.hits(), 1);
+
+    cache.clear();
+    QCOMPARE(cache.hits(), 0);
+    QCOMPARE(cache.misses(), 0);
+    QVERIFY(!cache.lookup(key, &image));
+}
+
+void TestIconImageCache::devicePixelRatio()
+{
+    IconImageCache cache;
+    const QIcon icon = createIcon(Qt::blue);
+    const auto key = IconImageCache::key(icon, QSize(16, 16), QIcon::Normal, 2.0);
+    cache.request(icon, key);
+
+    QImage image;
+    QVERIFY(cache.lookup(key, &image));
+    QCOMPARE(image.size(), QSize(32, 32));
+    QCOMPARE(image.devicePixelRatio(), 2.0);
+}
+
+void TestIconImageCache::nullIcon()
+{
+    IconImageCache cache;
+    const QIcon icon;
+    const auto key = IconImageCache::key(icon, QSize(16, 16), QIcon::Normal, 1.0);
+    QVERIFY(cache.request(icon, key).isNull());
+
+    // the null result is cached and not rasterized again
+    QImage image(1, 1, QImage::Format_ARGB32);
+    QVERIFY(cache.lookup(key, &image));
+    QVERIFY(image.isNull());
+    image = QImage(1, 1, QImage::Format_ARGB32);
+    QVERIFY(cache.lookup(key, &image));
+    QVERIFY(image.isNull());
+    QCOMPARE(cache.hits(), 2);
+    QCOMPARE(cache.misses(), 0);
+}
+
+QTEST_MAIN(TestIconImageCache)
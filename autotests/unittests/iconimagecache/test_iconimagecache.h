@@ -0,0 +1,41 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_ICONIMAGECACHE_H
+#define TEST_ICONIMAGECACHE_H
+
+#include <QObject>
+
+class TestIconImageCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestIconImageCache() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that keys identify icons by name or shared icon data and rendering parameters
+     */
+    void keys();
+
+    /**
+     * @brief Test rasterization on request, shared images and hit and miss counters
+     */
+    void rasterization();
+
+    /**
+     * @brief Test that images are rendered in device pixels
+     */
+    void devicePixelRatio();
+
+    /**
+     * @brief Test that null icons are cached as null images
+     */
+    void nullIcon();
+};
+
+#endif
@@ -0,0 +1,117 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_learningprogressmodel.h"
+#include "../mocks/coursestub.h"
+#include "../mocks/languagestub.h"
+#include "liblearnerprofile/src/profilemanager.h"
+#include "src/core/phrase.h"
+#include "src/core/trainingsession.h"
+#include "src/core/unit.h"
+#include "src/models/learningprogressmodel.h"
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTest>
+
+namespace
+{
+std::shared_ptr<Unit> createUnit(const QVector<IPhrase::Type> &types)
+{
+    auto unit = Unit::create();
+    for (int i = 0; i < types.count(); ++i) {
+        std::shared_ptr<Phrase> phrase = Phrase::create();
+        phrase->setId("phrase" + QString::number(i));
+        phrase->setType(types.at(i));
+        phrase->setSound(QUrl::fromLocalFile("/tmp/phrase" + QString::number(i) + ".ogg"));
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    return unit;
+}
+}
+
+void TestLearningProgressModel::initTestCase()
+{
+    // sessions must not resume snapshots of a user profile
+    QStandardPaths::setTestModeEnabled(true);
+}
+
+void TestLearningProgressModel::incrementalUpdates()
+{
+    const int wordColumn = static_cast<int>(IPhrase::Type::Word);
+    const int sentenceColumn = static_cast<int>(IPhrase::Type::Sentence);
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = createUnit({IPhrase::Type::Word, IPhrase::Type::Sentence, IPhrase::Type::Word});
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>({unit}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    session.setCourse(&course);
+
+    LearningProgressModel model;
+    model.setSession(&session);
+    QCOMPARE(model.rowCount(), 2);
+    QSignalSpy dataSpy(&model, &LearningProgressModel::dataChanged);
+    QSignalSpy insertSpy(&model, &LearningProgressModel::rowsInserted);
+    QSignalSpy resetSpy(&model, &LearningProgressModel::modelReset);
+
+    // skipping only counts the failed try
+    session.skip();
+    QCOMPARE(dataSpy.count(), 0);
+
+    // first accepted phrase inserts the row for one try
+    session.accept();
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy.first().at(1).toInt(), 1);
+    QCOMPARE(insertSpy.first().at(2).toInt(), 1);
+    QCOMPARE(dataSpy.count(), 1);
+    QCOMPARE(dataSpy.first().at(0).toModelIndex(), model.index(1, sentenceColumn));
+    QCOMPARE(dataSpy.first().at(1).toModelIndex(), model.index(1, sentenceColumn));
+    QCOMPARE(model.data(model.index(1, sentenceColumn)).toInt(), 1);
+
+    // same number of tries, no new rows
+    session.accept();
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(dataSpy.count(), 2);
+    QCOMPARE(dataSpy.last().at(0).toModelIndex(), model.index(1, wordColumn));
+    QCOMPARE(model.rowCount(), 3);
+
+    // skipped phrase is accepted at its second try
+    session.setActivePhrase(unit->phraseRange().at(0).get());
+    session.accept();
+    QCOMPARE(insertSpy.count(), 2);
+    QCOMPARE(insertSpy.last().at(1).toInt(), 2);
+    QCOMPARE(model.rowCount(), 4);
+    QCOMPARE(dataSpy.last().at(0).toModelIndex(), model.index(2, wordColumn));
+    QCOMPARE(model.data(model.index(2, wordColumn)).toInt(), 1);
+    QCOMPARE(model.data(model.index(1, wordColumn)).toInt(), 1);
+    QCOMPARE(model.data(model.index(3, wordColumn)).toInt(), 0);
+    QCOMPARE(model.maximumTries(), 2);
+    QCOMPARE(model.maximumPhrasesPerTry(), 1);
+    QCOMPARE(resetSpy.count(), 0);
+}
+
+void TestLearningProgressModel::resetOnCourseChange()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unitA = createUnit({IPhrase::Type::Word});
+    auto unitB = createUnit({IPhrase::Type::Word});
+    CourseStub courseA(language, QVector<std::shared_ptr<Unit>>({unitA}));
+    CourseStub courseB(language, QVector<std::shared_ptr<Unit>>({unitB}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    session.setCourse(&courseA);
+    LearningProgressModel model;
+    model.setSession(&session);
+    session.accept();
+    QCOMPARE(model.rowCount(), 3);
+
+    QSignalSpy resetSpy(&model, &LearningProgressModel::modelReset);
+    session.setCourse(&courseB);
+    QVERIFY(resetSpy.count() >= 1);
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(session.numberPhrasesGroupedByTries(IPhrase::Type::Word, 1), 0);
+}
+
+QTEST_GUILESS_MAIN(TestLearningProgressModel)
@@ -0,0 +1,36 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_LEARNINGPROGRESSMODEL_H
+#define TEST_LEARNINGPROGRESSMODEL_H
+
+#include <QObject>
+
+class TestLearningProgressModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestLearningProgressModel() = default;
+
+private Q_SLOTS:
+    /**
+     * Called before the first test case.
+     */
+    void initTestCase();
+
+    /**
+     * @brief Test that accepted phrases update exactly one cell and rows only grow with new maximum tries
+     */
+    void incrementalUpdates();
+
+    /**
+     * @brief Test that a course change resets the statistics
+     */
+    void resetOnCourseChange();
+};
+
+#endif
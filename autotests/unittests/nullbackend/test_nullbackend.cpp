@@ -0,0 +1,208 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_nullbackend.h"
+#include "libsound/src/backendinterface.h"
+#include "libsound/src/backendregistry.h"
+#include "libsound/src/capturedevicecontroller.h"
+#include "libsound/src/outputdevicecontroller.h"
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QCoreApplication>
+#include <QSignalSpy>
+
+TestNullBackend::TestNullBackend() = default;
+
+void TestNullBackend::initTestCase()
+{
+    BackendRegistry::self().setPreferredBackend(QStringLiteral("artikulate_null_backend"));
+    m_backend = BackendRegistry::self().backend();
+    if (!m_backend || m_backend->name() != QLatin1String("null")) {
+        QSKIP("Null sound backend is not available");
+    }
+    QVERIFY(m_dir.isValid());
+}
+
+void TestNullBackend::init()
+{
+    QMetaObject::invokeMethod(m_backend, "setLatency", Q_ARG(int, 0));
+    QMetaObject::invokeMethod(m_backend, "setJitter", Q_ARG(int, 0));
+    QMetaObject::invokeMethod(m_backend, "clearTransitions");
+}
+
+QString TestNullBackend::createSoundFile(const QString &name, int durationMs)
+{
+    // silent 8 kHz mono PCM
+    const QString path = m_dir.filePath(name);
+    QFile file(path);
+    file.open(QIODevice::WriteOnly);
+    const quint32 dataSize = static_cast<quint32>(durationMs * 8000 / 1000 * 2);
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData("RIFF", 4);
+    stream << quint32(36 + dataSize);
+    stream.writeRawData("WAVEfmt ", 8);
+    stream << quint32(16) << quint16(1) << quint16(1) << quint32(8000) << quint32(16000) << quint16(2) << quint16(16);
+    stream.writeRawData("data", 4);
+    stream << dataSize;
+    file.write(QByteArray(static_cast<int>(dataSize), 0));
+    return path;
+}
+
+QVariantList TestNullBackend::transitions() const
+{
+    QVariantList result;
+    QMetaObject::invokeMethod(m_backend, "transitions", Q_RETURN_ARG(QVariantList, result));
+    return result;
+}
+
+void TestNullBackend::queuedPlayback()
+{
+    const QString first = createSoundFile(QStringLiteral("first.wav"), 200);
+    const QString second = createSoundFile(QStringLiteral("second.wav"), 300);
+    auto &controller = OutputDeviceController::self();
+    QSignalSpy startedSpy(&controller, &OutputDeviceController::queueItemStarted);
+    QSignalSpy finishedSpy(&controller, &OutputDeviceController::queueItemFinished);
+    QStringList callbacks;
+
+    controller.enqueue(first, [&callbacks, first]() {
+        callbacks.append(first);
+    });
+    controller.enqueue(second, [&callbacks, second]() {
+        callbacks.append(second);
+    });
+    QCOMPARE(controller.queueLength(), 2);
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.count(), 2, 5000);
+    QCOMPARE(startedSpy.count(), 2);
+    QCOMPARE(callbacks, QStringList({first, second}));
+    QCOMPARE(controller.queueLength(), 0);
+    QTRY_COMPARE(controller.state(), OutputDeviceController::StoppedState);
+
+    // second source starts when the first one finished, without stopping in between
+    QStringList events;
+    qint64 playing = -1;
+    qint64 advanced = -1;
+    for (const auto &entry : transitions()) {
+        const auto transition = entry.toMap();
+        const QString event = transition.value(QStringLiteral("event")).toString();
+        events.append(event);
+        if (event == QLatin1String("playing")) {
+            playing = transition.value(QStringLiteral("timestamp")).toLongLong();
+        }
+        if (event == QLatin1String("advanced")) {
+            advanced = transition.value(QStringLiteral("timestamp")).toLongLong();
+        }
+    }
+    QCOMPARE(events, QStringList({QStringLiteral("requested"), QStringLiteral("playing"), QStringLiteral("advanced"), QStringLiteral("finished")}));
+    // timers have a precision of about 5%
+    QVERIFY(advanced - playing >= 190 * 1000000LL);
+}
+
+void TestNullBackend::failedQueueHead()
+{
+    const QString missing = m_dir.filePath(QStringLiteral("missing.wav"));
+    const QString existing = createSoundFile(QStringLiteral("existing.wav"), 100);
+    auto &controller = OutputDeviceController::self();
+    QSignalSpy stoppedSpy(&controller, &OutputDeviceController::stopped);
+    QSignalSpy startedSpy(&controller, &OutputDeviceController::queueItemStarted);
+    QSignalSpy finishedSpy(&controller, &OutputDeviceController::queueItemFinished);
+    bool missingFinished {false};
+
+    controller.enqueue(missing, [&missingFinished]() {
+        missingFinished = true;
+    });
+    controller.enqueue(existing);
+    QCOMPARE(controller.queueLength(), 2);
+    QTRY_COMPARE(stoppedSpy.count(), 1);
+    QCOMPARE(controller.queueLength(), 0);
+    QCOMPARE(finishedSpy.count(), 0);
+    QVERIFY(!missingFinished);
+
+    // the reset queue starts playback of the next enqueued file
+    startedSpy.clear();
+    controller.enqueue(existing);
+    QCOMPARE(startedSpy.count(), 1);
+    QTRY_COMPARE(finishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.first().first().toString(), existing);
+    QCOMPARE(controller.queueLength(), 0);
+
+    QStringList events;
+    for (const auto &entry : transitions()) {
+        events.append(entry.toMap().value(QStringLiteral("event")).toString());
+    }
+    QCOMPARE(events, QStringList({QStringLiteral("requested"), QStringLiteral("error"), QStringLiteral("requested"), QStringLiteral("playing"), QStringLiteral("finished")}));
+}
+
+void TestNullBackend::startLatency()
+{
+    QMetaObject::invokeMethod(m_backend, "setLatency", Q_ARG(int, 50));
+    auto &controller = OutputDeviceController::self();
+    controller.play(createSoundFile(QStringLiteral("latency.wav"), 100));
+    QTRY_COMPARE(controller.state(), OutputDeviceController::PlayingState);
+    controller.stop();
+
+    const auto log = transitions();
+    QVERIFY(log.count() >= 2);
+    const qint64 requested = log.at(0).toMap().value(QStringLiteral("timestamp")).toLongLong();
+    const qint64 playing = log.at(1).toMap().value(QStringLiteral("timestamp")).toLongLong();
+    QCOMPARE(log.at(1).toMap().value(QStringLiteral("event")).toString(), QStringLiteral("playing"));
+    QVERIFY(playing - requested >= 45 * 1000000LL);
+}
+
+void TestNullBackend::synthesizedCapture()
+{
+    auto &controller = CaptureDeviceController::self();
+    QVERIFY(controller.setProfile(CaptureProfile::comparisonProfile()));
+    const QString path = m_dir.filePath(QStringLiteral("capture.wav"));
+    controller.startCapture(path);
+    QTRY_COMPARE(controller.state(), CaptureDeviceController::RecordingState);
+    QTest::qWait(100);
+    controller.stopCapture();
+    QCOMPARE(controller.state(), CaptureDeviceController::StoppedState);
+
+    // header plus at least 100 ms of 16 bit samples at 16 kHz
+    QFileInfo info(path);
+    QVERIFY(info.exists());
+    QVERIFY(info.size() >= 44 + 3200);
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray header = file.read(12);
+    QCOMPARE(header.left(4), QByteArray("RIFF"));
+    QCOMPARE(header.mid(8, 4), QByteArray("WAVE"));
+}
+
+void TestNullBackend::compressedCaptureProfiles()
+{
+    auto &controller = CaptureDeviceController::self();
+    QVERIFY(controller.setProfile(CaptureProfile::comparisonProfile()));
+
+    // synthesized recordings are WAV files only
+    QVERIFY(!controller.setProfile(CaptureProfile::archiveProfile()));
+    QVERIFY(!controller.setProfile(CaptureProfile::compactProfile()));
+    QCOMPARE(controller.profile(), CaptureProfile::comparisonProfile());
+
+    // a capture source is accepted for profiles with its container
+    const QString source = qApp->applicationDirPath() + QStringLiteral("/data/courses/de/de_01.ogg");
+    QVERIFY(QFileInfo::exists(source));
+    QMetaObject::invokeMethod(m_backend, "setCaptureSource", Q_ARG(QString, source));
+    QVERIFY(controller.setProfile(CaptureProfile::archiveProfile()));
+    QVERIFY(!controller.setProfile(CaptureProfile::compactProfile()));
+    QCOMPARE(controller.profile().format(), CaptureProfile::Vorbis);
+
+    const QString path = m_dir.filePath(QStringLiteral("capture.ogg"));
+    controller.startCapture(path);
+    QTRY_COMPARE(controller.state(), CaptureDeviceController::RecordingState);
+    controller.stopCapture();
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.read(4), QByteArray("OggS"));
+
+    QMetaObject::invokeMethod(m_backend, "setCaptureSource", Q_ARG(QString, QString()));
+    QVERIFY(controller.setProfile(CaptureProfile::comparisonProfile()));
+}
+
+QTEST_GUILESS_MAIN(TestNullBackend)
@@ -0,0 +1,66 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTNULLBACKEND_H
+#define TESTNULLBACKEND_H
+
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+class BackendInterface;
+
+class TestNullBackend : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestNullBackend();
+
+private slots:
+    /**
+     * @brief Load the null backend, skips all tests if it is not available
+     */
+    void initTestCase();
+
+    /**
+     * @brief Called before every test case.
+     */
+    void init();
+
+    /**
+     * @brief Test queued playback with simulated durations and gapless transitions
+     */
+    void queuedPlayback();
+
+    /**
+     * @brief Test that a queue whose head fails to play is reset and the next enqueued file starts
+     */
+    void failedQueueHead();
+
+    /**
+     * @brief Test that playback starts only after the configured latency
+     */
+    void startLatency();
+
+    /**
+     * @brief Test capture of a synthesized signal
+     */
+    void synthesizedCapture();
+
+    /**
+     * @brief Test that compressed profiles are only accepted with a capture source of their container
+     */
+    void compressedCaptureProfiles();
+
+private:
+    QString createSoundFile(const QString &name, int durationMs);
+    QVariantList transitions() const;
+    BackendInterface *m_backend {nullptr};
+    QTemporaryDir m_dir;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_phonemestatistics.h"
+#include "src/core/phoneme.h"
+#include "src/core/phonemeindex.h"
+#include "src/core/phonemestatistics.h"
+#include "src/core/phrase.h"
+#include <QTest>
+
+void TestPhonemeStatistics::phonemeIndex()
+{
+    Phoneme phonemeA;
+    Phoneme phonemeB;
+    phonemeA.setId("a");
+    phonemeB.setId("b");
+    std::shared_ptr<Phrase> phrase1 = Phrase::create();
+    std::shared_ptr<Phrase> phrase2 = Phrase::create();
+    std::shared_ptr<Phrase> phrase3 = Phrase::create();
+    phrase1->addPhoneme(&phonemeA);
+    phrase2->addPhoneme(&phonemeA);
+    phrase2->addPhoneme(&phonemeB);
+    phrase3->addPhoneme(&phonemeB);
+
+    PhonemeIndex index;
+    QVERIFY(index.isEmpty());
+    index.addPhrase(phrase1.get());
+    index.addPhrase(phrase2.get());
+    index.addPhrase(phrase3.get());
+    QCOMPARE(index.phonemes().count(), 2);
+    QCOMPARE(index.phrases("a"), QVector<IPhrase *>({phrase1.get(), phrase2.get()}));
+    QCOMPARE(index.phrases("b"), QVector<IPhrase *>({phrase2.get(), phrase3.get()}));
+    QVERIFY(index.phrases("c").isEmpty());
+
+    // phrases of earlier phonemes first, no duplicates
+    QCOMPARE(index.collect({"b", "a"}, 10), QVector<IPhrase *>({phrase2.get(), phrase3.get(), phrase1.get()}));
+    QCOMPARE(index.collect({"b", "a"}, 1), QVector<IPhrase *>({phrase2.get()}));
+
+    index.clear();
+    QVERIFY(index.isEmpty());
+}
+
+void TestPhonemeStatistics::weakestPhonemes()
+{
+    Phoneme phonemeA;
+    Phoneme phonemeB;
+    Phoneme phonemeC;
+    phonemeA.setId("a");
+    phonemeB.setId("b");
+    phonemeC.setId("c");
+    std::shared_ptr<Phrase> phraseA = Phrase::create();
+    std::shared_ptr<Phrase> phraseAB = Phrase::create();
+    phraseA->addPhoneme(&phonemeA);
+    phraseAB->addPhoneme(&phonemeA);
+    phraseAB->addPhoneme(&phonemeB);
+
+    // without profile manager nothing is persisted
+    PhonemeStatistics statistics;
+    QVERIFY(qFuzzyCompare(statistics.successRate("a"), 0.5));
+
+    statistics.record(phraseAB.get(), false);
+    statistics.record(phraseA.get(), true);
+    statistics.record(phraseA.get(), true);
+    QCOMPARE(statistics.entry("a").attempts, 3);
+    QCOMPARE(statistics.entry("a").successes, 2);
+    QCOMPARE(statistics.entry("b").attempts, 1);
+    QCOMPARE(statistics.entry("b").successes, 0);
+
+    // b: 1/3, c: 1/2 (unseen), a: 3/5
+    QCOMPARE(statistics.weakestPhonemes({"a", "b", "c"}, 3), QStringList({"b", "c", "a"}));
+    QCOMPARE(statistics.weakestPhonemes({"a", "b", "c"}, 1), QStringList({"b"}));
+    QVERIFY(statistics.weakestPhonemes({"a"}, 0).isEmpty());
+}
+
+QTEST_GUILESS_MAIN(TestPhonemeStatistics)
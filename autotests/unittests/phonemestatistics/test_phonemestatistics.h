@@ -0,0 +1,31 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTPHONEMESTATISTICS_H
+#define TESTPHONEMESTATISTICS_H
+
+#include <QObject>
+
+class TestPhonemeStatistics : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestPhonemeStatistics() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test inverted phoneme index and collection of distinct phrases
+     */
+    void phonemeIndex();
+
+    /**
+     * @brief Test that recorded results update success rates and weakest phoneme ordering
+     */
+    void weakestPhonemes();
+};
+
+#endif
@@ -0,0 +1,176 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_phraselistmodel.h"
+#include "core/phrase.h"
+#include "core/unit.h"
+#include "models/phrasefiltermodel.h"
+#include "models/phraselistmodel.h"
+#include <QSignalSpy>
+#include <QTest>
+
+void TestPhraseListModel::rowsFollowUnit()
+{
+    auto unit = Unit::create();
+    auto phraseA = Phrase::create();
+    phraseA->setId("A");
+    phraseA->setText("text A");
+    auto phraseB = Phrase::create();
+    phraseB->setId("B");
+    phraseB->setText("text B");
+    unit->addPhrase(phraseA, 0);
+
+    PhraseListModel model;
+    model.setUnit(unit.get());
+    QCOMPARE(model.rowCount(), 1);
+
+    QSignalSpy insertedSpy(&model, &PhraseListModel::rowsInserted);
+    unit->addPhrase(phraseB, 0);
+    QCOMPARE(insertedSpy.count(), 1);
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.data(model.index(0), PhraseListModel::IdRole).toString(), QString("B"));
+    QCOMPARE(model.data(model.index(1), PhraseListModel::TextRole).toString(), QString("text A"));
+
+    QSignalSpy removedSpy(&model, &PhraseListModel::rowsRemoved);
+    unit->removePhrase(phraseB);
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.data(model.index(0), PhraseListModel::IdRole).toString(), QString("A"));
+}
+
+void TestPhraseListModel::benchmarkData()
+{
+    const int phraseCount {10000};
+    auto unit = Unit::create();
+    for (int i = 0; i < phraseCount; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QStringLiteral("phrase-%1").arg(i));
+        phrase->setText(QStringLiteral("text %1").arg(i));
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    PhraseListModel model;
+    model.setUnit(unit.get());
+    QCOMPARE(model.rowCount(), phraseCount);
+
+    int length {0};
+    QBENCHMARK {
+        for (int row = 0; row < model.rowCount(); ++row) {
+            const QModelIndex index = model.index(row);
+            length += model.data(index, PhraseListModel::TextRole).toString().size();
+            length += model.data(index, PhraseListModel::DataRole).isValid() ? 1 : 0;
+        }
+    }
+    QVERIFY(length > 0);
+}
+
+void TestPhraseListModel::filterModel()
+{
+    auto unit = Unit::create();
+    auto phraseA = Phrase::create();
+    phraseA->setId("A");
+    phraseA->setText("b");
+    phraseA->setType(IPhrase::Type::Word);
+    phraseA->setSound(QUrl::fromLocalFile("/tmp/a.ogg"));
+    auto phraseB = Phrase::create();
+    phraseB->setId("B");
+    phraseB->setText("a");
+    phraseB->setType(IPhrase::Type::Sentence);
+    phraseB->setSound(QUrl::fromLocalFile("/tmp/b.ogg"));
+    auto phraseC = Phrase::create();
+    phraseC->setId("C");
+    phraseC->setText("c");
+    unit->addPhrase(phraseA, 0);
+    unit->addPhrase(phraseB, 1);
+    unit->addPhrase(phraseC, 2);
+
+    PhraseListModel model;
+    model.setUnit(unit.get());
+    PhraseFilterModel filter;
+    filter.setPhraseModel(&model);
+    auto idAt = [&filter](int row) {
+        return filter.data(filter.index(row, 0), PhraseListModel::IdRole).toString();
+    };
+
+    // phrases without recording are hidden
+    QCOMPARE(filter.rowCount(), 2);
+    QCOMPARE(idAt(0), QString("B"));
+    QCOMPARE(idAt(1), QString("A"));
+
+    filter.setSortOption(PhraseFilterModel::Type);
+    QCOMPARE(idAt(0), QString("A"));
+    QCOMPARE(idAt(1), QString("B"));
+    filter.setSortOption(PhraseFilterModel::Id);
+    QCOMPARE(idAt(0), QString("B"));
+
+    // changed phrases are sorted and filtered again
+    phraseA->setText("0");
+    QTRY_COMPARE(idAt(0), QString("A"));
+    phraseC->setSound(QUrl::fromLocalFile("/tmp/c.ogg"));
+    QTRY_COMPARE(filter.rowCount(), 3);
+    QCOMPARE(idAt(2), QString("C"));
+
+    // sort keys follow inserted and removed rows
+    auto phraseD = Phrase::create();
+    phraseD->setId("D");
+    phraseD->setText("00");
+    phraseD->setSound(QUrl::fromLocalFile("/tmp/d.ogg"));
+    unit->addPhrase(phraseD, 0);
+    QCOMPARE(filter.rowCount(), 4);
+    QCOMPARE(idAt(1), QString("D"));
+    unit->removePhrase(phraseA);
+    QCOMPARE(filter.rowCount(), 3);
+    QCOMPARE(idAt(0), QString("D"));
+    QCOMPARE(idAt(1), QString("B"));
+    QCOMPARE(idAt(2), QString("C"));
+
+    // excluded phrases are hidden
+    phraseB->setExcluded(true);
+    QCOMPARE(model.data(model.index(1), PhraseListModel::ExcludedRole).toBool(), true);
+    QTRY_COMPARE(filter.rowCount(), 2);
+    QCOMPARE(idAt(1), QString("C"));
+    phraseB->setExcluded(false);
+    QTRY_COMPARE(filter.rowCount(), 3);
+
+    auto phraseE = Phrase::create();
+    phraseE->setId("E");
+    phraseE->setText("e");
+    unit->addPhrase(phraseE, 1);
+    QCOMPARE(filter.rowCount(), 3);
+    filter.setHideExcluded(false);
+    QCOMPARE(filter.rowCount(), 4);
+    QCOMPARE(idAt(3), QString("E"));
+}
+
+void TestPhraseListModel::benchmarkFilterModel()
+{
+    const int phraseCount {10000};
+    auto unit = Unit::create();
+    for (int i = 0; i < phraseCount; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QStringLiteral("phrase-%1").arg(i));
+        phrase->setText(QStringLiteral("text %1").arg((i * 7919) % phraseCount));
+        phrase->setType(static_cast<IPhrase::Type>(i % 4));
+        if (i % 2 == 0) {
+            phrase->setSound(QUrl::fromLocalFile(QStringLiteral("/tmp/phrase-%1.ogg").arg(i)));
+        }
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    PhraseListModel model;
+    model.setUnit(unit.get());
+    PhraseFilterModel filter;
+    filter.setPhraseModel(&model);
+    QCOMPARE(filter.rowCount(), phraseCount / 2);
+
+    QBENCHMARK {
+        filter.setSortOption(PhraseFilterModel::Type);
+        filter.setSortOption(PhraseFilterModel::Id);
+        filter.setHideExcluded(false);
+        filter.setHideExcluded(true);
+    }
+    QCOMPARE(filter.rowCount(), phraseCount / 2);
+}
+
+QTEST_GUILESS_MAIN(TestPhraseListModel)
@@ -0,0 +1,41 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_PHRASELISTMODEL_H
+#define TEST_PHRASELISTMODEL_H
+
+#include <QObject>
+
+class TestPhraseListModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestPhraseListModel() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that model rows follow phrase insertions and removals of the unit
+     */
+    void rowsFollowUnit();
+
+    /**
+     * @brief Benchmark data() calls for all rows of a unit with 10000 phrases
+     */
+    void benchmarkData();
+
+    /**
+     * @brief Test sorting and filtering of the phrase filter model and its updates on phrase changes
+     */
+    void filterModel();
+
+    /**
+     * @brief Benchmark re-sorting and re-filtering a unit with 10000 phrases
+     */
+    void benchmarkFilterModel();
+};
+
+#endif
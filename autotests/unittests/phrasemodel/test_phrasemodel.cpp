@@ -0,0 +1,98 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_phrasemodel.h"
+#include "../mocks/languagestub.h"
+#include "../mocks/resourcerepositorystub.h"
+#include "core/phrase.h"
+#include "core/resources/editablecourseresource.h"
+#include "core/unit.h"
+#include "models/phrasemodel.h"
+#include <QSignalSpy>
+#include <QTest>
+
+namespace
+{
+std::shared_ptr<Phrase> createPhrase(const QString &id)
+{
+    std::shared_ptr<Phrase> phrase = Phrase::create();
+    phrase->setId(id);
+    phrase->setText(id);
+    return phrase;
+}
+
+std::shared_ptr<Unit> createUnit(const QString &id)
+{
+    auto unit = Unit::create();
+    unit->setId(id);
+    return unit;
+}
+}
+
+void TestPhraseModel::batchReset()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    course->addUnit(createUnit("2"));
+    PhraseModel model;
+    model.setCourse(course.get());
+    QCOMPARE(model.rowCount(), 2);
+
+    QSignalSpy aboutToBeResetSpy(&model, &PhraseModel::modelAboutToBeReset);
+    QSignalSpy resetSpy(&model, &PhraseModel::modelReset);
+    QSignalSpy insertSpy(&model, &PhraseModel::rowsAboutToBeInserted);
+    course->beginUpdate();
+    course->unitRange().at(0)->addPhrase(createPhrase("added"), 0);
+    course->unitRange().at(1)->addPhrase(createPhrase("added"), 0);
+    course->addUnit(createUnit("3"));
+    course->unitRange().at(1)->addPhrase(createPhrase("appended"), 1);
+    QCOMPARE(aboutToBeResetSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 0);
+    course->endUpdate();
+
+    QCOMPARE(aboutToBeResetSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 1);
+    QCOMPARE(insertSpy.count(), 0);
+    QCOMPARE(model.rowCount(), 3);
+    QCOMPARE(model.rowCount(model.index(0, 0, QModelIndex())), 4);
+    QCOMPARE(model.rowCount(model.index(1, 0, QModelIndex())), 2);
+    QCOMPARE(model.data(model.index(1, 0, model.index(1, 0, QModelIndex())), PhraseModel::TextRole).toString(), QString("appended"));
+
+    // outside of a batch changes are reported per row
+    course->unitRange().at(2)->addPhrase(createPhrase("single"), 0);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(resetSpy.count(), 1);
+}
+
+void TestPhraseModel::fetchUnit()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    PhraseModel model;
+    model.setCourse(course.get());
+    const auto unit = course->unitRange().at(0);
+    QVERIFY(!unit->isLoaded());
+
+    const QModelIndex unitIndex = model.index(0, 0, QModelIndex());
+    QVERIFY(model.hasChildren(unitIndex));
+    QCOMPARE(model.rowCount(unitIndex), 0);
+    QVERIFY(model.canFetchMore(unitIndex));
+    QVERIFY(!unit->isLoaded());
+
+    QSignalSpy insertSpy(&model, &PhraseModel::rowsInserted);
+    model.fetchMore(unitIndex);
+    QVERIFY(unit->isLoaded());
+    QVERIFY(!model.canFetchMore(unitIndex));
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(insertSpy.at(0).at(0).toModelIndex(), unitIndex);
+    QCOMPARE(insertSpy.at(0).at(1).toInt(), 0);
+    QCOMPARE(insertSpy.at(0).at(2).toInt(), 2);
+    QCOMPARE(model.rowCount(unitIndex), 3);
+}
+
+QTEST_GUILESS_MAIN(TestPhraseModel)
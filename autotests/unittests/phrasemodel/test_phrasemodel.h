@@ -0,0 +1,31 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_PHRASEMODEL_H
+#define TEST_PHRASEMODEL_H
+
+#include <QObject>
+
+class TestPhraseModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestPhraseModel() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that a batch over several units of a course resets the model exactly once
+     */
+    void batchReset();
+
+    /**
+     * @brief Test that units are loaded only when their phrases are fetched
+     */
+    void fetchUnit();
+};
+
+#endif
@@ -0,0 +1,59 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_phraseprefetcher.h"
+#include "src/core/phrase.h"
+#include "src/core/phraseprefetcher.h"
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+void TestPhrasePrefetcher::prefetchSoundFiles()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileA = dir.filePath("a.ogg");
+    const QString fileB = dir.filePath("b.ogg");
+    for (const auto &path : {fileA, fileB}) {
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(QByteArray(200 * 1024, 'x'));
+    }
+    std::shared_ptr<Phrase> phraseA = Phrase::create();
+    std::shared_ptr<Phrase> phraseB = Phrase::create();
+    phraseA->setSound(QUrl::fromLocalFile(fileA));
+    phraseB->setSound(QUrl::fromLocalFile(fileB));
+
+    PhrasePrefetcher prefetcher;
+    QSignalSpy spy(&prefetcher, &PhrasePrefetcher::fileWarmed);
+    prefetcher.prefetch({phraseA.get(), phraseB.get()});
+    QVERIFY(prefetcher.isPending(fileA) || prefetcher.isWarm(fileA));
+    QTRY_COMPARE(spy.count(), 2);
+    QVERIFY(prefetcher.isWarm(fileA));
+    QVERIFY(prefetcher.isWarm(fileB));
+    QVERIFY(!prefetcher.isPending(fileA));
+
+    // warm files are not read again
+    prefetcher.prefetch({phraseA.get()});
+    QVERIFY(!prefetcher.isPending(fileA));
+}
+
+void TestPhrasePrefetcher::missingSoundFiles()
+{
+    std::shared_ptr<Phrase> phraseMissing = Phrase::create();
+    std::shared_ptr<Phrase> phraseEmpty = Phrase::create();
+    phraseMissing->setSound(QUrl::fromLocalFile("/does/not/exist.ogg"));
+
+    PhrasePrefetcher prefetcher;
+    QSignalSpy spy(&prefetcher, &PhrasePrefetcher::fileWarmed);
+    prefetcher.prefetch({phraseMissing.get(), phraseEmpty.get()});
+    QTRY_VERIFY(!prefetcher.isPending("/does/not/exist.ogg"));
+    QCOMPARE(spy.count(), 0);
+    QVERIFY(!prefetcher.isWarm("/does/not/exist.ogg"));
+}
+
+QTEST_GUILESS_MAIN(TestPhrasePrefetcher)
@@ -0,0 +1,31 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTPHRASEPREFETCHER_H
+#define TESTPHRASEPREFETCHER_H
+
+#include <QObject>
+
+class TestPhrasePrefetcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestPhrasePrefetcher() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that sound files of phrases are read in background and reported as warm
+     */
+    void prefetchSoundFiles();
+
+    /**
+     * @brief Test that phrases without readable sound files are ignored
+     */
+    void missingSoundFiles();
+};
+
+#endif
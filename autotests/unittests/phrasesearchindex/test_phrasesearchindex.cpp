@@ -0,0 +1,301 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_phrasesearchindex.h"
+#include "../mocks/coursestub.h"
+#include "../mocks/editablecoursestub.h"
+#include "../mocks/languagestub.h"
+#include "../mocks/resourcerepositorystub.h"
+#include "editablerepositorystub.h"
+#include "src/core/phoneme.h"
+#include "src/core/phonemegroup.h"
+#include "src/core/phrase.h"
+#include "src/core/phrasesearchindex.h"
+#include "src/core/resources/courseresource.h"
+#include "src/core/unit.h"
+#include "src/models/phrasesearchmodel.h"
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace
+{
+std::shared_ptr<Phrase> createPhrase(const QString &id, const QString &text)
+{
+    std::shared_ptr<Phrase> phrase = Phrase::create();
+    phrase->setId(id);
+    phrase->setText(text);
+    return phrase;
+}
+
+std::shared_ptr<Unit> createUnit(const QString &id, const QString &title, const QStringList &texts)
+{
+    auto unit = Unit::create();
+    unit->setId(id);
+    unit->setTitle(title);
+    for (int i = 0; i < texts.count(); ++i) {
+        unit->addPhrase(createPhrase(id + QString::number(i), texts.at(i)), unit->phraseCount());
+    }
+    return unit;
+}
+
+QStringList resultTexts(PhraseSearchIndex &index, const QString &query)
+{
+    QStringList texts;
+    const auto results = index.search(query, 100);
+    for (const auto &result : results) {
+        texts.append(index.document(result.document).text);
+    }
+    return texts;
+}
+}
+
+void TestPhraseSearchIndex::normalization()
+{
+    QCOMPARE(PhraseSearchIndex::normalize("Crème Brûlée"), QString("creme brulee"));
+    QCOMPARE(PhraseSearchIndex::tokenize("Guten Tag, wie geht's?"), QStringList({"guten", "tag", "wie", "geht", "s"}));
+    QCOMPARE(PhraseSearchIndex::tokenize("  "), QStringList());
+}
+
+void TestPhraseSearchIndex::search()
+{
+    auto language = std::make_shared<LanguageStub>("fr");
+    auto group = language->addPhonemeGroup("vowels", "Vowels");
+    auto phoneme = group->addPhoneme("ø", "ø");
+    auto greetings = createUnit("greetings", "Salutations", {"Bonjour", "Bonsoir", "Au revoir"});
+    auto food = createUnit("food", "Cuisine", {"Un café", "Crème brûlée", "Deux œufs"});
+    std::static_pointer_cast<Phrase>(food->findPhrase("food2"))->addPhoneme(phoneme.get());
+    auto course = CourseStub::create(language, {greetings, food});
+    ResourceRepositoryStub repository({language}, {course});
+
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    QCOMPARE(index.count(), 6);
+
+    // exact matches rank before prefix matches
+    QCOMPARE(resultTexts(index, "bon"), QStringList({"Bonjour", "Bonsoir"}));
+    QCOMPARE(resultTexts(index, "bonjour"), QStringList({"Bonjour"}));
+    // diacritics and case are ignored in both directions
+    QCOMPARE(resultTexts(index, "CAFE"), QStringList({"Un café"}));
+    QCOMPARE(resultTexts(index, "brûlee creme"), QStringList({"Crème brûlée"}));
+    // all terms must match
+    QCOMPARE(resultTexts(index, "creme cafe"), QStringList());
+    // unit titles and phonemes
+    QCOMPARE(resultTexts(index, "salutations").count(), 3);
+    QCOMPARE(resultTexts(index, "ø"), QStringList({"Deux œufs"}));
+    // fuzzy match only for unmatched terms
+    QCOMPARE(resultTexts(index, "revoire"), QStringList({"Au revoir"}));
+    QCOMPARE(resultTexts(index, "xyz"), QStringList());
+    QCOMPARE(index.search("bon", 1).count(), 1);
+    QVERIFY(index.search("", 10).isEmpty());
+
+    const auto results = index.search("bonsoir", 10);
+    QCOMPARE(results.count(), 1);
+    QVERIFY(index.phrase(results.first().document) == greetings->findPhrase("greetings1").get());
+    QVERIFY(index.course(results.first().document) == course);
+}
+
+void TestPhraseSearchIndex::incrementalUpdates()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = createUnit("unit", "Reisen", {"Guten Tag", "Auf Wiedersehen"});
+    auto course = EditableCourseStub::create(language, {unit});
+    EditableRepositoryStub repository {
+        {language}, // languages
+        {},         // skeletons
+        {course}    // courses
+    };
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    QSignalSpy spy(&index, &PhraseSearchIndex::indexChanged);
+    QCOMPARE(resultTexts(index, "tag"), QStringList({"Guten Tag"}));
+
+    auto phrase = std::static_pointer_cast<Phrase>(unit->findPhrase("unit0"));
+    phrase->setText("Guten Abend");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(resultTexts(index, "tag"), QStringList());
+    QCOMPARE(resultTexts(index, "abend"), QStringList({"Guten Abend"}));
+    QCOMPARE(index.count(), 2);
+
+    unit->addPhrase(createPhrase("added", "Guten Morgen"), 0);
+    QCOMPARE(resultTexts(index, "guten"), QStringList({"Guten Abend", "Guten Morgen"}));
+    QCOMPARE(index.count(), 3);
+
+    unit->removePhrase(phrase);
+    QCOMPARE(resultTexts(index, "guten"), QStringList({"Guten Morgen"}));
+    QCOMPARE(index.count(), 2);
+    // removed phrases are disconnected
+    const int changes = spy.count();
+    phrase->setText("Guten Tag");
+    QCOMPARE(spy.count(), changes);
+
+    unit->setTitle("Urlaub");
+    QCOMPARE(resultTexts(index, "urlaub").count(), 2);
+    QCOMPARE(resultTexts(index, "reisen").count(), 0);
+}
+
+void TestPhraseSearchIndex::persistentCache()
+{
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString courseFile = directory.filePath("de.xml");
+    QVERIFY(QFile::copy(":/courses/de.xml", courseFile));
+    QVERIFY(QFile::setPermissions(courseFile, QFileDevice::ReadOwner | QFileDevice::WriteOwner));
+    const QString cacheFile = directory.filePath("cache/phrasesearch.cache");
+
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    auto group = std::static_pointer_cast<LanguageStub>(language)->addPhonemeGroup("id", "title");
+    group->addPhoneme("g", "G");
+    group->addPhoneme("u", "U");
+    ResourceRepositoryStub languageRepository({language});
+
+    {
+        auto course = CourseResource::create(QUrl::fromLocalFile(courseFile), &languageRepository);
+        ResourceRepositoryStub repository({language}, {course});
+        PhraseSearchIndex index;
+        index.setCacheFile(cacheFile);
+        index.setRepository(&repository);
+        // courses are only read by the first query
+        QVERIFY(!QFile::exists(cacheFile));
+        QCOMPARE(index.count(), 3);
+        QVERIFY(QFile::exists(cacheFile));
+    }
+
+    auto course = CourseResource::create(QUrl::fromLocalFile(courseFile), &languageRepository);
+    ResourceRepositoryStub repository({language}, {course});
+    PhraseSearchIndex index;
+    index.setCacheFile(cacheFile);
+    index.setRepository(&repository);
+    QCOMPARE(index.count(), 3);
+    const auto results = index.search("wiedersehen", 10);
+    QCOMPARE(results.count(), 1);
+    QCOMPARE(index.document(results.first().document).unitTitle, QString("Auf der Straße"));
+    // phoneme "g" matches exactly, "geht" only by prefix
+    QCOMPARE(resultTexts(index, "g"), QStringList({"Guten Tag.", "Wie geht es dir?"}));
+    // restored documents only resolve their phrase on request
+    QVERIFY(index.document(results.first().document).phrase.expired());
+    IPhrase *phrase = index.phrase(results.first().document);
+    QVERIFY(phrase != nullptr);
+    QCOMPARE(phrase->text(), QString("Auf Wiedersehen."));
+
+    // a modified course file invalidates its cache entry
+    QFile file(courseFile);
+    QVERIFY(file.open(QIODevice::Append));
+    file.write("\n");
+    file.close();
+    PhraseSearchIndex updatedIndex;
+    updatedIndex.setCacheFile(cacheFile);
+    updatedIndex.setRepository(&repository);
+    const auto updatedResults = updatedIndex.search("wiedersehen", 10);
+    QCOMPARE(updatedResults.count(), 1);
+    QVERIFY(!updatedIndex.document(updatedResults.first().document).phrase.expired());
+}
+
+void TestPhraseSearchIndex::deferredCompaction()
+{
+    QStringList texts;
+    for (int i = 0; i < 2000; ++i) {
+        texts.append((i % 2 == 0 ? "even" : "odd") + QString::number(i));
+    }
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = createUnit("unit", "Zahlen", texts);
+    auto course = EditableCourseStub::create(language, {unit});
+    EditableRepositoryStub repository {
+        {language}, // languages
+        {},         // skeletons
+        {course}    // courses
+    };
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    QCOMPARE(index.count(), 2000);
+    const auto results = index.search("odd1999", 10);
+    QCOMPARE(results.count(), 1);
+
+    // removing most phrases exceeds the compaction threshold
+    QSignalSpy spy(&index, &PhraseSearchIndex::indexChanged);
+    for (int i = 0; i < 1500; ++i) {
+        unit->removePhrase(unit->phraseRange().at(0));
+    }
+    const int removals = spy.count();
+    QCOMPARE(index.count(), 500);
+    QCOMPARE(index.document(results.first().document).text, QString("odd1999"));
+    QVERIFY(index.phrase(results.first().document) == unit->findPhrase("unit1999").get());
+
+    QTRY_COMPARE(spy.count(), removals + 1);
+    const auto compacted = index.search("odd1999", 10);
+    QCOMPARE(compacted.count(), 1);
+    QVERIFY(compacted.first().document < results.first().document);
+    QCOMPARE(index.document(compacted.first().document).text, QString("odd1999"));
+    QCOMPARE(index.count(), 500);
+}
+
+void TestPhraseSearchIndex::searchModel()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = createUnit("unit", "Reisen", {"Guten Tag", "Guten Abend", "Auf Wiedersehen"});
+    auto course = EditableCourseStub::create(language, {unit});
+    EditableRepositoryStub repository {
+        {language}, // languages
+        {},         // skeletons
+        {course}    // courses
+    };
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    PhraseSearchModel model(&index);
+    QSignalSpy countSpy(&model, &PhraseSearchModel::countChanged);
+    QCOMPARE(model.rowCount(), 0);
+
+    model.setQuery("guten");
+    QCOMPARE(countSpy.count(), 1);
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.data(model.index(0), PhraseSearchModel::TextRole).toString(), QString("Guten Tag"));
+    QCOMPARE(model.data(model.index(0), PhraseSearchModel::UnitTitleRole).toString(), QString("Reisen"));
+    QVERIFY(model.data(model.index(1), PhraseSearchModel::DataRole).value<QObject *>() == unit->findPhrase("unit1").get());
+
+    model.setMaximumResults(1);
+    QCOMPARE(model.rowCount(), 1);
+    model.setMaximumResults(10);
+
+    std::static_pointer_cast<Phrase>(unit->findPhrase("unit2"))->setText("Guten Morgen");
+    QCOMPARE(model.rowCount(), 3);
+
+    // without an index the model stays empty
+    model.setPhraseSearchIndex(nullptr);
+    QCOMPARE(model.rowCount(), 0);
+    QCOMPARE(model.data(model.index(0), PhraseSearchModel::TextRole), QVariant());
+    PhraseSearchModel unboundModel(static_cast<PhraseSearchIndex *>(nullptr));
+    unboundModel.setQuery("guten");
+    QCOMPARE(unboundModel.rowCount(), 0);
+}
+
+void TestPhraseSearchIndex::benchmarkSearch()
+{
+    const QStringList words {"haus", "hand", "hund", "himmel", "garten", "gabel", "kaffee", "kuchen", "straße", "schule"};
+    auto language = std::make_shared<LanguageStub>("de");
+    QVector<std::shared_ptr<Unit>> units;
+    for (int i = 0; i < 100; ++i) {
+        auto unit = Unit::create();
+        unit->setId("unit" + QString::number(i));
+        for (int j = 0; j < 1000; ++j) {
+            const QString text = words.at(j % words.count()) + ' ' + words.at((i + j / 10) % words.count()) + QString::number(j);
+            unit->addPhrase(createPhrase(QString::number(j), text), unit->phraseCount());
+        }
+        units.append(unit);
+    }
+    auto course = CourseStub::create(language, units);
+    ResourceRepositoryStub repository({language}, {course});
+    PhraseSearchIndex index;
+    index.setRepository(&repository);
+    QCOMPARE(index.count(), 100000);
+
+    QVector<PhraseSearchIndex::Result> results;
+    QBENCHMARK {
+        results = index.search("hau gart", 100);
+    }
+    QCOMPARE(results.count(), 100);
+}
+
+QTEST_GUILESS_MAIN(TestPhraseSearchIndex)
@@ -0,0 +1,56 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_PHRASESEARCHINDEX_H
+#define TEST_PHRASESEARCHINDEX_H
+
+#include <QObject>
+
+class TestPhraseSearchIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestPhraseSearchIndex() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test case folding, removal of diacritics and splitting into terms
+     */
+    void normalization();
+
+    /**
+     * @brief Test exact, prefix and fuzzy matches over texts, unit titles and phonemes
+     */
+    void search();
+
+    /**
+     * @brief Test that edits of editable courses update the index
+     */
+    void incrementalUpdates();
+
+    /**
+     * @brief Test that unmodified course files are restored from the cache without loading the course
+     */
+    void persistentCache();
+
+    /**
+     * @brief Test that compaction keeps document numbers until it is announced by indexChanged()
+     */
+    void deferredCompaction();
+
+    /**
+     * @brief Test that the search model follows query and index changes
+     */
+    void searchModel();
+
+    /**
+     * @brief Benchmark of a prefix query over 100000 phrases
+     */
+    void benchmarkSearch();
+};
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "test_resourcerepository.h"
 #include "src/core/language.h"
+#include "src/core/languageregistry.h"
 #include "src/core/resourcerepository.h"
 #include <QSignalSpy>
 #include <QTest>
@@ -71,4 +72,46 @@ void TestResourceRepository::iResourceRepositoryCompatability()
     QCOMPARE(interface->courses(nullptr).count(), 2);      // all courses in total are 2
 }
 
+void TestResourceRepository::sharedLanguages()
+{
+    ResourceRepository first(QUrl::fromLocalFile(m_repositoryLocation.toLocalFile() + "/courses/"));
+    ResourceRepository second(QUrl::fromLocalFile(m_repositoryLocation.toLocalFile() + "/courses/"));
+    QVERIFY(first.languages().count() > 0);
+    QCOMPARE(first.languages().count(), second.languages().count());
+    for (int i = 0; i < first.languages().count(); ++i) {
+        QCOMPARE(first.languages().at(i).get(), second.languages().at(i).get());
+    }
+
+    auto german = LanguageRegistry::instance()->language("de");
+    QVERIFY(german != nullptr);
+    QCOMPARE(german->id(), QString("de"));
+    QCOMPARE(LanguageRegistry::instance()->load(german->file()).get(), german.get());
+    QVERIFY(LanguageRegistry::instance()->language("unknown") == nullptr);
+}
+
+void TestResourceRepository::rangeAccess()
+{
+    ResourceRepository repository(QUrl::fromLocalFile(m_repositoryLocation.toLocalFile() + "/courses/"));
+    repository.reloadCourses();
+
+    const auto courses = repository.courses();
+    QCOMPARE(repository.courseCount(), courses.count());
+    QCOMPARE(repository.courseRange().count(), courses.count());
+    for (int i = 0; i < courses.count(); ++i) {
+        QCOMPARE(repository.courseRange().at(i).get(), courses.at(i).get());
+        QCOMPARE(repository.course(i).get(), courses.at(i).get());
+    }
+
+    const auto languages = repository.languages();
+    QCOMPARE(repository.languageRange().count(), languages.count());
+    for (int i = 0; i < languages.count(); ++i) {
+        QCOMPARE(repository.languageRange().at(i).get(), languages.at(i).get());
+    }
+
+    for (const auto &course : repository.courseRange()) {
+        QCOMPARE(course->unitRange().count(), course->units().count());
+        QCOMPARE(course->unitCount(), course->units().count());
+    }
+}
+
 QTEST_GUILESS_MAIN(TestResourceRepository)
@@ -39,6 +39,16 @@ private Q_SLOTS:
      */
     void iResourceRepositoryCompatability();
 
+    /**
+     * @brief test that repositories share the language objects of the language registry
+     */
+    void sharedLanguages();
+
+    /**
+     * @brief test that range views and index accessors match the copied lists
+     */
+    void rangeAccess();
+
 private:
     QUrl m_repositoryLocation;
 };
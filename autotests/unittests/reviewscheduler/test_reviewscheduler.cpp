@@ -0,0 +1,168 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_reviewscheduler.h"
+#include "src/core/reviewscheduler.h"
+#include <QTest>
+
+namespace
+{
+const QDateTime startTime {QDateTime::fromString(QStringLiteral("2026-01-01T08:00:00Z"), Qt::ISODate)};
+}
+
+void TestReviewScheduler::newItemsInInsertionOrder()
+{
+    ReviewScheduler scheduler;
+    scheduler.insert(QStringLiteral("c"));
+    scheduler.insert(QStringLiteral("a"));
+    scheduler.insert(QStringLiteral("b"));
+    QCOMPARE(scheduler.count(), 3);
+    QCOMPARE(scheduler.dueCount(startTime), 3);
+
+    QCOMPARE(scheduler.next(startTime), QStringLiteral("c"));
+    scheduler.review(QStringLiteral("c"), ReviewScheduler::Correct, startTime);
+    QCOMPARE(scheduler.next(startTime), QStringLiteral("a"));
+    scheduler.review(QStringLiteral("a"), ReviewScheduler::Correct, startTime);
+    QCOMPARE(scheduler.next(startTime), QStringLiteral("b"));
+    scheduler.review(QStringLiteral("b"), ReviewScheduler::Correct, startTime);
+    QVERIFY(scheduler.next(startTime).isEmpty());
+    QCOMPARE(scheduler.dueCount(startTime), 0);
+}
+
+void TestReviewScheduler::sm2Progression()
+{
+    LearnerProfile::ReviewState state;
+    state = ReviewScheduler::schedule(state, ReviewScheduler::Correct, startTime);
+    QCOMPARE(state.repetitions, 1);
+    QCOMPARE(state.interval, 1);
+    QCOMPARE(state.due, startTime.addDays(1));
+    QVERIFY(qFuzzyCompare(state.easiness, 2.5));
+
+    state = ReviewScheduler::schedule(state, ReviewScheduler::Perfect, state.due);
+    QCOMPARE(state.repetitions, 2);
+    QCOMPARE(state.interval, 6);
+    QVERIFY(qFuzzyCompare(state.easiness, 2.6));
+
+    state = ReviewScheduler::schedule(state, ReviewScheduler::Correct, state.due);
+    QCOMPARE(state.repetitions, 3);
+    QCOMPARE(state.interval, 16); // ceil(6 * 2.6)
+
+    // lapse resets repetitions and lowers easiness
+    const QDateTime lapseTime = state.due;
+    state = ReviewScheduler::schedule(state, ReviewScheduler::Blackout, lapseTime);
+    QCOMPARE(state.repetitions, 0);
+    QCOMPARE(state.interval, 0);
+    QVERIFY(state.due > lapseTime);
+    QVERIFY(state.due < lapseTime.addDays(1));
+    QVERIFY(state.easiness < 2.6);
+
+    // easiness never drops below SM-2 minimum
+    for (int i = 0; i < 10; ++i) {
+        state = ReviewScheduler::schedule(state, ReviewScheduler::Blackout, lapseTime);
+    }
+    QVERIFY(qFuzzyCompare(state.easiness, 1.3));
+}
+
+void TestReviewScheduler::dueItems()
+{
+    LearnerProfile::ReviewState future;
+    future.repetitions = 2;
+    future.interval = 6;
+    future.due = startTime.addDays(3);
+
+    ReviewScheduler scheduler;
+    scheduler.insert(QStringLiteral("later"), future);
+    QVERIFY(scheduler.next(startTime).isEmpty());
+    QCOMPARE(scheduler.next(startTime.addDays(3)), QStringLiteral("later"));
+
+    scheduler.insert(QStringLiteral("new"));
+    QCOMPARE(scheduler.next(startTime), QStringLiteral("new"));
+    QCOMPARE(scheduler.dueCount(startTime), 1);
+
+    // failed item comes back after relearning step, successful one not within the same day
+    scheduler.review(QStringLiteral("new"), ReviewScheduler::Incorrect, startTime);
+    QVERIFY(scheduler.next(startTime).isEmpty());
+    QCOMPARE(scheduler.next(startTime.addSecs(3600)), QStringLiteral("new"));
+    QCOMPARE(scheduler.state(QStringLiteral("new")).repetitions, 0);
+}
+
+void TestReviewScheduler::upcomingItems()
+{
+    ReviewScheduler scheduler;
+    for (int i = 0; i < 20; ++i) {
+        LearnerProfile::ReviewState state;
+        state.due = startTime.addSecs(-60 * ((i * 7) % 20)); // all due, shuffled order
+        scheduler.insert(QString::number(i), state);
+    }
+    // rescheduled items leave stale heap entries behind, which must be skipped
+    scheduler.review(QStringLiteral("3"), ReviewScheduler::Correct, startTime);
+    scheduler.review(QStringLiteral("5"), ReviewScheduler::Correct, startTime);
+
+    const QStringList upcoming = scheduler.upcoming(startTime, 5);
+    QCOMPARE(upcoming.count(), 5);
+    for (const auto &expected : upcoming) {
+        QCOMPARE(scheduler.next(startTime), expected);
+        scheduler.review(expected, ReviewScheduler::Correct, startTime);
+    }
+    QCOMPARE(scheduler.upcoming(startTime, 100).count(), 13);
+    QVERIFY(scheduler.upcoming(startTime.addSecs(-3600), 5).isEmpty());
+}
+
+void TestReviewScheduler::hasDueItem()
+{
+    ReviewScheduler scheduler;
+    QVERIFY(!scheduler.hasDueItem(startTime));
+    scheduler.insert(QStringLiteral("a"));
+    QVERIFY(scheduler.hasDueItem(startTime));
+    QVERIFY(!scheduler.hasDueItem(startTime, QStringLiteral("a")));
+
+    scheduler.insert(QStringLiteral("b"));
+    scheduler.insert(QStringLiteral("c"));
+    QVERIFY(scheduler.hasDueItem(startTime, QStringLiteral("a")));
+
+    // stale entries of rescheduled items below the root are skipped
+    scheduler.review(QStringLiteral("b"), ReviewScheduler::Correct, startTime);
+    scheduler.review(QStringLiteral("c"), ReviewScheduler::Correct, startTime);
+    QCOMPARE(scheduler.next(startTime), QStringLiteral("a"));
+    QVERIFY(!scheduler.hasDueItem(startTime, QStringLiteral("a")));
+    QVERIFY(scheduler.hasDueItem(startTime.addDays(1), QStringLiteral("a")));
+    QCOMPARE(scheduler.upcoming(startTime.addDays(1), 3), QStringList({"a", "b", "c"}));
+}
+
+void TestReviewScheduler::benchmarkReviews()
+{
+    const int items {5000};
+    const int reviews {20000};
+    QStringList ids;
+    ids.reserve(items);
+    for (int i = 0; i < items; ++i) {
+        ids.append(QStringLiteral("phrase-%1").arg(i));
+    }
+
+    QBENCHMARK {
+        ReviewScheduler scheduler;
+        for (const auto &id : qAsConst(ids)) {
+            scheduler.insert(id);
+        }
+        QDateTime now = startTime;
+        int performed {0};
+        while (performed < reviews) {
+            const QString id = scheduler.next(now);
+            if (id.isEmpty()) {
+                // nothing due anymore, continue with next session
+                now = now.addDays(1);
+                continue;
+            }
+            // deterministic mix of grades, roughly every fifth review fails
+            const auto grade = (qHash(id) + performed) % 5 == 0 ? ReviewScheduler::Incorrect : ReviewScheduler::Correct;
+            scheduler.review(id, grade, now);
+            ++performed;
+        }
+        QCOMPARE(scheduler.count(), items);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestReviewScheduler)
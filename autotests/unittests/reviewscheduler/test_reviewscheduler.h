@@ -0,0 +1,51 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTREVIEWSCHEDULER_H
+#define TESTREVIEWSCHEDULER_H
+
+#include <QObject>
+
+class TestReviewScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestReviewScheduler() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that items without review history are handed out in insertion order
+     */
+    void newItemsInInsertionOrder();
+
+    /**
+     * @brief Test SM-2 interval and easiness progression for successful and failed reviews
+     */
+    void sm2Progression();
+
+    /**
+     * @brief Test that only due items are returned and persisted states are honored
+     */
+    void dueItems();
+
+    /**
+     * @brief Test that upcoming items match the order of successive next() calls
+     */
+    void upcomingItems();
+
+    /**
+     * @brief Test the due check that excludes the active item, also with stale heap entries
+     */
+    void hasDueItem();
+
+    /**
+     * @brief Simulate several thousand reviews over a large course and measure scheduling cost
+     */
+    void benchmarkReviews();
+};
+
+#endif
@@ -0,0 +1,162 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_rowchangerouter.h"
+#include "../mocks/coursestub.h"
+#include "../mocks/languagestub.h"
+#include "core/phrase.h"
+#include "core/unit.h"
+#include "models/phrasemodel.h"
+#include "models/rowchangerouter.h"
+#include <QSignalSpy>
+#include <QTest>
+
+namespace
+{
+QVector<std::shared_ptr<Phrase>> createPhrases(int count)
+{
+    QVector<std::shared_ptr<Phrase>> phrases;
+    for (int i = 0; i < count; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QString::number(i));
+        phrases.append(phrase);
+    }
+    return phrases;
+}
+
+void insertPhrase(RowChangeRouter &router, int row, Phrase *phrase)
+{
+    router.insert(row, phrase);
+    router.watch(phrase, &IPhrase::textChanged);
+}
+}
+
+void TestRowChangeRouter::rowLookup()
+{
+    const auto phrases = createPhrases(5);
+    RowChangeRouter router;
+    for (int i = 0; i < 4; ++i) {
+        insertPhrase(router, i, phrases.at(i).get());
+    }
+    QCOMPARE(router.count(), 4);
+    QCOMPARE(router.row(phrases.at(3).get()), 3);
+    QCOMPARE(router.row(phrases.at(4).get()), -1);
+
+    insertPhrase(router, 0, phrases.at(4).get());
+    QCOMPARE(router.row(phrases.at(4).get()), 0);
+    QCOMPARE(router.row(phrases.at(0).get()), 1);
+    QCOMPARE(router.row(phrases.at(3).get()), 4);
+
+    router.remove(1, 2);
+    QCOMPARE(router.count(), 3);
+    QCOMPARE(router.row(phrases.at(0).get()), -1);
+    QCOMPARE(router.row(phrases.at(1).get()), -1);
+    QCOMPARE(router.row(phrases.at(2).get()), 1);
+    QVERIFY(router.object(2) == phrases.at(3).get());
+
+    router.clear();
+    QCOMPARE(router.count(), 0);
+    QCOMPARE(router.row(phrases.at(4).get()), -1);
+}
+
+void TestRowChangeRouter::coalescedRanges()
+{
+    const auto phrases = createPhrases(5);
+    RowChangeRouter router;
+    for (int i = 0; i < phrases.count(); ++i) {
+        insertPhrase(router, i, phrases.at(i).get());
+    }
+    QSignalSpy spy(&router, &RowChangeRouter::rowsChanged);
+    phrases.at(3)->setText("3");
+    phrases.at(0)->setText("0");
+    phrases.at(1)->setText("1");
+    phrases.at(1)->setText("one");
+    QCOMPARE(spy.count(), 0);
+
+    QTRY_COMPARE(spy.count(), 2);
+    QCOMPARE(spy.at(0).at(0).toInt(), 0);
+    QCOMPARE(spy.at(0).at(1).toInt(), 1);
+    QCOMPARE(spy.at(1).at(0).toInt(), 3);
+    QCOMPARE(spy.at(1).at(1).toInt(), 3);
+
+    // rows are resolved when reported
+    phrases.at(4)->setText("4");
+    router.remove(0, 0);
+    router.flush();
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(spy.at(2).at(0).toInt(), 3);
+}
+
+void TestRowChangeRouter::removedObjects()
+{
+    const auto phrases = createPhrases(3);
+    RowChangeRouter router;
+    for (int i = 0; i < phrases.count(); ++i) {
+        insertPhrase(router, i, phrases.at(i).get());
+    }
+    QSignalSpy spy(&router, &RowChangeRouter::rowsChanged);
+    phrases.at(1)->setText("1");
+    router.remove(1, 1);
+    router.flush();
+    QCOMPARE(spy.count(), 0);
+
+    phrases.at(1)->setText("one");
+    router.flush();
+    QCOMPARE(spy.count(), 0);
+}
+
+void TestRowChangeRouter::phraseModelRouting()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    QVector<std::shared_ptr<Unit>> units;
+    for (int i = 0; i < 2; ++i) {
+        auto unit = Unit::create();
+        unit->setId(QString::number(i));
+        const auto phrases = createPhrases(3);
+        for (int j = 0; j < phrases.count(); ++j) {
+            unit->addPhrase(phrases.at(j), j);
+        }
+        units.append(unit);
+    }
+    auto course = CourseStub::create(language, units);
+    PhraseModel model;
+    model.setCourse(course.get());
+    QSignalSpy spy(&model, &PhraseModel::dataChanged);
+
+    auto inserted = Phrase::create();
+    inserted->setId("inserted");
+    units.at(1)->addPhrase(inserted, 0);
+    QCOMPARE(model.rowCount(model.index(1, 0, QModelIndex())), 4);
+    std::static_pointer_cast<Phrase>(units.at(1)->findPhrase("2"))->setText("changed");
+    inserted->setText("changed");
+    units.at(0)->setTitle("changed");
+    QTRY_COMPARE(spy.count(), 3);
+
+    // the unit title and the non-consecutive phrase rows 0 and 3 of the second unit are separate ranges
+    QList<QPair<QModelIndex, QModelIndex>> ranges;
+    for (const auto &arguments : spy) {
+        ranges.append(qMakePair(arguments.at(0).toModelIndex(), arguments.at(1).toModelIndex()));
+    }
+    const QModelIndex secondUnit = model.index(1, 0, QModelIndex());
+    QVERIFY(ranges.contains(qMakePair(model.index(0, 0, QModelIndex()), model.index(0, 0, QModelIndex()))));
+    QVERIFY(ranges.contains(qMakePair(model.index(0, 0, secondUnit), model.index(0, 0, secondUnit))));
+    QVERIFY(ranges.contains(qMakePair(model.index(3, 0, secondUnit), model.index(3, 0, secondUnit))));
+    QCOMPARE(model.parent(model.index(3, 0, secondUnit)), secondUnit);
+}
+
+void TestRowChangeRouter::benchmarkFrontInsertion()
+{
+    const auto phrases = createPhrases(10000);
+    QBENCHMARK {
+        RowChangeRouter router;
+        for (const auto &phrase : phrases) {
+            insertPhrase(router, 0, phrase.get());
+            QCOMPARE(router.row(phrase.get()), 0);
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(TestRowChangeRouter)
@@ -0,0 +1,46 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TEST_ROWCHANGEROUTER_H
+#define TEST_ROWCHANGEROUTER_H
+
+#include <QObject>
+
+class TestRowChangeRouter : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestRowChangeRouter() = default;
+
+private Q_SLOTS:
+    /**
+     * @brief Test that rows follow insertions and removals
+     */
+    void rowLookup();
+
+    /**
+     * @brief Test that changes are reported once per event loop iteration as consecutive ranges
+     */
+    void coalescedRanges();
+
+    /**
+     * @brief Test that removed objects are disconnected and their pending changes dropped
+     */
+    void removedObjects();
+
+    /**
+     * @brief Test that the phrase model reports changed phrases below their unit
+     */
+    void phraseModelRouting();
+
+    /**
+     * @brief Benchmark of inserting 10000 rows at the front, each followed by a row lookup
+     */
+    void benchmarkFrontInsertion();
+};
+
+#endif
@@ -0,0 +1,191 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_skeletondiff.h"
+#include "../mocks/coursestub.h"
+#include "../mocks/languagestub.h"
+#include "core/phrase.h"
+#include "core/resources/editablecourseresource.h"
+#include "core/resources/skeletondiff.h"
+#include "core/unit.h"
+#include "resourcerepositorystub.h"
+
+#include <QTest>
+#include <memory>
+
+namespace
+{
+std::shared_ptr<Unit> createSkeletonUnit(const QString &id, int phraseCount)
+{
+    auto unit = Unit::create();
+    unit->setId(id);
+    unit->setTitle(id);
+    for (int i = 0; i < phraseCount; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId(QStringLiteral("%1-phrase-%2").arg(id).arg(i));
+        phrase->setText(QStringLiteral("text %1").arg(i));
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    return unit;
+}
+
+std::shared_ptr<Unit> derivedUnit(const std::shared_ptr<EditableCourseResource> &course, const QString &foreignId)
+{
+    for (const auto &unit : course->unitRange()) {
+        if (unit->foreignId() == foreignId) {
+            return unit;
+        }
+    }
+    return nullptr;
+}
+
+QStringList foreignIds(const std::shared_ptr<Unit> &unit)
+{
+    QStringList ids;
+    for (const auto &phrase : unit->phraseRange()) {
+        ids.append(phrase->foreignId());
+    }
+    return ids;
+}
+
+QStringList ids(const std::shared_ptr<Unit> &unit)
+{
+    QStringList ids;
+    for (const auto &phrase : unit->phraseRange()) {
+        ids.append(phrase->id());
+    }
+    return ids;
+}
+}
+
+TestSkeletonDiff::TestSkeletonDiff()
+{
+    qRegisterMetaType<std::shared_ptr<IEditableUnit>>("std::shared_ptr<IEditableUnit>");
+}
+
+void TestSkeletonDiff::importSkeleton()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    QCOMPARE(course->unitCount(), 1);
+    auto skeleton = CourseStub::create(language, {createSkeletonUnit("first", 3), createSkeletonUnit("second", 2)});
+
+    const auto diff = SkeletonDiff::compute(skeleton, course);
+    QCOMPARE(diff.course().get(), course.get());
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::UnitAdded), 2);
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::PhraseAdded), 5);
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::UnitRemoved), 1); // unit of course file refers to another skeleton
+    const auto additions = diff.withoutRemovals();
+    QCOMPARE(additions.course().get(), course.get());
+    QCOMPARE(additions.count(SkeletonDiff::ChangeType::UnitAdded), 2);
+    QCOMPARE(additions.count(SkeletonDiff::ChangeType::PhraseAdded), 5);
+    QCOMPARE(additions.count(SkeletonDiff::ChangeType::UnitRemoved), 0);
+    diff.apply();
+
+    QCOMPARE(course->unitCount(), 3);
+    QCOMPARE(foreignIds(derivedUnit(course, "first")), ids(skeleton->unitRange().at(0)));
+    QCOMPARE(foreignIds(derivedUnit(course, "second")), ids(skeleton->unitRange().at(1)));
+    QVERIFY(SkeletonDiff::compute(skeleton, course).isEmpty());
+}
+
+void TestSkeletonDiff::movePhrases()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto skeletonUnit = createSkeletonUnit("unit", 5);
+    auto skeleton = CourseStub::create(language, {skeletonUnit});
+    SkeletonDiff::compute(skeleton, course).apply();
+
+    // move last phrase to the front
+    auto phrase = std::dynamic_pointer_cast<IEditablePhrase>(skeletonUnit->phraseRange().last());
+    skeletonUnit->removePhrase(phrase);
+    skeletonUnit->addPhrase(phrase, 0);
+
+    const auto diff = SkeletonDiff::compute(skeleton, course);
+    QCOMPARE(diff.changes().count(), 1);
+    QCOMPARE(diff.changes().first().type, SkeletonDiff::ChangeType::PhraseMoved);
+    QCOMPARE(diff.changes().first().phraseId, phrase->id());
+    diff.apply();
+    QCOMPARE(foreignIds(derivedUnit(course, "unit")), ids(skeletonUnit));
+    QVERIFY(SkeletonDiff::compute(skeleton, course).isEmpty());
+}
+
+void TestSkeletonDiff::removeElements()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto skeletonUnit = createSkeletonUnit("unit", 3);
+    auto skeleton = CourseStub::create(language, {skeletonUnit});
+    SkeletonDiff::compute(skeleton, course).apply();
+    auto unit = derivedUnit(course, "unit");
+    QCOMPARE(unit->phraseCount(), 3);
+
+    skeletonUnit->removePhrase(skeletonUnit->phraseRange().at(1));
+    const auto diff = SkeletonDiff::compute(skeleton, course);
+    QCOMPARE(diff.changes().count(), 1);
+    QCOMPARE(diff.changes().first().type, SkeletonDiff::ChangeType::PhraseRemoved);
+    diff.apply();
+    QCOMPARE(unit->phraseCount(), 3);
+    QCOMPARE(unit->phraseRange().at(1)->foreignId(), QString());
+    QVERIFY(SkeletonDiff::compute(skeleton, course).isEmpty());
+}
+
+void TestSkeletonDiff::retitleElements()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto base = CourseStub::create(language, {createSkeletonUnit("first", 1), createSkeletonUnit("second", 1)});
+    auto firstUnit = createSkeletonUnit("first", 1);
+    auto secondUnit = createSkeletonUnit("second", 1);
+    auto skeleton = CourseStub::create(language, {firstUnit, secondUnit});
+    SkeletonDiff::compute(skeleton, course).apply();
+
+    // translate second unit in course and retitle both units in skeleton
+    derivedUnit(course, "second")->setTitle("translated");
+    firstUnit->setTitle("first renamed");
+    secondUnit->setTitle("second renamed");
+    QCOMPARE(SkeletonDiff::compute(skeleton, course).count(SkeletonDiff::ChangeType::UnitRetitled), 0);
+
+    const auto diff = SkeletonDiff::compute(skeleton, course, base);
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::UnitRetitled), 2);
+    diff.apply();
+    QCOMPARE(derivedUnit(course, "first")->title(), QString("first renamed"));
+    QCOMPARE(derivedUnit(course, "second")->title(), QString("translated"));
+}
+
+void TestSkeletonDiff::unloadedUnits()
+{
+    std::shared_ptr<ILanguage> language(new LanguageStub("de"));
+    ResourceRepositoryStub repository({language});
+    auto course = EditableCourseResource::create(QUrl::fromLocalFile(":/courses/de.xml"), &repository);
+    auto skeletonUnit = Unit::create();
+    skeletonUnit->setId("{dd60f04a-eb37-44b7-9787-67aaf7d3578d}");
+    skeletonUnit->setTitle("Auf der Straße");
+    for (const QString &id : {QStringLiteral("{3a4c1926-60d7-44c6-80d1-03165a641c75}"), QStringLiteral("added")}) {
+        auto phrase = Phrase::create();
+        phrase->setId(id);
+        skeletonUnit->addPhrase(phrase, skeletonUnit->phraseCount());
+    }
+    auto skeleton = CourseStub::create(language, {skeletonUnit});
+    const auto unit = course->unitRange().at(0);
+    QVERIFY(!unit->isLoaded());
+
+    const auto diff = SkeletonDiff::compute(skeleton, course);
+    QVERIFY(!unit->isLoaded());
+    QCOMPARE(diff.changes().count(), 2);
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::PhraseAdded), 1);
+    QCOMPARE(diff.count(SkeletonDiff::ChangeType::PhraseRemoved), 1);
+    diff.apply();
+    QVERIFY(unit->isLoaded());
+    QCOMPARE(unit->phraseCount(), 4);
+    QVERIFY(SkeletonDiff::compute(skeleton, course).isEmpty());
+}
+
+QTEST_GUILESS_MAIN(TestSkeletonDiff)
@@ -0,0 +1,46 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTSKELETONDIFF_H
+#define TESTSKELETONDIFF_H
+
+#include <QObject>
+
+class TestSkeletonDiff : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestSkeletonDiff();
+
+private Q_SLOTS:
+    /**
+     * @brief test import of a skeleton into a course and that a second diff is empty
+     */
+    void importSkeleton();
+
+    /**
+     * @brief test that reordered skeleton phrases are moved with a minimal number of changes
+     */
+    void movePhrases();
+
+    /**
+     * @brief test that removed skeleton elements are detached from the course instead of deleted
+     */
+    void removeElements();
+
+    /**
+     * @brief test that retitles are only detected with a base and skipped on conflicts
+     */
+    void retitleElements();
+
+    /**
+     * @brief test that units of the course are compared from their source without loading them
+     */
+    void unloadedUnits();
+};
+
+#endif
@@ -54,6 +54,7 @@ void TestSkeletonResource::loadSkeletonResource()
     QVERIFY(unit != nullptr);
     QCOMPARE(unit->id(), "{11111111-b885-4833-97ff-27cb1ca2f543}");
     QCOMPARE(unit->title(), QStringLiteral("Numbers"));
+    unit->ensureLoaded();
     QCOMPARE(unit->phrases().count(), 2);
     QVERIFY(unit->course() != nullptr);
     QCOMPARE(unit->course().get(), skeleton.get());
@@ -167,6 +168,8 @@ void TestSkeletonResource::fileLoadSaveCompleteness()
     QCOMPARE(testUnit->id(), compareUnit->id());
     QCOMPARE(testUnit->foreignId(), compareUnit->foreignId());
     QCOMPARE(testUnit->title(), compareUnit->title());
+    testUnit->ensureLoaded();
+    compareUnit->ensureLoaded();
     QCOMPARE(testUnit->phrases().count(), compareUnit->phrases().count());
 
     std::shared_ptr<IPhrase> testPhrase = testUnit->phrases().constFirst();
@@ -0,0 +1,131 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_sounddevicecontroller.h"
+#include "libsound/src/backendinterface.h"
+#include "libsound/src/backendregistry.h"
+#include "libsound/src/capturebackendinterface.h"
+#include "libsound/src/capturedevicecontroller.h"
+#include "libsound/src/outputbackendinterface.h"
+#include "libsound/src/outputdevicecontroller.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFuture>
+#include <QProcess>
+#include <QTemporaryDir>
+#include <QtConcurrent>
+
+namespace
+{
+// file to which firstUse() writes its measurements, only set for the separate process
+const char reportVariable[] = "ARTIKULATE_TEST_FIRST_USE_REPORT";
+}
+
+TestSoundDeviceController::TestSoundDeviceController() = default;
+
+void TestSoundDeviceController::initTestCase()
+{
+    BackendRegistry::self().setPreferredBackend(QStringLiteral("artikulate_null_backend"));
+}
+
+void TestSoundDeviceController::startupWithoutBackendLoading()
+{
+    CaptureDeviceController::self();
+    OutputDeviceController::self();
+    QVERIFY(!BackendRegistry::self().isBackendLoaded());
+}
+
+void TestSoundDeviceController::sharedPluginMetadata()
+{
+    const auto backends = BackendRegistry::self().availableBackends();
+    QCOMPARE(BackendRegistry::self().availableBackends().count(), backends.count());
+    QVERIFY(!BackendRegistry::self().isBackendLoaded());
+}
+
+void TestSoundDeviceController::firstUseInFreshProcess()
+{
+    if (BackendRegistry::self().availableBackends().isEmpty()) {
+        QSKIP("No sound backend plugin found");
+    }
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString report = dir.filePath(QStringLiteral("report"));
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert(QLatin1String(reportVariable), report);
+    QProcess process;
+    process.setProcessEnvironment(environment);
+    process.start(QCoreApplication::applicationFilePath(), {QStringLiteral("firstUse")});
+    QVERIFY(process.waitForFinished(30000));
+    QCOMPARE(process.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(process.exitCode(), 0);
+
+    QFile file(report);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QList<QByteArray> values = file.readAll().split(' ');
+    QCOMPARE(values.count(), 2);
+    bool ok {false};
+    const qint64 firstUse = values.at(1).toLongLong(&ok);
+    QVERIFY(ok);
+    QTest::setBenchmarkResult(firstUse, QTest::WalltimeNanoseconds);
+}
+
+void TestSoundDeviceController::firstUse()
+{
+    const QString report = qEnvironmentVariable(reportVariable);
+    if (report.isEmpty()) {
+        QSKIP("Only run in a separate process by firstUseInFreshProcess()");
+    }
+    QElapsedTimer timer;
+    timer.start();
+    CaptureDeviceController::self();
+    OutputDeviceController::self();
+    const qint64 startup = timer.nsecsElapsed();
+    QVERIFY(!BackendRegistry::self().isBackendLoaded());
+
+    // first request loads the plugin and creates the output backend
+    timer.restart();
+    QCOMPARE(OutputDeviceController::self().state(), OutputDeviceController::StoppedState);
+    const qint64 firstUse = timer.nsecsElapsed();
+    QVERIFY(BackendRegistry::self().isBackendLoaded());
+
+    QFile file(report);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.write(QByteArray::number(startup) + ' ' + QByteArray::number(firstUse));
+}
+
+void TestSoundDeviceController::concurrentBackendLoading()
+{
+    if (BackendRegistry::self().availableBackends().isEmpty()) {
+        QSKIP("No sound backend plugin found");
+    }
+    QVector<QFuture<BackendInterface *>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.append(QtConcurrent::run([]() {
+            return BackendRegistry::self().backend();
+        }));
+    }
+    BackendInterface *backend = BackendRegistry::self().backend();
+    QVERIFY(backend != nullptr);
+    for (auto &future : futures) {
+        QCOMPARE(future.result(), backend);
+    }
+    QVERIFY(BackendRegistry::self().isBackendLoaded());
+    QCOMPARE(backend->thread(), thread());
+
+    // the first use from a worker thread creates the objects in the thread of the backend
+    QFuture<OutputBackendInterface *> output = QtConcurrent::run([backend]() {
+        return backend->outputBackend();
+    });
+    QFuture<CaptureBackendInterface *> capture = QtConcurrent::run([backend]() {
+        return backend->captureBackend();
+    });
+    QVERIFY(output.result() != nullptr);
+    QVERIFY(capture.result() != nullptr);
+    QCOMPARE(output.result()->thread(), backend->thread());
+    QCOMPARE(capture.result()->thread(), backend->thread());
+}
+
+QTEST_GUILESS_MAIN(TestSoundDeviceController)
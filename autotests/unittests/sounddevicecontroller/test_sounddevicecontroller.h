@@ -0,0 +1,53 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTSOUNDDEVICECONTROLLER_H
+#define TESTSOUNDDEVICECONTROLLER_H
+
+#include <QObject>
+#include <QTest>
+
+class TestSoundDeviceController : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestSoundDeviceController();
+
+private slots:
+    /**
+     * @brief Select the null backend, which is found through the plugin path set by the test
+     */
+    void initTestCase();
+
+    /**
+     * @brief Test that creating the device controllers does not load any backend
+     */
+    void startupWithoutBackendLoading();
+
+    /**
+     * @brief Test that plugin discovery is done once and shared between all callers
+     */
+    void sharedPluginMetadata();
+
+    /**
+     * @brief Measure creation of the controllers and first playback request in a fresh process
+     */
+    void firstUseInFreshProcess();
+
+    /**
+     * @brief Measurement that is run by firstUseInFreshProcess() in a separate process, skipped otherwise
+     */
+    void firstUse();
+
+    /**
+     * @brief Test that concurrent first use of the registry instantiates one backend only and that
+     * its output and capture backends live in the thread of the backend
+     */
+    void concurrentBackendLoading();
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "test_soundprocessor.h"
+#include "libsound/src/soundprocessor.h"
+#include <QTest>
+#include <cmath>
+
+namespace
+{
+constexpr int sampleRate {48000};
+
+/**
+ * @return mono signal of @p leading silent frames, a 1 kHz sine with @p amplitude of @p frames frames and @p trailing silent frames
+ */
+QVector<float> createSignal(float amplitude, int frames, int leading = 0, int trailing = 0)
+{
+    QVector<float> samples(leading + frames + trailing, 0.0f);
+    for (int i = 0; i < frames; ++i) {
+        samples[leading + i] = amplitude * static_cast<float>(std::sin(2 * M_PI * 1000.0 * i / sampleRate));
+    }
+    return samples;
+}
+
+float peak(const QVector<float> &samples)
+{
+    float result = 0;
+    for (float sample : samples) {
+        result = qMax(result, std::abs(sample));
+    }
+    return result;
+}
+}
+
+void TestSoundProcessor::silentSignal()
+{
+    const SoundProcessor::Settings settings;
+    QVector<float> samples(sampleRate, 0.0f);
+    QVERIFY(!SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    QCOMPARE(samples.size(), sampleRate);
+    QCOMPARE(peak(samples), 0.0f);
+
+    QVector<float> empty;
+    QVERIFY(!SoundProcessor::processSamples(empty, sampleRate, 1, settings));
+}
+
+void TestSoundProcessor::quietSignal()
+{
+    const SoundProcessor::Settings settings;
+    // -40 dBFS sine, about 20 dB below the target loudness
+    QVector<float> samples = createSignal(0.01f, sampleRate);
+    QVERIFY(SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    QCOMPARE(samples.size(), sampleRate);
+    QVERIFY(peak(samples) > 0.08f);
+    QVERIFY(peak(samples) < 0.125f);
+
+    // a normalized signal is left as it is
+    const QVector<float> normalized = samples;
+    QVERIFY(!SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    QCOMPARE(samples, normalized);
+}
+
+void TestSoundProcessor::paddedSignal()
+{
+    const SoundProcessor::Settings settings;
+    const int paddingFrames = settings.silencePadding * sampleRate / 1000;
+    const int toneFrames = sampleRate / 2;
+    QVector<float> samples = createSignal(0.1f, toneFrames, sampleRate / 2, sampleRate / 2);
+    QVERIFY(SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    // the first and last frame of the tone are zero crossings below the silence threshold
+    QVERIFY(qAbs(samples.size() - (toneFrames + 2 * paddingFrames)) <= 2);
+    QCOMPARE(samples.first(), 0.0f);
+    QCOMPARE(samples.last(), 0.0f);
+
+    // the trimmed signal keeps its padding
+    const QVector<float> trimmed = samples;
+    QVERIFY(!SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    QCOMPARE(samples, trimmed);
+}
+
+void TestSoundProcessor::peakLimit()
+{
+    SoundProcessor::Settings settings;
+    settings.targetLoudness = 0.0;
+    QVector<float> samples = createSignal(0.1f, sampleRate);
+    QVERIFY(SoundProcessor::processSamples(samples, sampleRate, 1, settings));
+    QVERIFY(std::abs(peak(samples) - static_cast<float>(std::pow(10.0, settings.maximumPeak / 20.0))) < 1e-4f);
+}
+
+QTEST_GUILESS_MAIN(TestSoundProcessor)
@@ -0,0 +1,41 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TESTSOUNDPROCESSOR_H
+#define TESTSOUNDPROCESSOR_H
+
+#include <QObject>
+
+class TestSoundProcessor : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestSoundProcessor() = default;
+
+private slots:
+    /**
+     * @brief Test that silent signals are neither trimmed nor normalized
+     */
+    void silentSignal();
+
+    /**
+     * @brief Test that quiet signals are amplified to the target loudness and then need no change
+     */
+    void quietSignal();
+
+    /**
+     * @brief Test that leading and trailing silence is removed except for the padding
+     */
+    void paddedSignal();
+
+    /**
+     * @brief Test that the gain is limited by the maximum sample peak
+     */
+    void peakLimit();
+};
+
+#endif
@@ -10,15 +10,26 @@
 #include "liblearnerprofile/src/profilemanager.h"
 #include "src/core/icourse.h"
 #include "src/core/language.h"
+#include "src/core/multicoursesessionsource.h"
+#include "src/core/phoneme.h"
 #include "src/core/trainingaction.h"
+#include "src/core/trainingactionpool.h"
 #include "src/core/trainingsession.h"
 #include "src/core/unit.h"
+#include <QSet>
 #include <QSignalSpy>
+#include <QStandardPaths>
 #include <QTest>
 
 // assumption: during a training session the units and phrases of a course do not change
 //   any change of such a course shall result in a reload of a training session
 
+void TestTrainingSession::initTestCase()
+{
+    // learner database and configuration of test mode, such that no user profile is touched
+    QStandardPaths::setTestModeEnabled(true);
+}
+
 void TestTrainingSession::init()
 {
     // no initialization of test case
@@ -190,4 +201,395 @@ void TestTrainingSession::iterateCourse()
     QCOMPARE(spy.count(), 1);
 }
 
+void TestTrainingSession::spacedRepetitionOrder()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unitA = Unit::create();
+    auto unitB = Unit::create();
+    std::shared_ptr<Phrase> phraseA1 = Phrase::create();
+    std::shared_ptr<Phrase> phraseA2 = Phrase::create();
+    std::shared_ptr<Phrase> phraseB1 = Phrase::create();
+    phraseA1->setId("A1");
+    phraseA2->setId("A2");
+    phraseB1->setId("B1");
+    phraseA1->setSound(QUrl::fromLocalFile("/tmp/a1.ogg"));
+    phraseA2->setSound(QUrl::fromLocalFile("/tmp/a2.ogg"));
+    phraseB1->setSound(QUrl::fromLocalFile("/tmp/b1.ogg"));
+    unitA->addPhrase(phraseA1, unitA->phrases().size());
+    unitA->addPhrase(phraseA2, unitA->phrases().size());
+    unitB->addPhrase(phraseB1, unitB->phrases().size());
+
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>({unitA, unitB}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    QSignalSpy modeSpy(&session, &TrainingSession::modeChanged);
+    session.setMode(TrainingSession::SpacedRepetitionMode);
+    QCOMPARE(modeSpy.count(), 1);
+    session.setCourse(&course);
+
+    // phrases never reviewed are due immediately and keep course order
+    QCOMPARE(session.activePhrase(), phraseA1.get());
+    QVERIFY(session.hasNext());
+    session.accept();
+    QCOMPARE(session.activePhrase(), phraseA2.get());
+
+    // skipped phrase is deferred by the relearning step
+    QSignalSpy closeSpy(&session, &TrainingSession::closeUnit);
+    session.skip();
+    QCOMPARE(session.activePhrase(), phraseB1.get());
+    QCOMPARE(closeSpy.count(), 1);
+    QVERIFY(!session.hasNext());
+
+    QSignalSpy completedSpy(&session, &TrainingSession::completed);
+    session.accept();
+    QCOMPARE(completedSpy.count(), 1);
+}
+
+void TestTrainingSession::lazyPhraseActions()
+{
+    auto createUnit = [](const QString &prefix) {
+        auto unit = Unit::create();
+        for (int i = 0; i < 1000; ++i) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(prefix + QString::number(i));
+            phrase->setSound(QUrl::fromLocalFile("/tmp/" + prefix + QString::number(i) + ".ogg"));
+            unit->addPhrase(phrase, unit->phrases().size());
+        }
+        return unit;
+    };
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unitA = createUnit("A");
+    auto unitB = createUnit("B");
+    CourseStub courseA(language, QVector<std::shared_ptr<Unit>>({unitA}));
+    CourseStub courseB(language, QVector<std::shared_ptr<Unit>>({unitB}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+
+    // phrase actions are owned by the session's pool, unit actions by the session
+    auto phraseActionObjects = [&session]() {
+        int count {0};
+        const auto actions = session.findChildren<TrainingAction *>();
+        for (const auto action : actions) {
+            if (action->parent() != &session) {
+                ++count;
+            }
+        }
+        return count;
+    };
+
+    session.setCourse(&courseA);
+    QCOMPARE(session.trainingActions().count(), 1);
+    QCOMPARE(session.trainingActions().first()->actionsCount(), 1000);
+    QCOMPARE(session.trainingActions().first()->phraseAt(500), unitA->phrases().at(500).get());
+    QVERIFY(phraseActionObjects() <= 1);
+
+    auto action = session.trainingActions().first()->action(500);
+    QVERIFY(action);
+    QCOMPARE(action->phrase(), unitA->phrases().at(500).get());
+    const int created = phraseActionObjects();
+    QVERIFY(created <= 2);
+
+    // switching the course recycles existing action objects
+    session.setCourse(&courseB);
+    action = session.trainingActions().first()->action(10);
+    QCOMPARE(action->phrase(), unitB->phrases().at(10).get());
+    QCOMPARE(phraseActionObjects(), created);
+
+    // selection only creates the actions of the involved rows
+    session.setActivePhrase(unitB->phrases().at(20).get());
+    QCOMPARE(session.activePhrase(), unitB->phrases().at(20).get());
+    QVERIFY(session.activeAction()->checked());
+    QVERIFY(phraseActionObjects() <= created + 2);
+}
+
+void TestTrainingSession::releaseHiddenPhraseActions()
+{
+    auto createUnit = [](const QString &prefix) {
+        auto unit = Unit::create();
+        for (int i = 0; i < 5; ++i) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(prefix + QString::number(i));
+            phrase->setSound(QUrl::fromLocalFile("/tmp/" + prefix + QString::number(i) + ".ogg"));
+            unit->addPhrase(phrase, unit->phrases().size());
+        }
+        return unit;
+    };
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unitA = createUnit("A");
+    auto unitB = createUnit("B");
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>({unitA, unitB}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    session.setCourse(&course);
+    auto pool = session.findChild<TrainingActionPool *>();
+    QVERIFY(pool);
+    QCOMPARE(session.trainingActions().count(), 2);
+    auto actionA = session.trainingActions().at(0);
+    QSignalSpy releasedA(actionA, &QAbstractItemModel::modelReset);
+
+    // all rows of the active unit were shown
+    session.setActivePhrase(unitA->phrases().at(0).get());
+    for (int i = 0; i < actionA->actionsCount(); ++i) {
+        QVERIFY(actionA->action(i));
+    }
+    const int created = pool->createdCount();
+
+    // leaving the unit recycles its actions for the rows of the next unit
+    session.setActivePhrase(unitB->phrases().at(0).get());
+    QCOMPARE(releasedA.count(), 1);
+    QCOMPARE(pool->createdCount(), created);
+    QCOMPARE(actionA->actionsCount(), 5);
+    QCOMPARE(actionA->phraseAt(3), unitA->phrases().at(3).get());
+
+    // a unit opened in the drawer keeps its actions until the drawer is reset
+    actionA->trigger();
+    QCOMPARE(actionA->action(1)->phrase(), unitA->phrases().at(1).get());
+    session.setActivePhrase(unitB->phrases().at(1).get());
+    QCOMPARE(releasedA.count(), 1);
+    emit session.closeUnit();
+    QCOMPARE(releasedA.count(), 2);
+    QCOMPARE(session.activePhrase(), unitB->phrases().at(1).get());
+}
+
+void TestTrainingSession::phonemeFocusMode()
+{
+    Phoneme phonemeA;
+    Phoneme phonemeB;
+    phonemeA.setId("a");
+    phonemeB.setId("b");
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = Unit::create();
+    std::shared_ptr<Phrase> phraseA = Phrase::create();
+    std::shared_ptr<Phrase> phraseB = Phrase::create();
+    std::shared_ptr<Phrase> phraseNone = Phrase::create();
+    phraseA->setId("A");
+    phraseB->setId("B");
+    phraseNone->setId("none");
+    phraseA->setSound(QUrl::fromLocalFile("/tmp/a.ogg"));
+    phraseB->setSound(QUrl::fromLocalFile("/tmp/b.ogg"));
+    phraseNone->setSound(QUrl::fromLocalFile("/tmp/none.ogg"));
+    phraseA->addPhoneme(&phonemeA);
+    phraseB->addPhoneme(&phonemeB);
+    unit->addPhrase(phraseA, unit->phrases().size());
+    unit->addPhrase(phraseB, unit->phrases().size());
+    unit->addPhrase(phraseNone, unit->phrases().size());
+
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>({unit}));
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    session.setCourse(&course);
+
+    // make phoneme b the weakest one
+    session.setActivePhrase(phraseA.get());
+    session.accept();
+    QCOMPARE(session.activePhrase(), phraseB.get());
+    session.skip();
+
+    session.setMode(TrainingSession::PhonemeFocusMode);
+    QCOMPARE(session.focusPhonemes().first(), QStringLiteral("b"));
+    QCOMPARE(session.activePhrase(), phraseB.get());
+    QVERIFY(session.hasNext());
+    session.accept();
+    QCOMPARE(session.activePhrase(), phraseA.get());
+    QVERIFY(!session.hasNext());
+
+    // phrases without phonemes are never part of a focus session
+    QSignalSpy completedSpy(&session, &TrainingSession::completed);
+    session.accept();
+    QCOMPARE(completedSpy.count(), 1);
+}
+
+void TestTrainingSession::multiCourseSource()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto createCourse = [&language](const QString &prefix, const QVector<IPhrase::Type> &types) {
+        auto unit = Unit::create();
+        for (int i = 0; i < types.count(); ++i) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(prefix + QString::number(i));
+            phrase->setType(types.at(i));
+            phrase->setSound(QUrl::fromLocalFile("/tmp/" + prefix + QString::number(i) + ".ogg"));
+            unit->addPhrase(phrase, unit->phrases().size());
+        }
+        return CourseStub::create(language, QVector<std::shared_ptr<Unit>>({unit}));
+    };
+    const auto word = IPhrase::Type::Word;
+    const auto sentence = IPhrase::Type::Sentence;
+    auto courseA = createCourse("A", {word, sentence, word});
+    auto courseB = createCourse("B", {word, word});
+    auto courseC = createCourse("C", {word});
+
+    std::unique_ptr<MultiCourseSessionSource> source(new MultiCourseSessionSource({courseA, courseB, courseC}));
+    SessionSource::Filter filter;
+    filter.type = word;
+    source->setFilter(filter);
+    auto sourcePtr = source.get();
+    QCOMPARE(sourcePtr->openedCourses(), 0);
+
+    LearnerProfile::ProfileManager manager;
+    TrainingSession session(&manager);
+    QSignalSpy completedSpy(&session, &TrainingSession::completed);
+    session.setSource(std::move(source));
+    QVERIFY(session.source() == sourcePtr);
+    QVERIFY(session.course() == nullptr);
+    QVERIFY(session.trainingActions().isEmpty());
+
+    // active phrase and the lookahead only open the first two courses
+    QCOMPARE(session.activePhrase()->id(), QString("A0"));
+    QCOMPARE(sourcePtr->openedCourses(), 2);
+
+    QStringList order;
+    while (session.activePhrase()) {
+        order.append(session.activePhrase()->id());
+        QCOMPARE(session.hasNext(), order.count() < 5);
+        // the third course is only opened when the lookahead draws its first phrase
+        QCOMPARE(sourcePtr->openedCourses(), order.count() < 4 ? 2 : 3);
+        session.accept();
+    }
+    QCOMPARE(order, QStringList({"A0", "B0", "A2", "B1", "C0"}));
+    QCOMPARE(completedSpy.count(), 1);
+
+    // setting a course ends training from the source
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>());
+    session.setCourse(&course);
+    QVERIFY(session.source() == nullptr);
+}
+
+void TestTrainingSession::sourceSessionProgress()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    Phoneme phoneme;
+    phoneme.setId("a");
+    auto createCourse = [&language, &phoneme](const QString &id) {
+        auto unit = Unit::create();
+        std::shared_ptr<Phrase> phrase = Phrase::create();
+        phrase->setId("1");
+        phrase->setType(IPhrase::Type::Word);
+        phrase->setSound(QUrl::fromLocalFile("/tmp/" + id + ".ogg"));
+        phrase->addPhoneme(&phoneme);
+        unit->addPhrase(phrase, 0);
+        auto course = CourseStub::create(language, QVector<std::shared_ptr<Unit>>({unit}));
+        std::static_pointer_cast<CourseStub>(course)->setId(id);
+        return course;
+    };
+    const QVector<std::shared_ptr<ICourse>> courses({createCourse("A"), createCourse("B")});
+    LearnerProfile::ProfileManager manager;
+    LearnerProfile::Learner *learner = manager.addProfile(QStringLiteral("source progress tester"));
+    manager.setActiveProfile(learner);
+
+    // the second session continues the statistics of the first one
+    for (int run = 1; run <= 2; ++run) {
+        TrainingSession session(&manager);
+        session.setSource(std::unique_ptr<SessionSource>(new MultiCourseSessionSource(courses)));
+        session.accept();
+        session.skip();
+        QVERIFY(session.activePhrase() == nullptr);
+        auto goal = manager.goal(LearnerProfile::LearningGoal::Language, "de");
+        QVERIFY(goal != nullptr);
+        QCOMPARE(manager.progressValues(learner, goal, "phoneme-attempts").value("a"), 2 * run);
+        QCOMPARE(manager.progressValues(learner, goal, "phoneme-successes").value("a"), run);
+    }
+
+    manager.removeProfile(learner);
+}
+
+void TestTrainingSession::sharedPhraseIdsAcrossCourses()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto createCourse = [&language](const QString &id) {
+        auto unit = Unit::create();
+        for (int i = 1; i <= 2; ++i) {
+            std::shared_ptr<Phrase> phrase = Phrase::create();
+            phrase->setId(QString::number(i));
+            phrase->setType(IPhrase::Type::Word);
+            phrase->setSound(QUrl::fromLocalFile("/tmp/" + id + QString::number(i) + ".ogg"));
+            unit->addPhrase(phrase, unit->phraseCount());
+        }
+        auto course = CourseStub::create(language, QVector<std::shared_ptr<Unit>>({unit}));
+        std::static_pointer_cast<CourseStub>(course)->setId(id);
+        return course;
+    };
+    auto courseA = createCourse("A");
+    auto courseB = createCourse("B");
+    LearnerProfile::ProfileManager manager;
+    LearnerProfile::Learner *learner = manager.addProfile(QStringLiteral("shared id tester"));
+    manager.setActiveProfile(learner);
+
+    TrainingSession session(&manager);
+    session.setSource(std::unique_ptr<SessionSource>(new MultiCourseSessionSource({courseA, courseB})));
+    QSet<QString> reviewed;
+    while (session.activePhrase()) {
+        reviewed.insert(session.activePhrase()->sound().fileName());
+        session.accept();
+    }
+    QCOMPARE(reviewed, QSet<QString>({"A1.ogg", "A2.ogg", "B1.ogg", "B2.ogg"}));
+
+    // every phrase was reviewed once, no course continues the history of the other one
+    auto goal = manager.goal(LearnerProfile::LearningGoal::Language, "de");
+    QVERIFY(goal != nullptr);
+    for (const QString &courseId : {QStringLiteral("A"), QStringLiteral("B")}) {
+        const auto states = manager.reviewStates(learner, goal, courseId);
+        QCOMPARE(states.count(), 2);
+        QCOMPARE(states.value("1").repetitions, 1);
+        QCOMPARE(states.value("2").repetitions, 1);
+    }
+
+    manager.removeProfile(learner);
+}
+
+void TestTrainingSession::resumeSession()
+{
+    auto language = std::make_shared<LanguageStub>("de");
+    auto unit = Unit::create();
+    QVector<std::shared_ptr<Phrase>> phrases;
+    for (int i = 0; i < 4; ++i) {
+        std::shared_ptr<Phrase> phrase = Phrase::create();
+        phrase->setId("resume" + QString::number(i));
+        phrase->setType(IPhrase::Type::Word);
+        phrase->setSound(QUrl::fromLocalFile("/tmp/resume" + QString::number(i) + ".ogg"));
+        unit->addPhrase(phrase, unit->phraseCount());
+        phrases.append(phrase);
+    }
+    CourseStub course(language, QVector<std::shared_ptr<Unit>>({unit}));
+    LearnerProfile::ProfileManager manager;
+    LearnerProfile::Learner *learner = manager.addProfile(QStringLiteral("resume tester"));
+    manager.setActiveProfile(learner);
+
+    {
+        TrainingSession session(&manager);
+        session.setCourse(&course);
+        QCOMPARE(session.activePhrase(), phrases.at(0).get());
+        session.skip();
+        session.accept();
+        QCOMPARE(session.activePhrase(), phrases.at(2).get());
+    }
+
+    TrainingSession resumed(&manager);
+    resumed.setCourse(&course);
+    QCOMPARE(resumed.activePhrase(), phrases.at(2).get());
+    QCOMPARE(resumed.numberPhrasesGroupedByTries(IPhrase::Type::Word, 1), 1);
+    QCOMPARE(resumed.maximumTries(), 1);
+
+    // failed attempt of the first phrase is continued
+    resumed.setActivePhrase(phrases.at(0).get());
+    resumed.accept();
+    QCOMPARE(resumed.numberPhrasesGroupedByTries(IPhrase::Type::Word, 2), 1);
+    QCOMPARE(resumed.numberPhrasesGroupedByTries(IPhrase::Type::Word, 1), 1);
+
+    // the largest bucket shrinks when one of its phrases is accepted again with more tries
+    resumed.setActivePhrase(phrases.at(2).get());
+    resumed.accept();
+    QCOMPARE(resumed.maximumPhrasesPerTry(), 2);
+    for (int i = 0; i < 2; ++i) {
+        resumed.setActivePhrase(phrases.at(2).get());
+        resumed.skip();
+    }
+    resumed.setActivePhrase(phrases.at(2).get());
+    resumed.accept();
+    QCOMPARE(resumed.numberPhrasesGroupedByTries(IPhrase::Type::Word, 3), 1);
+    QCOMPARE(resumed.maximumPhrasesPerTry(), 1);
+
+    manager.removeProfile(learner);
+}
+
 QTEST_GUILESS_MAIN(TestTrainingSession)
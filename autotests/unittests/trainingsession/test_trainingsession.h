@@ -17,6 +17,11 @@ public:
     TestTrainingSession() = default;
 
 private Q_SLOTS:
+    /**
+     * Called before the first test case.
+     */
+    void initTestCase();
+
     /**
      * Called before every test case.
      */
@@ -51,6 +56,46 @@ private Q_SLOTS:
      * @brief Test for all iterator functionality
      */
     void iterateCourse();
+
+    /**
+     * @brief Test that spaced repetition mode presents new phrases first and defers skipped ones
+     */
+    void spacedRepetitionOrder();
+
+    /**
+     * @brief Test that phrase actions are only created on access and reused after course switch
+     */
+    void lazyPhraseActions();
+
+    /**
+     * @brief Test that phrase actions of units neither active nor opened in the drawer are returned to the pool
+     */
+    void releaseHiddenPhraseActions();
+
+    /**
+     * @brief Test that phoneme focus mode only presents phrases of the weakest phonemes
+     */
+    void phonemeFocusMode();
+
+    /**
+     * @brief Test that a multi-course source interleaves courses and only opens courses when reached
+     */
+    void multiCourseSource();
+
+    /**
+     * @brief Test that phoneme statistics of a multi-course session are loaded and stored
+     */
+    void sourceSessionProgress();
+
+    /**
+     * @brief Test that review states of courses with equal phrase identifiers are kept apart
+     */
+    void sharedPhraseIdsAcrossCourses();
+
+    /**
+     * @brief Test that a new session over the same course resumes position and attempt counters
+     */
+    void resumeSession();
 };
 
 #endif
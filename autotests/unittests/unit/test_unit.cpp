@@ -105,4 +105,41 @@ void TestUnit::addAndRemovePhrases()
     }
 }
 
+void TestUnit::phraseLookup()
+{
+    auto unit = Unit::create();
+    QVector<std::shared_ptr<Phrase>> phrases;
+    for (int i = 0; i < 5; ++i) {
+        auto phrase = Phrase::create();
+        phrase->setId("phrase" + QString::number(i));
+        phrases.append(phrase);
+        unit->addPhrase(phrase, unit->phraseCount());
+    }
+    QCOMPARE(unit->phraseCount(), 5);
+    QCOMPARE(unit->phraseRange().count(), 5);
+    QCOMPARE(unit->phraseRange().at(3).get(), phrases.at(3).get());
+    QCOMPARE(unit->indexOf(phrases.at(4).get()), 4);
+    QCOMPARE(unit->findPhrase("phrase2").get(), phrases.at(2).get());
+    QVERIFY(unit->findPhrase("unknown") == nullptr);
+
+    // insertion at the front shifts all positions
+    auto front = Phrase::create();
+    front->setId("front");
+    unit->addPhrase(front, 0);
+    QCOMPARE(unit->indexOf(front.get()), 0);
+    QCOMPARE(unit->indexOf(phrases.at(4).get()), 5);
+
+    // removal keeps the order of the remaining phrases
+    unit->removePhrase(phrases.at(1));
+    QCOMPARE(unit->indexOf(phrases.at(1).get()), -1);
+    QVERIFY(unit->findPhrase("phrase1") == nullptr);
+    QCOMPARE(unit->indexOf(phrases.at(2).get()), 2);
+    QCOMPARE(unit->phraseRange().at(2).get(), phrases.at(2).get());
+
+    // id changes are reflected by lookups
+    phrases.at(3)->setId("renamed");
+    QVERIFY(unit->findPhrase("phrase3") == nullptr);
+    QCOMPARE(unit->findPhrase("renamed").get(), phrases.at(3).get());
+}
+
 QTEST_GUILESS_MAIN(TestUnit)
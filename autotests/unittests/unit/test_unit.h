@@ -38,6 +38,11 @@ private slots:
      * @brief Test of phrase add/remove operations
      */
     void addAndRemovePhrases();
+
+    /**
+     * @brief Test phrase lookup by id and pointer after insertions, removals and id changes
+     */
+    void phraseLookup();
 };
 
 #endif
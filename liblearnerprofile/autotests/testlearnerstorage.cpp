@@ -9,6 +9,8 @@
 #include "learninggoal.h"
 #include "storage.h"
 
+#include <QSqlDatabase>
+#include <QSqlQuery>
 #include <QTest>
 
 using namespace LearnerProfile;
@@ -102,4 +104,120 @@ void TestLearnerStorage::testProgressValueStorage()
     QCOMPARE(data.find("itemB").value(), 1);
 }
 
+void TestLearnerStorage::testReviewStateStorage()
+{
+    LearningGoal tmpGoal(LearningGoal::Language, QStringLiteral("testgoalid"), nullptr);
+    tmpGoal.setName(QStringLiteral("testgoalname"));
+
+    Learner tmpLearner;
+    tmpLearner.addGoal(&tmpGoal);
+    tmpLearner.setName(QStringLiteral("tester"));
+
+    QVERIFY(m_storage->storeGoal(&tmpGoal));
+    QVERIFY(m_storage->storeProfile(&tmpLearner));
+
+    const QDateTime due {QDateTime::fromString(QStringLiteral("2026-01-02T10:00:00"), Qt::ISODate)};
+    ReviewState state;
+    state.repetitions = 2;
+    state.interval = 6;
+    state.easiness = 2.36;
+    state.due = due;
+
+    // insert
+    QVERIFY(m_storage->storeReviewState(&tmpLearner, &tmpGoal, "container", "itemA", state));
+    QVERIFY(m_storage->storeReviewState(&tmpLearner, &tmpGoal, "container", "itemB", ReviewState()));
+    auto states = m_storage->readReviewStates(&tmpLearner, &tmpGoal, QStringLiteral("container"));
+    QCOMPARE(states.size(), 2);
+    QCOMPARE(states.value("itemA"), state);
+    QVERIFY(!states.value("itemB").due.isValid());
+
+    // update replaces existing row
+    state.repetitions = 3;
+    state.interval = 15;
+    QVERIFY(m_storage->storeReviewState(&tmpLearner, &tmpGoal, "container", "itemA", state));
+    states = m_storage->readReviewStates(&tmpLearner, &tmpGoal, QStringLiteral("container"));
+    QCOMPARE(states.size(), 2);
+    QCOMPARE(states.value("itemA").repetitions, 3);
+    QCOMPARE(states.value("itemA").interval, 15);
+}
+
+void TestLearnerStorage::testSessionSnapshotStorage()
+{
+    LearningGoal tmpGoal(LearningGoal::Language, QStringLiteral("testgoalid"), nullptr);
+    tmpGoal.setName(QStringLiteral("testgoalname"));
+
+    Learner tmpLearner;
+    tmpLearner.addGoal(&tmpGoal);
+    tmpLearner.setName(QStringLiteral("tester"));
+
+    QVERIFY(m_storage->storeGoal(&tmpGoal));
+    QVERIFY(m_storage->storeProfile(&tmpLearner));
+    QVERIFY(m_storage->readSessionSnapshot(&tmpLearner, &tmpGoal, QStringLiteral("container")).isEmpty());
+
+    SessionSnapshot::Item itemA;
+    itemA.failedTries = 2;
+    SessionSnapshot::Item itemB;
+    itemB.acceptedTries = 1;
+    QVERIFY(m_storage->storeSessionItem(&tmpLearner, &tmpGoal, "container", "itemA", itemA));
+    QVERIFY(m_storage->storeSessionItem(&tmpLearner, &tmpGoal, "container", "itemB", itemB));
+    QVERIFY(m_storage->storeSessionPosition(&tmpLearner, &tmpGoal, "container", "itemA"));
+    QVERIFY(m_storage->storeSessionPosition(&tmpLearner, &tmpGoal, "container", "itemB"));
+
+    // position and counters are replaced, not appended
+    itemA.failedTries = 0;
+    itemA.acceptedTries = 3;
+    QVERIFY(m_storage->storeSessionItem(&tmpLearner, &tmpGoal, "container", "itemA", itemA));
+    auto snapshot = m_storage->readSessionSnapshot(&tmpLearner, &tmpGoal, QStringLiteral("container"));
+    QCOMPARE(snapshot.activeItem, QStringLiteral("itemB"));
+    QCOMPARE(snapshot.items.size(), 2);
+    QCOMPARE(snapshot.items.value("itemA"), itemA);
+    QCOMPARE(snapshot.items.value("itemB"), itemB);
+
+    // other containers are not affected by removal
+    QVERIFY(m_storage->storeSessionPosition(&tmpLearner, &tmpGoal, "other", "itemC"));
+    QVERIFY(m_storage->removeSessionSnapshot(&tmpLearner, &tmpGoal, QStringLiteral("container")));
+    QVERIFY(m_storage->readSessionSnapshot(&tmpLearner, &tmpGoal, QStringLiteral("container")).isEmpty());
+    QCOMPARE(m_storage->readSessionSnapshot(&tmpLearner, &tmpGoal, QStringLiteral("other")).activeItem, QStringLiteral("itemC"));
+}
+
+void TestLearnerStorage::testTransactionStorage()
+{
+    LearningGoal tmpGoal(LearningGoal::Language, QStringLiteral("testgoalid"), nullptr);
+    tmpGoal.setName(QStringLiteral("testgoalname"));
+
+    Learner tmpLearner;
+    tmpLearner.addGoal(&tmpGoal);
+    tmpLearner.setName(QStringLiteral("tester"));
+
+    QVERIFY(m_storage->storeGoal(&tmpGoal));
+    QVERIFY(m_storage->storeProfile(&tmpLearner));
+
+    // values as seen by another connection to the same database
+    const QString connection = QStringLiteral("reader");
+    auto committedValues = [this, &connection]() {
+        QSqlDatabase db = QSqlDatabase::contains(connection) ? QSqlDatabase::database(connection) : QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), connection);
+        db.setDatabaseName(m_db.fileName());
+        if (!db.isOpen() && !db.open()) {
+            return -1;
+        }
+        QSqlQuery query(db);
+        query.exec(QStringLiteral("SELECT COUNT(*) FROM learner_progress_value WHERE item_container = 'transaction'"));
+        return query.next() ? query.value(0).toInt() : -1;
+    };
+
+    // only the outermost pair commits
+    QVERIFY(m_storage->beginTransaction());
+    QVERIFY(m_storage->beginTransaction());
+    QVERIFY(m_storage->storeProgressValue(&tmpLearner, &tmpGoal, "transaction", "itemA", 1));
+    QVERIFY(m_storage->commitTransaction());
+    QVERIFY(m_storage->storeProgressValue(&tmpLearner, &tmpGoal, "transaction", "itemB", 1));
+    QCOMPARE(m_storage->readProgressValues(&tmpLearner, &tmpGoal, QStringLiteral("transaction")).size(), 2);
+    QCOMPARE(committedValues(), 0);
+    QVERIFY(m_storage->commitTransaction());
+    QCOMPARE(committedValues(), 2);
+
+    QSqlDatabase::database(connection).close();
+    QSqlDatabase::removeDatabase(connection);
+}
+
 QTEST_GUILESS_MAIN(TestLearnerStorage)
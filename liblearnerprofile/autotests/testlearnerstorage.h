@@ -37,6 +37,9 @@ private Q_SLOTS:
     void testLearnerStorage();
     void testProgressLogStorage();
     void testProgressValueStorage();
+    void testReviewStateStorage();
+    void testSessionSnapshotStorage();
+    void testTransactionStorage();
 
 private:
     QScopedPointer<LearnerProfile::Storage> m_storage;
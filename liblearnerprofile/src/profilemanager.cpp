@@ -248,6 +248,15 @@ void ProfileManager::recordProgress(Learner *learner, LearningGoal *goal, const
     d->m_storage.storeProgressValue(learner, goal, container, item, valuePayload);
 }
 
+void ProfileManager::recordProgressValue(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, int valuePayload)
+{
+    if (!learner || !goal) {
+        qCDebug(LIBLEARNER_LOG()) << "No learner or goal set, no data stored";
+        return;
+    }
+    d->m_storage.storeProgressValue(learner, goal, container, item, valuePayload);
+}
+
 QHash<QString, int> ProfileManager::progressValues(Learner *learner, LearningGoal *goal, const QString &container) const
 {
     if (!learner || !goal) {
@@ -256,6 +265,67 @@ QHash<QString, int> ProfileManager::progressValues(Learner *learner, LearningGoa
     return d->m_storage.readProgressValues(learner, goal, container);
 }
 
+void ProfileManager::recordReviewState(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const ReviewState &state)
+{
+    if (!learner || !goal) {
+        qCDebug(LIBLEARNER_LOG()) << "No learner or goal set, no review state stored";
+        return;
+    }
+    d->m_storage.storeReviewState(learner, goal, container, item, state);
+}
+
+QHash<QString, ReviewState> ProfileManager::reviewStates(Learner *learner, LearningGoal *goal, const QString &container) const
+{
+    if (!learner || !goal) {
+        return QHash<QString, ReviewState>();
+    }
+    return d->m_storage.readReviewStates(learner, goal, container);
+}
+
+void ProfileManager::recordSessionPosition(Learner *learner, LearningGoal *goal, const QString &container, const QString &activeItem)
+{
+    if (!learner || !goal) {
+        qCDebug(LIBLEARNER_LOG()) << "No learner or goal set, no session position stored";
+        return;
+    }
+    d->m_storage.storeSessionPosition(learner, goal, container, activeItem);
+}
+
+void ProfileManager::recordSessionItem(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const SessionSnapshot::Item &state)
+{
+    if (!learner || !goal) {
+        qCDebug(LIBLEARNER_LOG()) << "No learner or goal set, no session item stored";
+        return;
+    }
+    d->m_storage.storeSessionItem(learner, goal, container, item, state);
+}
+
+SessionSnapshot ProfileManager::sessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container) const
+{
+    if (!learner || !goal) {
+        return SessionSnapshot();
+    }
+    return d->m_storage.readSessionSnapshot(learner, goal, container);
+}
+
+void ProfileManager::clearSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container)
+{
+    if (!learner || !goal) {
+        return;
+    }
+    d->m_storage.removeSessionSnapshot(learner, goal, container);
+}
+
+void ProfileManager::beginTransaction()
+{
+    d->m_storage.beginTransaction();
+}
+
+void ProfileManager::commitTransaction()
+{
+    d->m_storage.commitTransaction();
+}
+
 void ProfileManager::sync()
 {
     d->sync();
@@ -9,6 +9,8 @@
 
 #include "learninggoal.h"
 #include "liblearnerprofile_export.h"
+#include "reviewstate.h"
+#include "sessionsnapshot.h"
 #include <QObject>
 
 namespace LearnerProfile
@@ -50,10 +52,44 @@ public:
      * stores log data for this activity
      */
     void recordProgress(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, int logPayload, int valuePayload);
+    /**
+     * updates progress value of \p item without writing a log entry
+     */
+    void recordProgressValue(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, int valuePayload);
     /**
      * \return progress value, or -1 if value is not available yet
      */
     QHash<QString, int> progressValues(Learner *learner, LearningGoal *goal, const QString &container) const;
+    /**
+     * stores spaced repetition state of \p item, only this single item is written
+     */
+    void recordReviewState(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const ReviewState &state);
+    /**
+     * \return spaced repetition states of all reviewed items in \p container
+     */
+    QHash<QString, ReviewState> reviewStates(Learner *learner, LearningGoal *goal, const QString &container) const;
+    /**
+     * stores the active item of the training session over \p container
+     */
+    void recordSessionPosition(Learner *learner, LearningGoal *goal, const QString &container, const QString &activeItem);
+    /**
+     * stores attempt counters of \p item of the training session over \p container
+     */
+    void recordSessionItem(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const SessionSnapshot::Item &state);
+    /**
+     * \return snapshot of the last training session over \p container, empty if there is none
+     */
+    SessionSnapshot sessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container) const;
+    /**
+     * removes the session snapshot of \p container, e.g. after the session was completed
+     */
+    void clearSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container);
+    /**
+     * writes all following record and clear operations in a single database transaction, which is
+     * committed by commitTransaction(); pairs can be nested
+     */
+    void beginTransaction();
+    void commitTransaction();
     /**
      * write all profiles to database
      */
@@ -0,0 +1,35 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef REVIEWSTATE_H
+#define REVIEWSTATE_H
+
+#include <QDateTime>
+#include <QMetaType>
+
+namespace LearnerProfile
+{
+/**
+ * \class ReviewState
+ * Spaced repetition state of a single training item, as used by SM-2 style schedulers.
+ * An invalid \c due date marks an item that was never reviewed.
+ */
+struct ReviewState {
+    int repetitions {0};   //!< number of successful reviews in a row
+    int interval {0};      //!< current review interval in days
+    double easiness {2.5}; //!< SM-2 easiness factor
+    QDateTime due;         //!< next time the item shall be reviewed
+
+    bool operator==(const ReviewState &other) const
+    {
+        return repetitions == other.repetitions && interval == other.interval && qFuzzyCompare(easiness, other.easiness) && due == other.due;
+    }
+};
+}
+
+Q_DECLARE_METATYPE(LearnerProfile::ReviewState)
+
+#endif // REVIEWSTATE_H
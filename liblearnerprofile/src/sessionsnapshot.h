@@ -0,0 +1,43 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef SESSIONSNAPSHOT_H
+#define SESSIONSNAPSHOT_H
+
+#include <QHash>
+#include <QMetaType>
+#include <QString>
+
+namespace LearnerProfile
+{
+/**
+ * \class SessionSnapshot
+ * Resumable state of a training session over a single item container.
+ * Spaced repetition states are not part of the snapshot, they are stored per item anyway.
+ */
+struct SessionSnapshot {
+    struct Item {
+        int failedTries {0};   //!< failed attempts since the item was last accepted
+        int acceptedTries {0}; //!< attempts needed when the item was last accepted, 0 if never accepted
+
+        bool operator==(const Item &other) const
+        {
+            return failedTries == other.failedTries && acceptedTries == other.acceptedTries;
+        }
+    };
+    QString activeItem; //!< item presented when the session was left, empty if unknown
+    QHash<QString, Item> items;
+
+    bool isEmpty() const
+    {
+        return activeItem.isEmpty() && items.isEmpty();
+    }
+};
+}
+
+Q_DECLARE_METATYPE(LearnerProfile::SessionSnapshot)
+
+#endif // SESSIONSNAPSHOT_H
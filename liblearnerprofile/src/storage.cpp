@@ -508,6 +508,223 @@ int Storage::readProgressValue(Learner *learner, LearningGoal *goal, const QStri
     return -1;
 }
 
+bool Storage::storeReviewState(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const ReviewState &state)
+{
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    // unique constraint on the item key lets a single statement cover insert and update
+    query.prepare(
+        "INSERT OR REPLACE INTO learner_review_state "
+        "(goal_category, goal_identifier, profile_id, item_container, item, repetitions, interval, easiness, due) "
+        "VALUES (:gcategory, :gidentifier, :pid, :container, :item, :repetitions, :interval, :easiness, :due)");
+    query.bindValue(QStringLiteral(":gcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":gidentifier"), goal->identifier());
+    query.bindValue(QStringLiteral(":pid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.bindValue(QStringLiteral(":item"), item);
+    query.bindValue(QStringLiteral(":repetitions"), state.repetitions);
+    query.bindValue(QStringLiteral(":interval"), state.interval);
+    query.bindValue(QStringLiteral(":easiness"), state.easiness);
+    query.bindValue(QStringLiteral(":due"), state.due.toString(Qt::ISODate));
+    query.exec();
+
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return false;
+    }
+    return true;
+}
+
+QHash<QString, ReviewState> Storage::readReviewStates(Learner *learner, LearningGoal *goal, const QString &container)
+{
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    query.prepare(
+        "SELECT item, repetitions, interval, easiness, due FROM learner_review_state "
+        "WHERE goal_category = :goalcategory "
+        "AND goal_identifier = :goalid "
+        "AND profile_id = :profileid "
+        "AND item_container = :container");
+    query.bindValue(QStringLiteral(":goalcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":goalid"), goal->identifier());
+    query.bindValue(QStringLiteral(":profileid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.exec();
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return QHash<QString, ReviewState>();
+    }
+
+    QHash<QString, ReviewState> states;
+    while (query.next()) {
+        ReviewState state;
+        state.repetitions = query.value(1).toInt();
+        state.interval = query.value(2).toInt();
+        state.easiness = query.value(3).toDouble();
+        state.due = QDateTime::fromString(query.value(4).toString(), Qt::ISODate);
+        states.insert(query.value(0).toString(), state);
+    }
+    return states;
+}
+
+bool Storage::storeSessionPosition(Learner *learner, LearningGoal *goal, const QString &container, const QString &activeItem)
+{
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    query.prepare(
+        "INSERT OR REPLACE INTO learner_session "
+        "(goal_category, goal_identifier, profile_id, item_container, active_item, date) "
+        "VALUES (:gcategory, :gidentifier, :pid, :container, :item, :date)");
+    query.bindValue(QStringLiteral(":gcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":gidentifier"), goal->identifier());
+    query.bindValue(QStringLiteral(":pid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.bindValue(QStringLiteral(":item"), activeItem);
+    query.bindValue(QStringLiteral(":date"), QDateTime::currentDateTime().toString(Qt::ISODate));
+    query.exec();
+
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return false;
+    }
+    return true;
+}
+
+bool Storage::storeSessionItem(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const SessionSnapshot::Item &state)
+{
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    query.prepare(
+        "INSERT OR REPLACE INTO learner_session_item "
+        "(goal_category, goal_identifier, profile_id, item_container, item, failed_tries, accepted_tries) "
+        "VALUES (:gcategory, :gidentifier, :pid, :container, :item, :failed, :accepted)");
+    query.bindValue(QStringLiteral(":gcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":gidentifier"), goal->identifier());
+    query.bindValue(QStringLiteral(":pid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.bindValue(QStringLiteral(":item"), item);
+    query.bindValue(QStringLiteral(":failed"), state.failedTries);
+    query.bindValue(QStringLiteral(":accepted"), state.acceptedTries);
+    query.exec();
+
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return false;
+    }
+    return true;
+}
+
+SessionSnapshot Storage::readSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container)
+{
+    SessionSnapshot snapshot;
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    query.prepare(
+        "SELECT active_item FROM learner_session "
+        "WHERE goal_category = :goalcategory "
+        "AND goal_identifier = :goalid "
+        "AND profile_id = :profileid "
+        "AND item_container = :container");
+    query.bindValue(QStringLiteral(":goalcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":goalid"), goal->identifier());
+    query.bindValue(QStringLiteral(":profileid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.exec();
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return snapshot;
+    }
+    if (query.next()) {
+        snapshot.activeItem = query.value(0).toString();
+    }
+
+    query.prepare(
+        "SELECT item, failed_tries, accepted_tries FROM learner_session_item "
+        "WHERE goal_category = :goalcategory "
+        "AND goal_identifier = :goalid "
+        "AND profile_id = :profileid "
+        "AND item_container = :container");
+    query.bindValue(QStringLiteral(":goalcategory"), static_cast<int>(goal->category()));
+    query.bindValue(QStringLiteral(":goalid"), goal->identifier());
+    query.bindValue(QStringLiteral(":profileid"), learner->identifier());
+    query.bindValue(QStringLiteral(":container"), container);
+    query.exec();
+    if (query.lastError().isValid()) {
+        qCritical() << query.lastError().text();
+        raiseError(query.lastError());
+        return snapshot;
+    }
+    while (query.next()) {
+        SessionSnapshot::Item item;
+        item.failedTries = query.value(1).toInt();
+        item.acceptedTries = query.value(2).toInt();
+        snapshot.items.insert(query.value(0).toString(), item);
+    }
+    return snapshot;
+}
+
+bool Storage::removeSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container)
+{
+    QSqlDatabase db = database();
+    QSqlQuery query(db);
+    for (const QString &table : {QStringLiteral("learner_session"), QStringLiteral("learner_session_item")}) {
+        query.prepare(
+            QStringLiteral("DELETE FROM %1 "
+                           "WHERE goal_category = :goalcategory "
+                           "AND goal_identifier = :goalid "
+                           "AND profile_id = :profileid "
+                           "AND item_container = :container")
+                .arg(table));
+        query.bindValue(QStringLiteral(":goalcategory"), static_cast<int>(goal->category()));
+        query.bindValue(QStringLiteral(":goalid"), goal->identifier());
+        query.bindValue(QStringLiteral(":profileid"), learner->identifier());
+        query.bindValue(QStringLiteral(":container"), container);
+        query.exec();
+        if (query.lastError().isValid()) {
+            qCritical() << query.lastError().text();
+            raiseError(query.lastError());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Storage::beginTransaction()
+{
+    if (m_transactionDepth++ > 0) {
+        return true;
+    }
+    QSqlDatabase db = database();
+    if (!db.transaction()) {
+        qCWarning(LIBLEARNER_LOG) << db.lastError().text();
+        raiseError(db.lastError());
+        return false;
+    }
+    return true;
+}
+
+bool Storage::commitTransaction()
+{
+    Q_ASSERT(m_transactionDepth > 0);
+    if (m_transactionDepth <= 0 || --m_transactionDepth > 0) {
+        return true;
+    }
+    QSqlDatabase db = database();
+    // a failed store operation already rolled back the transaction
+    if (!db.commit()) {
+        qCWarning(LIBLEARNER_LOG) << db.lastError().text();
+        raiseError(db.lastError());
+        db.rollback();
+        return false;
+    }
+    return true;
+}
+
 QSqlDatabase Storage::database()
 {
     if (QSqlDatabase::contains(QSqlDatabase::defaultConnection)) {
@@ -662,5 +879,61 @@ bool Storage::updateSchema()
         return false;
     }
 
+    // table for spaced repetition state, one row per item
+    db.exec(
+        "CREATE TABLE IF NOT EXISTS learner_review_state ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT, "
+        "goal_category INTEGER, " // LearningGoal::Category
+        "goal_identifier TEXT, "  // LearningGoal::Identifier
+        "profile_id INTEGER, "    // Learner::Identifier
+        "item_container TEXT, "
+        "item TEXT, "
+        "repetitions INTEGER, "
+        "interval INTEGER, " // days
+        "easiness REAL, "
+        "due TEXT, "
+        "UNIQUE (goal_category, goal_identifier, profile_id, item_container, item)"
+        ")");
+    if (db.lastError().isValid()) {
+        qCritical() << db.lastError().text();
+        raiseError(db.lastError());
+        return false;
+    }
+
+    // tables for resumable training sessions, one position per container and counters per item
+    db.exec(
+        "CREATE TABLE IF NOT EXISTS learner_session ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT, "
+        "goal_category INTEGER, " // LearningGoal::Category
+        "goal_identifier TEXT, "  // LearningGoal::Identifier
+        "profile_id INTEGER, "    // Learner::Identifier
+        "item_container TEXT, "
+        "active_item TEXT, "
+        "date TEXT, "
+        "UNIQUE (goal_category, goal_identifier, profile_id, item_container)"
+        ")");
+    if (db.lastError().isValid()) {
+        qCritical() << db.lastError().text();
+        raiseError(db.lastError());
+        return false;
+    }
+    db.exec(
+        "CREATE TABLE IF NOT EXISTS learner_session_item ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT, "
+        "goal_category INTEGER, " // LearningGoal::Category
+        "goal_identifier TEXT, "  // LearningGoal::Identifier
+        "profile_id INTEGER, "    // Learner::Identifier
+        "item_container TEXT, "
+        "item TEXT, "
+        "failed_tries INTEGER, "
+        "accepted_tries INTEGER, "
+        "UNIQUE (goal_category, goal_identifier, profile_id, item_container, item)"
+        ")");
+    if (db.lastError().isValid()) {
+        qCritical() << db.lastError().text();
+        raiseError(db.lastError());
+        return false;
+    }
+
     return true;
 }
@@ -7,6 +7,8 @@
 #ifndef STORAGE_H
 #define STORAGE_H
 
+#include "reviewstate.h"
+#include "sessionsnapshot.h"
 #include <QObject>
 
 class QSqlError;
@@ -64,6 +66,38 @@ public:
      * Load payload value of specified item. If no value is found, \return -1
      */
     int readProgressValue(Learner *learner, LearningGoal *goal, const QString &container, const QString &item);
+    /**
+     * Store spaced repetition state of a single item, replacing any previously stored state.
+     */
+    bool storeReviewState(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const ReviewState &state);
+    /**
+     * Load spaced repetition states for specified container
+     * \return item/state values for all reviewed items in container
+     */
+    QHash<QString, ReviewState> readReviewStates(Learner *learner, LearningGoal *goal, const QString &container);
+    /**
+     * Store the item that is active in the training session of specified container.
+     */
+    bool storeSessionPosition(Learner *learner, LearningGoal *goal, const QString &container, const QString &activeItem);
+    /**
+     * Store attempt counters of a single item of the training session of specified container.
+     */
+    bool storeSessionItem(Learner *learner, LearningGoal *goal, const QString &container, const QString &item, const SessionSnapshot::Item &state);
+    /**
+     * Load session snapshot for specified container
+     * \return empty snapshot if no session was stored
+     */
+    SessionSnapshot readSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container);
+    /**
+     * Remove position and all item counters of the session of specified container.
+     */
+    bool removeSessionSnapshot(Learner *learner, LearningGoal *goal, const QString &container);
+    /**
+     * Start a transaction that contains all following store operations until commitTransaction().
+     * Calls can be nested, only the outermost pair starts and commits the transaction.
+     */
+    bool beginTransaction();
+    bool commitTransaction();
 
 Q_SIGNALS:
     void errorMessageChanged();
@@ -76,6 +110,7 @@ private:
     bool updateSchema();
     const QString m_databasePath;
     QString m_errorMessage;
+    int m_transactionDepth {0};
 };
 }
 
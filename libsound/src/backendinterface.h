@@ -23,6 +23,10 @@ public:
     ~BackendInterface() override;
 
     QString name() const;
+    /**
+     * The capture and output backends are created on first call, which may happen in any thread.
+     * They are moved to the thread of this backend and are owned by it.
+     */
     virtual CaptureBackendInterface *captureBackend() const = 0;
     virtual OutputBackendInterface *outputBackend() const = 0;
 
@@ -0,0 +1,118 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "backendregistry.h"
+#include "backendinterface.h"
+#include "libsound_debug.h"
+
+#include <QCoreApplication>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <KPluginFactory>
+#include <KPluginLoader>
+
+BackendRegistry::BackendRegistry()
+    : m_preferredBackend(qEnvironmentVariable("ARTIKULATE_SOUND_BACKEND"))
+{
+}
+
+BackendRegistry::~BackendRegistry()
+{
+    delete m_backend;
+    m_backend = nullptr;
+}
+
+BackendRegistry &BackendRegistry::self()
+{
+    static BackendRegistry instance;
+    return instance;
+}
+
+void BackendRegistry::discover() const
+{
+    // must be called with locked mutex
+    if (m_discovered) {
+        return;
+    }
+    m_metaData = KPluginLoader::findPlugins(QStringLiteral("artikulate/libsound"));
+    m_discovered = true;
+    for (const auto &metadata : qAsConst(m_metaData)) {
+        qCDebug(LIBSOUND_LOG) << "Found sound backend plugin:" << metadata.pluginId();
+    }
+}
+
+QVector<KPluginMetaData> BackendRegistry::availableBackends() const
+{
+    QMutexLocker locker(&m_mutex);
+    discover();
+    return m_metaData;
+}
+
+void BackendRegistry::setPreferredBackend(const QString &pluginId)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_loadAttempted) {
+        qCWarning(LIBSOUND_LOG) << "Sound backend already loaded, ignoring selection of" << pluginId;
+        return;
+    }
+    m_preferredBackend = pluginId;
+}
+
+QString BackendRegistry::preferredBackend() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_preferredBackend;
+}
+
+BackendInterface *BackendRegistry::backend()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_loadAttempted) {
+        return m_backend;
+    }
+    m_loadAttempted = true;
+    discover();
+
+    // the preferred backend is tried first, all others serve as fallback
+    // backends for testing are only used when selected explicitly
+    QVector<KPluginMetaData> candidates;
+    for (const auto &metadata : qAsConst(m_metaData)) {
+        if (metadata.pluginId() == m_preferredBackend) {
+            candidates.prepend(metadata);
+        } else if (!metadata.rawData().value(QStringLiteral("X-Artikulate-TestingOnly")).toBool()) {
+            candidates.append(metadata);
+        }
+    }
+    for (const auto &metadata : qAsConst(candidates)) {
+        qCDebug(LIBSOUND_LOG) << "Load Plugin: " << metadata.name();
+        KPluginFactory *factory = KPluginLoader(metadata.fileName()).factory();
+        if (!factory) {
+            qCCritical(LIBSOUND_LOG) << "Could not load plugin:" << metadata.name();
+            continue;
+        }
+        m_backend = factory->create<BackendInterface>(nullptr, QList<QVariant>());
+        if (m_backend) {
+            break;
+        }
+    }
+    if (!m_backend) {
+        qCCritical(LIBSOUND_LOG) << "No sound backend available";
+        return nullptr;
+    }
+    // backend objects live in the main thread, independent of the thread that used them first
+    if (QCoreApplication::instance() && m_backend->thread() != QCoreApplication::instance()->thread()) {
+        m_backend->moveToThread(QCoreApplication::instance()->thread());
+    }
+    return m_backend;
+}
+
+bool BackendRegistry::isBackendLoaded() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_backend != nullptr;
+}
@@ -0,0 +1,69 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef BACKENDREGISTRY_H
+#define BACKENDREGISTRY_H
+
+#include "libsound_export.h"
+#include <KPluginMetaData>
+#include <QMutex>
+#include <QVector>
+
+class BackendInterface;
+
+/**
+ * \class BackendRegistry
+ *
+ * This singleton class discovers the sound backend plugins and provides the selected backend to
+ * \see CaptureDeviceController and \see OutputDeviceController. Discovery only reads the plugin
+ * metadata; the selected plugin is loaded and instantiated on first call of backend().
+ * All methods are thread safe.
+ */
+class LIBSOUND_EXPORT BackendRegistry
+{
+public:
+    static BackendRegistry &self();
+
+    /**
+     * \return metadata of all installed backend plugins
+     */
+    QVector<KPluginMetaData> availableBackends() const;
+
+    /**
+     * Select the backend plugin with id \p pluginId. If not set, the environment variable
+     * ARTIKULATE_SOUND_BACKEND is used and otherwise the first available backend. Backends that
+     * are marked with X-Artikulate-TestingOnly in their metadata are only used if selected.
+     * The selection has no effect once the backend is loaded.
+     */
+    void setPreferredBackend(const QString &pluginId);
+    QString preferredBackend() const;
+
+    /**
+     * Load and instantiate the selected backend if not done yet.
+     * \return the backend or nullptr if no backend could be loaded
+     */
+    BackendInterface *backend();
+
+    /**
+     * \return true if a backend plugin was instantiated
+     */
+    bool isBackendLoaded() const;
+
+private:
+    Q_DISABLE_COPY(BackendRegistry)
+    BackendRegistry();
+    ~BackendRegistry();
+    void discover() const;
+
+    mutable QMutex m_mutex;
+    mutable bool m_discovered {false};
+    mutable QVector<KPluginMetaData> m_metaData;
+    QString m_preferredBackend;
+    BackendInterface *m_backend {nullptr};
+    bool m_loadAttempted {false};
+};
+
+#endif
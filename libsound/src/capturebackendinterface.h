@@ -8,6 +8,7 @@
 #define CAPTUREBACKENDINTERFACE_H
 
 #include "capturedevicecontroller.h"
+#include "captureprofile.h"
 #include "libsound_export.h"
 #include <QObject>
 
@@ -23,6 +24,13 @@ public:
     virtual void stopCapture() = 0;
     virtual CaptureDeviceController::State captureState() const = 0;
 
+    /**
+     * Set format and encoder settings for subsequent recordings.
+     * \return false if the backend cannot record with \p profile, the previous profile stays active then
+     */
+    virtual bool setProfile(const CaptureProfile &profile) = 0;
+    virtual CaptureProfile profile() const = 0;
+
     virtual QStringList devices() const = 0;
     virtual void setDevice(const QString &deviceIdentifier) = 0;
 };
@@ -6,25 +6,21 @@
 
 #include "capturedevicecontroller.h"
 #include "backendinterface.h"
+#include "backendregistry.h"
 #include "capturebackendinterface.h"
 #include "libsound_debug.h"
 
-#include <QCoreApplication>
-#include <QPluginLoader>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QStringList>
 
-#include <KPluginFactory>
-#include <KPluginLoader>
-#include <KPluginMetaData>
-
 /**
  * \class CaptureDeviceControllerPrivate
  * \internal
  *
  * This is the private data class for \see CaptureDeviceController.
- * Note that -- even if the CaptureDeviceController is constructed before its first call -- all
- * devices get only configured by first instantiation of CaptureDeviceController with a call
- * to CaptureDeviceControllerPrivate::lazyInit(), called in CaptureDeviceController::self().
+ * The capture backend is obtained from \see BackendRegistry on first use, such that no plugin
+ * is loaded and no capture pipeline is created before the first recording.
  */
 class CaptureDeviceControllerPrivate
 {
@@ -32,52 +28,23 @@ public:
     CaptureDeviceControllerPrivate(QObject *parent)
         : m_parent(parent)
         , m_backend(nullptr)
-        , m_initialized(false)
-    {
-        // load plugins
-        const QVector<KPluginMetaData> metadataList = KPluginLoader::findPlugins(QStringLiteral("artikulate/libsound"));
-        for (const auto &metadata : metadataList) {
-            qCDebug(LIBSOUND_LOG) << "Load Plugin: " << metadata.name();
-            KPluginFactory *factory = KPluginLoader(metadata.fileName()).factory();
-            if (!factory) {
-                qCCritical(LIBSOUND_LOG) << "Could not load plugin: " << metadata.name();
-                continue;
-            }
-            BackendInterface *plugin = factory->create<BackendInterface>(parent, QList<QVariant>());
-            if (plugin->captureBackend()) {
-                m_backendList.append(plugin->captureBackend());
-            }
-        }
-        if (!m_backend && !m_backendList.isEmpty()) {
-            m_backend = m_backendList.first();
-        }
-    }
-
-    ~CaptureDeviceControllerPrivate()
     {
-        delete m_backend;
-        m_backend = nullptr;
-    }
-
-    void lazyInit()
-    {
-        if (m_initialized) {
-            return;
-        }
-        // TODO currently nothing to do
-        m_initialized = true;
     }
 
     CaptureBackendInterface *backend() const
     {
+        QMutexLocker locker(&m_mutex);
+        if (!m_backend) {
+            BackendInterface *plugin = BackendRegistry::self().backend();
+            m_backend = plugin ? plugin->captureBackend() : nullptr;
+        }
         Q_ASSERT(m_backend);
         return m_backend;
     }
 
     QObject *m_parent;
-    CaptureBackendInterface *m_backend;
-    QList<CaptureBackendInterface *> m_backendList;
-    bool m_initialized;
+    mutable QMutex m_mutex;
+    mutable CaptureBackendInterface *m_backend;
 };
 
 CaptureDeviceController::CaptureDeviceController()
@@ -92,7 +59,6 @@ CaptureDeviceController::~CaptureDeviceController()
 CaptureDeviceController &CaptureDeviceController::self()
 {
     static CaptureDeviceController instance;
-    instance.d->lazyInit();
     return instance;
 }
 
@@ -113,6 +79,24 @@ void CaptureDeviceController::setDevice(const QString &deviceIdentifier)
     d->backend()->setDevice(deviceIdentifier);
 }
 
+bool CaptureDeviceController::setProfile(const CaptureProfile &profile)
+{
+    if (d->backend()->profile() == profile) {
+        return true;
+    }
+    if (d->backend()->setProfile(profile)) {
+        return true;
+    }
+    qCWarning(LIBSOUND_LOG) << "Capture backend does not support" << profile << ", falling back to archive profile";
+    d->backend()->setProfile(CaptureProfile::archiveProfile());
+    return false;
+}
+
+CaptureProfile CaptureDeviceController::profile() const
+{
+    return d->backend()->profile();
+}
+
 QList<QString> CaptureDeviceController::devices() const
 {
     return d->backend()->devices();
@@ -7,6 +7,7 @@
 #ifndef CAPTUREDEVICECONTROLLER_H
 #define CAPTUREDEVICECONTROLLER_H
 
+#include "captureprofile.h"
 #include "libsound_export.h"
 
 #include <QObject>
@@ -38,6 +39,19 @@ public:
     void stopCapture();
     void setDevice(const QString &deviceIdentifier);
 
+    /**
+     * Set format and encoder settings for subsequent recordings. If the backend does not support
+     * \p profile, the archive profile is used instead.
+     *
+     * \return true if \p profile is used
+     */
+    bool setProfile(const CaptureProfile &profile);
+
+    /**
+     * \return profile used for subsequent recordings
+     */
+    CaptureProfile profile() const;
+
     /**
      * \return list of available capture devices
      */
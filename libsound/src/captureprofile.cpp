@@ -0,0 +1,103 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "captureprofile.h"
+
+CaptureProfile::CaptureProfile()
+    : CaptureProfile(Vorbis, 44100, 1)
+{
+}
+
+CaptureProfile::CaptureProfile(Format format, int sampleRate, int channels)
+    : m_format(format)
+    , m_sampleRate(sampleRate)
+    , m_channels(channels)
+    , m_bitrate(24000)
+    , m_quality(0.6)
+{
+}
+
+CaptureProfile CaptureProfile::comparisonProfile()
+{
+    return CaptureProfile(RawPcm, 16000, 1);
+}
+
+CaptureProfile CaptureProfile::compactProfile()
+{
+    return CaptureProfile(Opus, 16000, 1);
+}
+
+CaptureProfile CaptureProfile::archiveProfile()
+{
+    return CaptureProfile();
+}
+
+CaptureProfile::Format CaptureProfile::format() const
+{
+    return m_format;
+}
+
+int CaptureProfile::sampleRate() const
+{
+    return m_sampleRate;
+}
+
+int CaptureProfile::channels() const
+{
+    return m_channels;
+}
+
+int CaptureProfile::bitrate() const
+{
+    return m_bitrate;
+}
+
+void CaptureProfile::setBitrate(int bitrate)
+{
+    m_bitrate = bitrate;
+}
+
+double CaptureProfile::quality() const
+{
+    return m_quality;
+}
+
+void CaptureProfile::setQuality(double quality)
+{
+    m_quality = qBound(0.0, quality, 1.0);
+}
+
+QString CaptureProfile::fileSuffix() const
+{
+    switch (m_format) {
+        case RawPcm:
+            return QStringLiteral("wav");
+        case Opus:
+            return QStringLiteral("opus");
+        case Vorbis:
+            return QStringLiteral("ogg");
+    }
+    Q_UNREACHABLE();
+    return QString();
+}
+
+bool CaptureProfile::operator==(const CaptureProfile &other) const
+{
+    return m_format == other.m_format && m_sampleRate == other.m_sampleRate && m_channels == other.m_channels && m_bitrate == other.m_bitrate
+        && qFuzzyCompare(m_quality, other.m_quality);
+}
+
+bool CaptureProfile::operator!=(const CaptureProfile &other) const
+{
+    return !(*this == other);
+}
+
+QDebug operator<<(QDebug debug, const CaptureProfile &profile)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "CaptureProfile(" << profile.fileSuffix() << ", " << profile.sampleRate() << " Hz, " << profile.channels() << " channels)";
+    return debug;
+}
@@ -0,0 +1,84 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef CAPTUREPROFILE_H
+#define CAPTUREPROFILE_H
+
+#include "libsound_export.h"
+#include <QDebug>
+#include <QString>
+
+/**
+ * \class CaptureProfile
+ *
+ * Format and encoder settings of a recording.
+ */
+class LIBSOUND_EXPORT CaptureProfile
+{
+public:
+    enum Format {
+        RawPcm, //!< uncompressed 16 bit PCM in a WAV container
+        Opus, //!< Opus in an Ogg container
+        Vorbis //!< Vorbis in an Ogg container
+    };
+
+    /**
+     * Creates the archive profile.
+     */
+    CaptureProfile();
+    CaptureProfile(Format format, int sampleRate, int channels);
+
+    /**
+     * Profile for recordings that are only kept temporarily, e.g. to compare them with the
+     * native speaker's recording: uncompressed 16 kHz mono, which needs no encoding at all.
+     */
+    static CaptureProfile comparisonProfile();
+
+    /**
+     * Profile for small recordings of acceptable quality: 24 kbit/s Opus, 16 kHz mono.
+     */
+    static CaptureProfile compactProfile();
+
+    /**
+     * Profile for recordings that are shipped with courses: high quality Vorbis, 44.1 kHz mono.
+     */
+    static CaptureProfile archiveProfile();
+
+    Format format() const;
+    int sampleRate() const;
+    int channels() const;
+
+    /**
+     * Target bitrate in bit/s, only used for Opus.
+     */
+    int bitrate() const;
+    void setBitrate(int bitrate);
+
+    /**
+     * VBR quality in the range [0, 1], only used for Vorbis.
+     */
+    double quality() const;
+    void setQuality(double quality);
+
+    /**
+     * \return file suffix without dot that matches the container format
+     */
+    QString fileSuffix() const;
+
+    bool operator==(const CaptureProfile &other) const;
+    bool operator!=(const CaptureProfile &other) const;
+
+private:
+    Format m_format;
+    int m_sampleRate;
+    int m_channels;
+    int m_bitrate;
+    double m_quality;
+};
+
+LIBSOUND_EXPORT QDebug operator<<(QDebug debug, const CaptureProfile &profile);
+
+#endif
@@ -0,0 +1,120 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "loudnessmeter.h"
+
+#include <QtMath>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+constexpr double absoluteGate = -70.0;
+constexpr double relativeGate = -10.0;
+
+double toLoudness(double meanSquare)
+{
+    return -0.691 + 10.0 * std::log10(meanSquare);
+}
+}
+
+LoudnessMeter::LoudnessMeter(int sampleRate, int channels)
+    : m_channels(channels)
+    , m_subBlockFrames(qMax(1, sampleRate / 10))
+    , m_shelvingState(channels)
+    , m_highPassState(channels)
+{
+    // K-weighting filter coefficients from BS.1770, derived for arbitrary sample rates
+    const double rate = sampleRate;
+    {
+        const double f0 = 1681.974450955533;
+        const double gain = 3.999843853973347;
+        const double q = 0.7071752369554196;
+        const double k = std::tan(M_PI * f0 / rate);
+        const double vh = std::pow(10.0, gain / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        const double a0 = 1.0 + k / q + k * k;
+        m_shelvingFilter = {(vh + vb * k / q + k * k) / a0, 2.0 * (k * k - vh) / a0, (vh - vb * k / q + k * k) / a0, 2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0};
+    }
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+        const double k = std::tan(M_PI * f0 / rate);
+        const double a0 = 1.0 + k / q + k * k;
+        m_highPassFilter = {1.0, -2.0, 1.0, 2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0};
+    }
+}
+
+double LoudnessMeter::process(const Biquad &filter, FilterState &state, double sample)
+{
+    const double result = filter.b0 * sample + filter.b1 * state.x1 + filter.b2 * state.x2 - filter.a1 * state.y1 - filter.a2 * state.y2;
+    state.x2 = state.x1;
+    state.x1 = sample;
+    state.y2 = state.y1;
+    state.y1 = result;
+    return result;
+}
+
+void LoudnessMeter::addFrames(const float *samples, qint64 frames)
+{
+    for (qint64 frame = 0; frame < frames; ++frame) {
+        for (int channel = 0; channel < m_channels; ++channel) {
+            double value = samples[frame * m_channels + channel];
+            value = process(m_shelvingFilter, m_shelvingState[channel], value);
+            value = process(m_highPassFilter, m_highPassState[channel], value);
+            // channel weights are 1.0 for all front channels
+            m_subBlockEnergy += value * value;
+        }
+        if (++m_subBlockPosition == m_subBlockFrames) {
+            m_subBlocks.append(m_subBlockEnergy / m_subBlockFrames);
+            m_subBlockEnergy = 0;
+            m_subBlockPosition = 0;
+        }
+    }
+}
+
+double LoudnessMeter::integratedLoudness() const
+{
+    QVector<double> blocks;
+    if (m_subBlocks.size() < 4) {
+        // signal shorter than one gating block, measure it as a whole
+        double energy = m_subBlockEnergy;
+        for (double subBlock : m_subBlocks) {
+            energy += subBlock * m_subBlockFrames;
+        }
+        const qint64 frames = m_subBlocks.size() * m_subBlockFrames + m_subBlockPosition;
+        if (frames > 0) {
+            blocks.append(energy / frames);
+        }
+    } else {
+        blocks.reserve(m_subBlocks.size() - 3);
+        for (int i = 3; i < m_subBlocks.size(); ++i) {
+            blocks.append((m_subBlocks.at(i - 3) + m_subBlocks.at(i - 2) + m_subBlocks.at(i - 1) + m_subBlocks.at(i)) / 4.0);
+        }
+    }
+
+    const auto gatedMean = [&blocks](double gate) {
+        double sum = 0;
+        int count = 0;
+        for (double block : blocks) {
+            if (block > 0 && toLoudness(block) > gate) {
+                sum += block;
+                ++count;
+            }
+        }
+        return count > 0 ? sum / count : 0.0;
+    };
+
+    const double absoluteMean = gatedMean(absoluteGate);
+    if (absoluteMean <= 0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    const double relativeMean = gatedMean(toLoudness(absoluteMean) + relativeGate);
+    if (relativeMean <= 0) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    return toLoudness(relativeMean);
+}
@@ -0,0 +1,55 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef LOUDNESSMETER_H
+#define LOUDNESSMETER_H
+
+#include <QVector>
+
+/**
+ * \class LoudnessMeter
+ * \internal
+ *
+ * Measures the integrated loudness of an audio signal according to EBU R128 / ITU-R BS.1770:
+ * the signal is K-weighted, split into 400 ms blocks with 75% overlap and the block
+ * energies are gated absolutely at -70 LUFS and relatively at -10 LU.
+ */
+class LoudnessMeter
+{
+public:
+    LoudnessMeter(int sampleRate, int channels);
+
+    /**
+     * Add \p frames frames of interleaved samples in the range [-1, 1].
+     */
+    void addFrames(const float *samples, qint64 frames);
+
+    /**
+     * \return integrated loudness in LUFS or a value below -70 if the signal is silent
+     */
+    double integratedLoudness() const;
+
+private:
+    struct Biquad {
+        double b0, b1, b2, a1, a2;
+    };
+    struct FilterState {
+        double x1 {0}, x2 {0}, y1 {0}, y2 {0};
+    };
+    static double process(const Biquad &filter, FilterState &state, double sample);
+
+    int m_channels;
+    int m_subBlockFrames; //!< frames of 100 ms, a gating block consists of four sub-blocks
+    Biquad m_shelvingFilter;
+    Biquad m_highPassFilter;
+    QVector<FilterState> m_shelvingState;
+    QVector<FilterState> m_highPassState;
+    double m_subBlockEnergy {0};
+    qint64 m_subBlockPosition {0};
+    QVector<double> m_subBlocks; //!< mean square of each completed sub-block
+};
+
+#endif
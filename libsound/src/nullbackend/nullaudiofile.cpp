@@ -0,0 +1,115 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "nullaudiofile.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QtEndian>
+#include <QtMath>
+
+namespace
+{
+qint64 wavDuration(QFile &file)
+{
+    file.seek(12);
+    quint32 byteRate = 0;
+    while (!file.atEnd()) {
+        const QByteArray header = file.read(8);
+        if (header.size() < 8) {
+            break;
+        }
+        const quint32 chunkSize = qFromLittleEndian<quint32>(header.constData() + 4);
+        if (header.startsWith("fmt ")) {
+            const QByteArray format = file.read(chunkSize);
+            if (format.size() >= 12) {
+                byteRate = qFromLittleEndian<quint32>(format.constData() + 8);
+            }
+            continue;
+        }
+        if (header.startsWith("data")) {
+            return byteRate > 0 ? static_cast<qint64>(chunkSize) * 1000 / byteRate : -1;
+        }
+        // chunks are padded to an even size
+        file.seek(file.pos() + chunkSize + (chunkSize % 2));
+    }
+    return -1;
+}
+
+qint64 oggDuration(QFile &file)
+{
+    // the identification header is contained in the first page
+    const QByteArray head = file.read(4096);
+    qint64 sampleRate = 0;
+    qint64 preSkip = 0;
+    int index = head.indexOf("\x01vorbis");
+    if (index >= 0 && head.size() >= index + 16) {
+        sampleRate = qFromLittleEndian<quint32>(head.constData() + index + 12);
+    } else if ((index = head.indexOf("OpusHead")) >= 0 && head.size() >= index + 12) {
+        // Opus granule positions always count 48 kHz samples
+        sampleRate = 48000;
+        preSkip = qFromLittleEndian<quint16>(head.constData() + index + 10);
+    }
+    if (sampleRate <= 0) {
+        return -1;
+    }
+
+    // the granule position of the last page is the number of samples of the stream
+    const qint64 tailSize = qMin<qint64>(file.size(), 65536);
+    file.seek(file.size() - tailSize);
+    const QByteArray tail = file.read(tailSize);
+    const int lastPage = tail.lastIndexOf("OggS");
+    if (lastPage < 0 || tail.size() < lastPage + 14) {
+        return -1;
+    }
+    const qint64 granule = qFromLittleEndian<qint64>(tail.constData() + lastPage + 6);
+    return qMax<qint64>(0, granule - preSkip) * 1000 / sampleRate;
+}
+}
+
+qint64 NullAudioFile::duration(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return -1;
+    }
+    const QByteArray magic = file.read(4);
+    if (magic == "RIFF") {
+        return wavDuration(file);
+    }
+    if (magic == "OggS") {
+        file.seek(0);
+        return oggDuration(file);
+    }
+    return -1;
+}
+
+bool NullAudioFile::writeSine(const QString &path, qint64 durationMs, double frequency, int sampleRate, int channels)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    const quint32 frames = static_cast<quint32>(durationMs * sampleRate / 1000);
+    const quint32 dataSize = frames * channels * 2;
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.writeRawData("RIFF", 4);
+    stream << quint32(36 + dataSize);
+    stream.writeRawData("WAVEfmt ", 8);
+    stream << quint32(16) << quint16(1) << quint16(channels) << quint32(sampleRate) << quint32(sampleRate * channels * 2) << quint16(channels * 2)
+           << quint16(16);
+    stream.writeRawData("data", 4);
+    stream << dataSize;
+    for (quint32 frame = 0; frame < frames; ++frame) {
+        const auto sample = static_cast<qint16>(16384 * qSin(2 * M_PI * frequency * frame / sampleRate));
+        for (int channel = 0; channel < channels; ++channel) {
+            stream << sample;
+        }
+    }
+    return stream.status() == QDataStream::Ok;
+}
@@ -0,0 +1,30 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef NULLAUDIOFILE_H
+#define NULLAUDIOFILE_H
+
+#include <QString>
+
+/**
+ * Helpers of the null backend to inspect and create sound files without decoding them.
+ */
+namespace NullAudioFile
+{
+/**
+ * Read the duration of a WAV, Ogg Vorbis or Ogg Opus file from its headers.
+ * \return duration in milliseconds or -1 if it cannot be determined
+ */
+qint64 duration(const QString &path);
+
+/**
+ * Write a 16 bit PCM WAV file with a sine signal of \p frequency Hz, a frequency of 0 writes silence.
+ * \return true on success
+ */
+bool writeSine(const QString &path, qint64 durationMs, double frequency, int sampleRate, int channels);
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "nullbackend.h"
+#include "libsound_debug.h"
+#include "nullcapturebackend.h"
+#include "nulloutputbackend.h"
+#include <KPluginFactory>
+#include <QMutexLocker>
+#include <QRandomGenerator>
+#include <QVariantMap>
+
+K_PLUGIN_FACTORY_WITH_JSON(BackendFactory, "nullbackend.json", registerPlugin<NullBackend>();)
+
+NullBackend::NullBackend(QObject *parent, const QList<QVariant> &)
+    : BackendInterface(QStringLiteral("null"), parent)
+    , m_captureBackend(nullptr)
+    , m_outputBackend(nullptr)
+    , m_latency(qMax(0, qEnvironmentVariableIntValue("ARTIKULATE_NULL_BACKEND_LATENCY")))
+    , m_jitter(qMax(0, qEnvironmentVariableIntValue("ARTIKULATE_NULL_BACKEND_JITTER")))
+    , m_captureSource(qEnvironmentVariable("ARTIKULATE_NULL_BACKEND_CAPTURE_SOURCE"))
+{
+    m_clock.start();
+    const QString logFile = qEnvironmentVariable("ARTIKULATE_NULL_BACKEND_LOG");
+    if (!logFile.isEmpty()) {
+        m_logFile.setFileName(logFile);
+        if (!m_logFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+            qCWarning(LIBSOUND_LOG) << "Could not open transition log" << logFile;
+        }
+    }
+}
+
+NullBackend::~NullBackend()
+{
+    delete m_captureBackend;
+    delete m_outputBackend;
+}
+
+CaptureBackendInterface *NullBackend::captureBackend() const
+{
+    if (!m_captureBackend) {
+        // no parent, since this backend may live in another thread than the caller
+        m_captureBackend = new NullCaptureBackend(const_cast<NullBackend *>(this));
+        m_captureBackend->moveToThread(thread());
+    }
+    return m_captureBackend;
+}
+
+OutputBackendInterface *NullBackend::outputBackend() const
+{
+    if (!m_outputBackend) {
+        // no parent, since this backend may live in another thread than the caller
+        m_outputBackend = new NullOutputBackend(const_cast<NullBackend *>(this));
+        m_outputBackend->moveToThread(thread());
+    }
+    return m_outputBackend;
+}
+
+void NullBackend::setLatency(int milliseconds)
+{
+    m_latency = qMax(0, milliseconds);
+}
+
+int NullBackend::latency() const
+{
+    return m_latency;
+}
+
+void NullBackend::setJitter(int milliseconds)
+{
+    m_jitter = qMax(0, milliseconds);
+}
+
+int NullBackend::jitter() const
+{
+    return m_jitter;
+}
+
+void NullBackend::setCaptureSource(const QString &filePath)
+{
+    m_captureSource = filePath;
+}
+
+QString NullBackend::captureSource() const
+{
+    return m_captureSource;
+}
+
+QVariantList NullBackend::transitions() const
+{
+    QMutexLocker locker(&m_logMutex);
+    QVariantList result;
+    result.reserve(m_transitions.size());
+    for (const auto &transition : m_transitions) {
+        QVariantMap entry;
+        entry.insert(QStringLiteral("timestamp"), transition.timestamp);
+        entry.insert(QStringLiteral("component"), transition.component);
+        entry.insert(QStringLiteral("event"), transition.event);
+        entry.insert(QStringLiteral("uri"), transition.uri);
+        result.append(entry);
+    }
+    return result;
+}
+
+void NullBackend::clearTransitions()
+{
+    QMutexLocker locker(&m_logMutex);
+    m_transitions.clear();
+}
+
+int NullBackend::nextStartDelay() const
+{
+    return m_latency + (m_jitter > 0 ? QRandomGenerator::global()->bounded(m_jitter + 1) : 0);
+}
+
+void NullBackend::logTransition(const QString &component, const QString &event, const QString &uri)
+{
+    QMutexLocker locker(&m_logMutex);
+    const Transition transition {m_clock.nsecsElapsed(), component, event, uri};
+    m_transitions.append(transition);
+    if (m_logFile.isOpen()) {
+        m_logFile.write(QStringLiteral("%1\t%2\t%3\t%4\n").arg(transition.timestamp).arg(component, event, uri).toUtf8());
+        m_logFile.flush();
+    }
+}
+
+#include "nullbackend.moc"
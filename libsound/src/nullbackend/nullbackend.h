@@ -0,0 +1,87 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef NULLBACKEND_H
+#define NULLBACKEND_H
+
+#include "../backendinterface.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QVariantList>
+#include <QVector>
+
+class CaptureBackendInterface;
+class OutputBackendInterface;
+class NullCaptureBackend;
+class NullOutputBackend;
+
+/**
+ * \class NullBackend
+ *
+ * Sound backend that does not access any audio device. Playback is simulated by timers that run
+ * for the duration of the sound files, recordings are copied from a configured file or synthesized.
+ * Starting playback or capture is delayed by a configurable latency plus a random jitter.
+ * Playback of files that do not exist fails, the output then stops with an "error" transition.
+ * Every state transition is logged with a timestamp for automated latency measurements.
+ *
+ * The backend is configured with the following environment variables or the equally named setters:
+ * - ARTIKULATE_NULL_BACKEND_LATENCY: start latency in milliseconds, default 0
+ * - ARTIKULATE_NULL_BACKEND_JITTER: maximum random jitter in milliseconds added to the latency, default 0
+ * - ARTIKULATE_NULL_BACKEND_CAPTURE_SOURCE: WAV or Ogg file that is copied as recording, otherwise a sine is synthesized
+ *   as WAV file; only capture profiles with a matching container are accepted
+ * - ARTIKULATE_NULL_BACKEND_LOG: file to which transitions are appended as tab separated lines
+ */
+class NullBackend : public BackendInterface
+{
+    Q_OBJECT
+
+public:
+    struct Transition {
+        qint64 timestamp; //!< nanoseconds since creation of the backend
+        QString component; //!< "output" or "capture"
+        QString event;
+        QString uri;
+    };
+
+    explicit NullBackend(QObject *parent, const QList<QVariant> &);
+    ~NullBackend() override;
+
+    CaptureBackendInterface *captureBackend() const override;
+    OutputBackendInterface *outputBackend() const override;
+
+    Q_INVOKABLE void setLatency(int milliseconds);
+    Q_INVOKABLE int latency() const;
+    Q_INVOKABLE void setJitter(int milliseconds);
+    Q_INVOKABLE int jitter() const;
+    Q_INVOKABLE void setCaptureSource(const QString &filePath);
+    Q_INVOKABLE QString captureSource() const;
+
+    /**
+     * \return list of all transitions, each as map with keys "timestamp", "component", "event" and "uri"
+     */
+    Q_INVOKABLE QVariantList transitions() const;
+    Q_INVOKABLE void clearTransitions();
+
+    /**
+     * \return latency plus random jitter for the next start of playback or capture
+     */
+    int nextStartDelay() const;
+    void logTransition(const QString &component, const QString &event, const QString &uri);
+
+private:
+    mutable NullCaptureBackend *m_captureBackend;
+    mutable NullOutputBackend *m_outputBackend;
+    int m_latency;
+    int m_jitter;
+    QString m_captureSource;
+    QElapsedTimer m_clock;
+    mutable QMutex m_logMutex;
+    QVector<Transition> m_transitions;
+    QFile m_logFile;
+};
+
+#endif
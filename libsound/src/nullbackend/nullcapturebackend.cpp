@@ -0,0 +1,122 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "nullcapturebackend.h"
+#include "libsound_debug.h"
+#include "nullaudiofile.h"
+#include "nullbackend.h"
+
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+// frequency of the synthesized recording
+constexpr double sineFrequency = 440.0;
+}
+
+NullCaptureBackend::NullCaptureBackend(NullBackend *backend)
+    : CaptureBackendInterface(nullptr)
+    , m_backend(backend)
+    , m_startTimer(this)
+    , m_state(CaptureDeviceController::StoppedState)
+    , m_profile(CaptureProfile::comparisonProfile())
+{
+    m_startTimer.setSingleShot(true);
+    connect(&m_startTimer, &QTimer::timeout, this, &NullCaptureBackend::onStarted);
+}
+
+NullCaptureBackend::~NullCaptureBackend() = default;
+
+void NullCaptureBackend::startCapture(const QString &filePath)
+{
+    if (m_state != CaptureDeviceController::StoppedState || m_startTimer.isActive()) {
+        stopCapture();
+    }
+    m_filePath = filePath;
+    m_backend->logTransition(QStringLiteral("capture"), QStringLiteral("requested"), m_filePath);
+    m_startTimer.start(m_backend->nextStartDelay());
+}
+
+void NullCaptureBackend::onStarted()
+{
+    m_state = CaptureDeviceController::RecordingState;
+    m_recordingTime.start();
+    m_backend->logTransition(QStringLiteral("capture"), QStringLiteral("recording"), m_filePath);
+}
+
+void NullCaptureBackend::stopCapture()
+{
+    if (m_startTimer.isActive()) {
+        // stopped before the device delivered any data
+        m_startTimer.stop();
+        writeRecording(0);
+    } else if (m_state == CaptureDeviceController::RecordingState) {
+        writeRecording(m_recordingTime.elapsed());
+    } else {
+        return;
+    }
+    m_state = CaptureDeviceController::StoppedState;
+    m_backend->logTransition(QStringLiteral("capture"), QStringLiteral("stopped"), m_filePath);
+}
+
+void NullCaptureBackend::writeRecording(qint64 durationMs)
+{
+    if (!canWrite(m_profile)) {
+        // capture source was changed after the profile was set
+        qCWarning(LIBSOUND_LOG) << "Capture source does not match" << m_profile << ", no recording written to" << m_filePath;
+        return;
+    }
+    const QString source = m_backend->captureSource();
+    if (!source.isEmpty()) {
+        QFile::remove(m_filePath);
+        if (!QFile::copy(source, m_filePath)) {
+            qCWarning(LIBSOUND_LOG) << "Could not copy capture source" << source << "to" << m_filePath;
+        }
+        return;
+    }
+    if (!NullAudioFile::writeSine(m_filePath, durationMs, sineFrequency, m_profile.sampleRate(), m_profile.channels())) {
+        qCWarning(LIBSOUND_LOG) << "Could not write recording to" << m_filePath;
+    }
+}
+
+CaptureDeviceController::State NullCaptureBackend::captureState() const
+{
+    return m_state;
+}
+
+bool NullCaptureBackend::canWrite(const CaptureProfile &profile) const
+{
+    const QString source = m_backend->captureSource();
+    if (source.isEmpty()) {
+        return profile.format() == CaptureProfile::RawPcm;
+    }
+    return QFileInfo(source).suffix().compare(profile.fileSuffix(), Qt::CaseInsensitive) == 0;
+}
+
+bool NullCaptureBackend::setProfile(const CaptureProfile &profile)
+{
+    if (!canWrite(profile)) {
+        return false;
+    }
+    m_profile = profile;
+    return true;
+}
+
+CaptureProfile NullCaptureBackend::profile() const
+{
+    return m_profile;
+}
+
+QStringList NullCaptureBackend::devices() const
+{
+    return {QStringLiteral("null")};
+}
+
+void NullCaptureBackend::setDevice(const QString &deviceIdentifier)
+{
+    Q_UNUSED(deviceIdentifier)
+}
@@ -0,0 +1,58 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef NULLCAPTUREBACKEND_H
+#define NULLCAPTUREBACKEND_H
+
+#include "capturebackendinterface.h"
+#include "capturedevicecontroller.h"
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QTimer>
+
+class NullBackend;
+
+class NullCaptureBackend : public CaptureBackendInterface
+{
+    Q_OBJECT
+
+public:
+    explicit NullCaptureBackend(NullBackend *backend);
+    ~NullCaptureBackend() override;
+
+    void startCapture(const QString &filePath) override;
+    void stopCapture() override;
+    CaptureDeviceController::State captureState() const override;
+
+    /**
+     * Without a capture source file, recordings are synthesized as uncompressed WAV data with the
+     * sample rate and channels of the profile, hence only the RawPcm profile is accepted. With a
+     * capture source, profiles are accepted whose container matches the suffix of the source.
+     */
+    bool setProfile(const CaptureProfile &profile) override;
+    CaptureProfile profile() const override;
+
+    QStringList devices() const override;
+    void setDevice(const QString &deviceIdentifier) override;
+
+private:
+    void onStarted();
+    void writeRecording(qint64 durationMs);
+    /**
+     * \return true if recordings in the container of \p profile can be written
+     */
+    bool canWrite(const CaptureProfile &profile) const;
+
+    NullBackend *m_backend;
+    QTimer m_startTimer; //!< simulates device latency, child of this object such that it is moved along with it
+    QElapsedTimer m_recordingTime;
+    QString m_filePath;
+    CaptureDeviceController::State m_state;
+    CaptureProfile m_profile;
+};
+
+#endif
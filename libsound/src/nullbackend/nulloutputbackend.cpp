@@ -0,0 +1,135 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "nulloutputbackend.h"
+#include "nullaudiofile.h"
+#include "nullbackend.h"
+
+#include <QFileInfo>
+
+namespace
+{
+// used for sources of unknown format
+constexpr int defaultDuration = 1000;
+}
+
+NullOutputBackend::NullOutputBackend(NullBackend *backend)
+    : OutputBackendInterface(nullptr)
+    , m_backend(backend)
+    , m_startTimer(this)
+    , m_playbackTimer(this)
+    , m_state(OutputDeviceController::StoppedState)
+    , m_remaining(-1)
+    , m_volume(50)
+{
+    m_startTimer.setSingleShot(true);
+    m_playbackTimer.setSingleShot(true);
+    connect(&m_startTimer, &QTimer::timeout, this, &NullOutputBackend::onStarted);
+    connect(&m_playbackTimer, &QTimer::timeout, this, &NullOutputBackend::onSourceFinished);
+}
+
+NullOutputBackend::~NullOutputBackend() = default;
+
+int NullOutputBackend::duration(const QString &uri)
+{
+    const qint64 duration = NullAudioFile::duration(uri);
+    return duration >= 0 ? static_cast<int>(duration) : defaultDuration;
+}
+
+void NullOutputBackend::setUri(const QString &uri)
+{
+    // like the other backends, setting a new source stops the current one
+    m_startTimer.stop();
+    m_playbackTimer.stop();
+    m_remaining = -1;
+    m_uri = uri;
+    if (m_state != OutputDeviceController::StoppedState) {
+        setState(OutputDeviceController::StoppedState, QStringLiteral("stopped"));
+    }
+}
+
+void NullOutputBackend::setNextUri(const QString &uri)
+{
+    m_nextUri = uri;
+}
+
+int NullOutputBackend::volume() const
+{
+    return m_volume;
+}
+
+void NullOutputBackend::setVolume(int volume)
+{
+    m_volume = volume;
+}
+
+OutputDeviceController::State NullOutputBackend::state() const
+{
+    return m_state;
+}
+
+void NullOutputBackend::play()
+{
+    if (m_state == OutputDeviceController::PlayingState || m_startTimer.isActive()) {
+        return;
+    }
+    m_backend->logTransition(QStringLiteral("output"), QStringLiteral("requested"), m_uri);
+    m_startTimer.start(m_backend->nextStartDelay());
+}
+
+void NullOutputBackend::onStarted()
+{
+    if (!QFileInfo::exists(m_uri)) {
+        // like the other backends, sources that cannot be opened stop playback
+        m_remaining = -1;
+        setState(OutputDeviceController::StoppedState, QStringLiteral("error"));
+        return;
+    }
+    m_playbackTimer.start(m_remaining >= 0 ? m_remaining : duration(m_uri));
+    m_remaining = -1;
+    setState(OutputDeviceController::PlayingState, QStringLiteral("playing"));
+}
+
+void NullOutputBackend::onSourceFinished()
+{
+    if (!m_nextUri.isEmpty()) {
+        m_uri = m_nextUri;
+        m_nextUri.clear();
+        m_playbackTimer.start(duration(m_uri));
+        m_backend->logTransition(QStringLiteral("output"), QStringLiteral("advanced"), m_uri);
+        Q_EMIT sourceAdvanced();
+        return;
+    }
+    setState(OutputDeviceController::StoppedState, QStringLiteral("finished"));
+}
+
+void NullOutputBackend::pause()
+{
+    m_startTimer.stop();
+    if (m_state != OutputDeviceController::PlayingState) {
+        return;
+    }
+    m_remaining = m_playbackTimer.remainingTime();
+    m_playbackTimer.stop();
+    setState(OutputDeviceController::PausedState, QStringLiteral("paused"));
+}
+
+void NullOutputBackend::stop()
+{
+    m_startTimer.stop();
+    m_playbackTimer.stop();
+    m_remaining = -1;
+    if (m_state != OutputDeviceController::StoppedState) {
+        setState(OutputDeviceController::StoppedState, QStringLiteral("stopped"));
+    }
+}
+
+void NullOutputBackend::setState(OutputDeviceController::State state, const QString &event)
+{
+    m_state = state;
+    m_backend->logTransition(QStringLiteral("output"), event, m_uri);
+    Q_EMIT stateChanged();
+}
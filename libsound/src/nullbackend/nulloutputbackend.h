@@ -0,0 +1,58 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef NULLOUTPUTBACKEND_H
+#define NULLOUTPUTBACKEND_H
+
+#include "outputbackendinterface.h"
+#include <QString>
+#include <QTimer>
+
+class NullBackend;
+
+class NullOutputBackend : public OutputBackendInterface
+{
+    Q_OBJECT
+
+public:
+    explicit NullOutputBackend(NullBackend *backend);
+    ~NullOutputBackend() override;
+
+    void setUri(const QString &uri) override;
+    void setNextUri(const QString &uri) override;
+    /**
+     * volume as cubic value
+     */
+    int volume() const override;
+
+    OutputDeviceController::State state() const override;
+
+public Q_SLOTS:
+    void play() override;
+    void pause() override;
+    void stop() override;
+    void setVolume(int volume) override;
+
+private:
+    void onStarted();
+    void onSourceFinished();
+    void setState(OutputDeviceController::State state, const QString &event);
+    /**
+     * \return playback duration of \p uri in milliseconds
+     */
+    static int duration(const QString &uri);
+
+    NullBackend *m_backend;
+    QTimer m_startTimer; //!< simulates device latency, child of this object such that it is moved along with it
+    QTimer m_playbackTimer; //!< runs for the duration of the current source
+    QString m_uri;
+    QString m_nextUri;
+    OutputDeviceController::State m_state;
+    int m_remaining; //!< remaining playback time of paused source in milliseconds
+    int m_volume;
+};
+
+#endif
@@ -0,0 +1,176 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "oggvorbisfile.h"
+#include "libsound_debug.h"
+
+#include <QFile>
+#include <QRandomGenerator>
+#include <QSaveFile>
+
+#include <vorbis/vorbisenc.h>
+#include <vorbis/vorbisfile.h>
+
+namespace
+{
+constexpr int chunkFrames = 4096;
+}
+
+bool OggVorbisFile::read(const QString &path)
+{
+    OggVorbis_File file;
+    if (ov_fopen(QFile::encodeName(path).constData(), &file) != 0) {
+        qCWarning(LIBSOUND_LOG) << "Could not open Ogg Vorbis file" << path;
+        return false;
+    }
+    const vorbis_info *info = ov_info(&file, -1);
+    m_sampleRate = static_cast<int>(info->rate);
+    m_channels = info->channels;
+    m_samples.clear();
+    const ogg_int64_t totalFrames = ov_pcm_total(&file, -1);
+    if (totalFrames > 0) {
+        m_samples.reserve(static_cast<int>(totalFrames * m_channels));
+    }
+
+    bool success = true;
+    int bitstream = 0;
+    float **pcm = nullptr;
+    long frames = 0;
+    while ((frames = ov_read_float(&file, &pcm, chunkFrames, &bitstream)) != 0) {
+        if (frames < 0) {
+            qCWarning(LIBSOUND_LOG) << "Corrupt data in Ogg Vorbis file" << path;
+            success = false;
+            break;
+        }
+        if (ov_info(&file, bitstream)->channels != m_channels) {
+            qCWarning(LIBSOUND_LOG) << "Chained streams with differing channel layout are not supported:" << path;
+            success = false;
+            break;
+        }
+        for (long frame = 0; frame < frames; ++frame) {
+            for (int channel = 0; channel < m_channels; ++channel) {
+                m_samples.append(pcm[channel][frame]);
+            }
+        }
+    }
+    ov_clear(&file);
+    return success;
+}
+
+bool OggVorbisFile::write(const QString &path, float quality) const
+{
+    if (m_channels <= 0 || m_sampleRate <= 0) {
+        return false;
+    }
+
+    vorbis_info info;
+    vorbis_info_init(&info);
+    if (vorbis_encode_init_vbr(&info, m_channels, m_sampleRate, quality) != 0) {
+        qCWarning(LIBSOUND_LOG) << "Unsupported encoder configuration for" << path;
+        vorbis_info_clear(&info);
+        return false;
+    }
+    vorbis_comment comment;
+    vorbis_comment_init(&comment);
+    vorbis_comment_add_tag(&comment, "ENCODER", "artikulate");
+    vorbis_dsp_state dsp;
+    vorbis_analysis_init(&dsp, &info);
+    vorbis_block block;
+    vorbis_block_init(&dsp, &block);
+    ogg_stream_state stream;
+    ogg_stream_init(&stream, static_cast<int>(QRandomGenerator::global()->generate()));
+
+    QByteArray data;
+    ogg_page page;
+    const auto appendPage = [&data, &page]() {
+        data.append(reinterpret_cast<const char *>(page.header), static_cast<int>(page.header_len));
+        data.append(reinterpret_cast<const char *>(page.body), static_cast<int>(page.body_len));
+    };
+
+    ogg_packet header;
+    ogg_packet headerComment;
+    ogg_packet headerCode;
+    vorbis_analysis_headerout(&dsp, &comment, &header, &headerComment, &headerCode);
+    ogg_stream_packetin(&stream, &header);
+    ogg_stream_packetin(&stream, &headerComment);
+    ogg_stream_packetin(&stream, &headerCode);
+    // audio data must start on a new page
+    while (ogg_stream_flush(&stream, &page) != 0) {
+        appendPage();
+    }
+
+    const auto drain = [&]() {
+        ogg_packet packet;
+        while (vorbis_analysis_blockout(&dsp, &block) == 1) {
+            vorbis_analysis(&block, nullptr);
+            vorbis_bitrate_addblock(&block);
+            while (vorbis_bitrate_flushpacket(&dsp, &packet) != 0) {
+                ogg_stream_packetin(&stream, &packet);
+                while (ogg_stream_pageout(&stream, &page) != 0) {
+                    appendPage();
+                }
+            }
+        }
+    };
+
+    const qint64 totalFrames = frames();
+    for (qint64 offset = 0; offset < totalFrames; offset += chunkFrames) {
+        const int count = static_cast<int>(qMin<qint64>(chunkFrames, totalFrames - offset));
+        float **buffer = vorbis_analysis_buffer(&dsp, count);
+        const float *source = m_samples.constData() + offset * m_channels;
+        for (int frame = 0; frame < count; ++frame) {
+            for (int channel = 0; channel < m_channels; ++channel) {
+                buffer[channel][frame] = source[frame * m_channels + channel];
+            }
+        }
+        vorbis_analysis_wrote(&dsp, count);
+        drain();
+    }
+    // signal end of stream
+    vorbis_analysis_wrote(&dsp, 0);
+    drain();
+    while (ogg_stream_flush(&stream, &page) != 0) {
+        appendPage();
+    }
+
+    ogg_stream_clear(&stream);
+    vorbis_block_clear(&block);
+    vorbis_dsp_clear(&dsp);
+    vorbis_comment_clear(&comment);
+    vorbis_info_clear(&info);
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        qCWarning(LIBSOUND_LOG) << "Could not write Ogg Vorbis file" << path << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+int OggVorbisFile::sampleRate() const
+{
+    return m_sampleRate;
+}
+
+int OggVorbisFile::channels() const
+{
+    return m_channels;
+}
+
+qint64 OggVorbisFile::frames() const
+{
+    return m_channels > 0 ? m_samples.size() / m_channels : 0;
+}
+
+QVector<float> &OggVorbisFile::samples()
+{
+    return m_samples;
+}
+
+const QVector<float> &OggVorbisFile::samples() const
+{
+    return m_samples;
+}
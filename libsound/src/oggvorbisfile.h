@@ -0,0 +1,48 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef OGGVORBISFILE_H
+#define OGGVORBISFILE_H
+
+#include <QString>
+#include <QVector>
+
+/**
+ * \class OggVorbisFile
+ * \internal
+ *
+ * Decodes an Ogg Vorbis file to interleaved float samples and encodes it back. The methods are
+ * reentrant and can be used concurrently for different files.
+ */
+class OggVorbisFile
+{
+public:
+    /**
+     * Decode the file at \p path.
+     * \return true on success
+     */
+    bool read(const QString &path);
+
+    /**
+     * Encode the current samples in VBR mode with the given \p quality in the range [-0.1, 1]
+     * and atomically replace the file at \p path.
+     * \return true on success
+     */
+    bool write(const QString &path, float quality) const;
+
+    int sampleRate() const;
+    int channels() const;
+    qint64 frames() const;
+    QVector<float> &samples();
+    const QVector<float> &samples() const;
+
+private:
+    int m_sampleRate {0};
+    int m_channels {0};
+    QVector<float> m_samples; //!< interleaved samples
+};
+
+#endif
@@ -19,6 +19,12 @@ public:
     explicit OutputBackendInterface(QObject *parent = nullptr);
     ~OutputBackendInterface() override;
     virtual void setUri(const QString &uri) = 0;
+    /**
+     * Set the source that is played directly after the current one. The backend shall pre-roll
+     * this source while the current one is playing and switch to it without a gap. An empty
+     * \p uri removes a previously set next source.
+     */
+    virtual void setNextUri(const QString &uri) = 0;
     /**
      * volume as cubic value
      */
@@ -34,6 +40,10 @@ public Q_SLOTS:
 Q_SIGNALS:
     void positionChanged();
     void stateChanged();
+    /**
+     * Emitted when playback switched from the current source to the one set by setNextUri().
+     */
+    void sourceAdvanced();
 };
 
 #endif
@@ -6,16 +6,14 @@
 
 #include "outputdevicecontroller.h"
 #include "backendinterface.h"
+#include "backendregistry.h"
 #include "outputbackendinterface.h"
 
-#include <QCoreApplication>
-#include <QPluginLoader>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QQueue>
 #include <QUrl>
 
-#include <KPluginFactory>
-#include <KPluginLoader>
-#include <KPluginMetaData>
-
 #include "libsound_debug.h"
 
 /**
@@ -23,63 +21,89 @@
  * \internal
  *
  * This is the private data class for \see OutputDeviceController.
- * Note that -- even if the OutputDeviceController is constructed before its first call -- all
- * devices get only configured by first instantiation of OutputDeviceController with a call
- * to OutputDeviceControllerPrivate::lazyInit(), called in OutputDeviceController::self().
+ * The output backend is obtained from \see BackendRegistry on first use, such that no plugin
+ * is loaded and no playback pipeline is created before the first playback.
  */
 class OutputDeviceControllerPrivate
 {
 public:
+    struct QueueItem {
+        QString filePath;
+        std::function<void()> finished;
+    };
+
     OutputDeviceControllerPrivate(OutputDeviceController *parent)
         : m_parent(parent)
         , m_backend(nullptr)
         , m_volume(0)
-        , m_initialized(false)
+        , m_queueActive(false)
+        , m_headRequested(false)
+        , m_headStarted(false)
     {
-        const QVector<KPluginMetaData> metadataList = KPluginLoader::findPlugins(QStringLiteral("artikulate/libsound"));
-        for (const auto &metadata : metadataList) {
-            qCDebug(LIBSOUND_LOG) << "Load Plugin: " << metadata.name();
-            KPluginFactory *factory = KPluginLoader(metadata.fileName()).factory();
-            if (!factory) {
-                qCCritical(LIBSOUND_LOG) << "Could not load plugin:" << metadata.name();
-                continue;
-            }
-            BackendInterface *plugin = factory->create<BackendInterface>(parent, QList<QVariant>());
-            if (plugin->outputBackend()) {
-                m_backendList.append(plugin->outputBackend());
-            }
-        }
-        if (!m_backend && !m_backendList.isEmpty()) {
-            m_backend = m_backendList.first();
+    }
+
+    OutputBackendInterface *backend() const
+    {
+        QMutexLocker locker(&m_mutex);
+        if (!m_backend) {
+            BackendInterface *plugin = BackendRegistry::self().backend();
+            m_backend = plugin ? plugin->outputBackend() : nullptr;
+            Q_ASSERT(m_backend);
+            m_parent->connect(m_backend, &OutputBackendInterface::stateChanged, m_parent, &OutputDeviceController::emitChangedState);
+            m_parent->connect(m_backend, &OutputBackendInterface::sourceAdvanced, m_parent, &OutputDeviceController::advanceQueue);
+            m_volume = m_backend->volume();
         }
+        return m_backend;
     }
 
-    ~OutputDeviceControllerPrivate()
+    /**
+     * Start playback of the queue head and hand its successor to the backend for pre-rolling.
+     */
+    void playQueueHead()
     {
-        delete m_backend;
+        Q_ASSERT(!m_queue.isEmpty());
+        m_queueActive = true;
+        m_headRequested = false;
+        m_headStarted = false;
+        backend()->setUri(m_queue.head().filePath);
+        preRollNext();
+        backend()->setVolume(m_volume);
+        m_headRequested = true;
+        backend()->play();
+        emit m_parent->started();
+        emit m_parent->queueItemStarted(m_queue.head().filePath);
     }
 
-    void lazyInit()
+    void preRollNext()
     {
-        if (m_initialized) {
-            return;
-        }
-        m_parent->connect(m_backend, &OutputBackendInterface::stateChanged, m_parent, &OutputDeviceController::emitChangedState);
-        m_volume = m_backend->volume();
-        m_initialized = true;
+        backend()->setNextUri(m_queue.size() > 1 ? m_queue.at(1).filePath : QString());
     }
 
-    OutputBackendInterface *backend() const
+    void resetQueue()
     {
-        Q_ASSERT(m_backend);
-        return m_backend;
+        m_queue.clear();
+        m_queueActive = false;
+        m_headRequested = false;
+        m_headStarted = false;
+        backend()->setNextUri(QString());
+    }
+
+    void finish(const QueueItem &item)
+    {
+        emit m_parent->queueItemFinished(item.filePath);
+        if (item.finished) {
+            item.finished();
+        }
     }
 
     OutputDeviceController *m_parent;
-    OutputBackendInterface *m_backend;
-    QList<OutputBackendInterface *> m_backendList;
-    int m_volume; // volume as cubic value
-    bool m_initialized;
+    mutable QMutex m_mutex;
+    mutable OutputBackendInterface *m_backend;
+    mutable int m_volume; // volume as cubic value
+    QQueue<QueueItem> m_queue; //!< head is the item currently playing
+    bool m_queueActive;
+    bool m_headRequested; //!< true once playback of the queue head was requested from the backend
+    bool m_headStarted; //!< true once the backend reported playback of the queue head
 };
 
 OutputDeviceController::OutputDeviceController()
@@ -94,12 +118,12 @@ OutputDeviceController::~OutputDeviceController()
 OutputDeviceController &OutputDeviceController::self()
 {
     static OutputDeviceController instance;
-    instance.d->lazyInit();
     return instance;
 }
 
 void OutputDeviceController::play(const QString &filePath)
 {
+    d->resetQueue();
     d->backend()->setUri(filePath);
     d->backend()->setVolume(d->m_volume);
     d->backend()->play();
@@ -111,8 +135,43 @@ void OutputDeviceController::play(const QUrl &filePath)
     play(filePath.toLocalFile());
 }
 
+void OutputDeviceController::enqueue(const QString &filePath, std::function<void()> finished)
+{
+    d->m_queue.enqueue({filePath, std::move(finished)});
+    if (!d->m_queueActive) {
+        d->playQueueHead();
+        return;
+    }
+    // only the direct successor of the current item is pre-rolled
+    if (d->m_queue.size() == 2) {
+        d->preRollNext();
+    }
+}
+
+void OutputDeviceController::enqueue(const QUrl &filePath, std::function<void()> finished)
+{
+    enqueue(filePath.toLocalFile(), std::move(finished));
+}
+
+void OutputDeviceController::clearQueue()
+{
+    if (d->m_queue.size() <= 1) {
+        return;
+    }
+    const auto head = d->m_queue.head();
+    d->m_queue.clear();
+    d->m_queue.enqueue(head);
+    d->preRollNext();
+}
+
+int OutputDeviceController::queueLength() const
+{
+    return d->m_queue.size();
+}
+
 void OutputDeviceController::stop()
 {
+    d->resetQueue();
     d->backend()->stop();
     emit stopped();
 }
@@ -138,11 +197,48 @@ int OutputDeviceController::volume() const
 void OutputDeviceController::emitChangedState()
 {
     if (state() == OutputDeviceController::StoppedState) {
+        if (d->m_queueActive && d->m_headStarted) {
+            const auto item = d->m_queue.dequeue();
+            if (!d->m_queue.isEmpty()) {
+                // successor was enqueued too late for a gapless transition
+                d->playQueueHead();
+                d->finish(item);
+                return;
+            }
+            d->m_queueActive = false;
+            d->m_headRequested = false;
+            d->m_headStarted = false;
+            emit stopped();
+            d->finish(item);
+            return;
+        }
+        if (d->m_queueActive && !d->m_headRequested) {
+            // previous source was stopped while the backend is set up for the queue head
+            return;
+        }
+        if (d->m_queueActive) {
+            // backends report errors by stopping, the queue head could not be played
+            qCWarning(LIBSOUND_LOG) << "Could not play queued sound file" << d->m_queue.head().filePath;
+            d->resetQueue();
+        }
         emit stopped();
         return;
     }
     if (state() == OutputDeviceController::PlayingState) {
+        d->m_headStarted = d->m_queueActive;
         emit started();
         return;
     }
 }
+
+void OutputDeviceController::advanceQueue()
+{
+    if (!d->m_queueActive || d->m_queue.size() < 2) {
+        return;
+    }
+    const auto item = d->m_queue.dequeue();
+    d->m_headStarted = true;
+    d->preRollNext();
+    emit queueItemStarted(d->m_queue.head().filePath);
+    d->finish(item);
+}
@@ -9,6 +9,7 @@
 
 #include "libsound_export.h"
 #include <QObject>
+#include <functional>
 
 class OutputDeviceControllerPrivate;
 class QUrl;
@@ -35,7 +36,28 @@ public:
 
     void play(const QString &filePath);
     void play(const QUrl &filePath);
+    /**
+     * Append \p filePath to the playback queue. If the queue is idle, playback starts immediately;
+     * otherwise the file is pre-rolled by the backend and played without a gap after its predecessor.
+     *
+     * \param filePath the local sound file
+     * \param finished optional callback that is invoked after the item was played completely,
+     *        it is not called for items that are removed by clearQueue(), play() or stop()
+     */
+    void enqueue(const QString &filePath, std::function<void()> finished = nullptr);
+    void enqueue(const QUrl &filePath, std::function<void()> finished = nullptr);
+    /**
+     * Remove all items from the queue that are not yet playing. The current item is played to its end.
+     */
+    void clearQueue();
+    /**
+     * \return number of queued items, including the currently playing one
+     */
+    int queueLength() const;
     OutputDeviceController::State state() const;
+    /**
+     * Stop playback and clear the playback queue.
+     */
     void stop();
     void setVolume(int volume);
     int volume() const;
@@ -46,6 +68,17 @@ public Q_SLOTS:
 Q_SIGNALS:
     void started();
     void stopped();
+    /**
+     * Emitted when playback of the queue item \p filePath started.
+     */
+    void queueItemStarted(const QString &filePath);
+    /**
+     * Emitted when the queue item \p filePath was played completely.
+     */
+    void queueItemFinished(const QString &filePath);
+
+private Q_SLOTS:
+    void advanceQueue();
 
 private:
     Q_DISABLE_COPY(OutputDeviceController)
@@ -34,6 +34,8 @@ CaptureBackendInterface *QtGStreamerBackend::captureBackend() const
 {
     if (!m_captureBackend) {
         m_captureBackend = new QtGStreamerCaptureBackend();
+        // may be called from another thread than the one of this backend
+        m_captureBackend->moveToThread(thread());
     }
     return m_captureBackend;
 }
@@ -42,6 +44,8 @@ OutputBackendInterface *QtGStreamerBackend::outputBackend() const
 {
     if (!m_outputBackend) {
         m_outputBackend = new QtGStreamerOutputBackend();
+        // may be called from another thread than the one of this backend
+        m_outputBackend->moveToThread(thread());
     }
     return m_outputBackend;
 }
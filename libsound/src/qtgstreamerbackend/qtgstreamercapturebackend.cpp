@@ -60,14 +60,57 @@ CaptureDeviceController::State QtGStreamerCaptureBackend::captureState() const
     }
 }
 
+bool QtGStreamerCaptureBackend::setProfile(const CaptureProfile &profile)
+{
+    const char *encoder = nullptr;
+    switch (profile.format()) {
+        case CaptureProfile::RawPcm:
+            encoder = "wavenc";
+            break;
+        case CaptureProfile::Opus:
+            encoder = "opusenc";
+            break;
+        case CaptureProfile::Vorbis:
+            encoder = "vorbisenc";
+            break;
+    }
+    if (!QGst::ElementFactory::find(encoder)) {
+        qCDebug(LIBSOUND_LOG) << "Recording profile not supported, missing element" << encoder;
+        return false;
+    }
+    m_profile = profile;
+    return true;
+}
+
+CaptureProfile QtGStreamerCaptureBackend::profile() const
+{
+    return m_profile;
+}
+
 QGst::BinPtr QtGStreamerCaptureBackend::createAudioSrcBin()
 {
     QGst::BinPtr audioBin;
 
+    QString encoder;
+    switch (m_profile.format()) {
+        case CaptureProfile::RawPcm:
+            // raw samples are written by the wavenc muxer
+            encoder = QStringLiteral("audioconvert");
+            break;
+        case CaptureProfile::Opus:
+            encoder = QStringLiteral("opusenc name=enc bitrate=%1").arg(m_profile.bitrate());
+            break;
+        case CaptureProfile::Vorbis:
+            encoder = QStringLiteral("vorbisenc name=enc quality=%1").arg(m_profile.quality());
+            break;
+    }
+    const QString caps = QStringLiteral("audio/x-raw,rate=%1,channels=%2").arg(m_profile.sampleRate()).arg(m_profile.channels());
+
     try {
         audioBin = QGst::Bin::fromDescription(
-            "autoaudiosrc name=\"audiosrc\" ! audioconvert ! "
-            "audioresample ! audiorate ! vorbisenc name=enc quality=0.6 ! queue");
+            QStringLiteral("autoaudiosrc name=\"audiosrc\" ! audioconvert ! "
+                           "audioresample ! audiorate ! %1 ! %2 ! queue")
+                .arg(caps, encoder));
     } catch (const QGlib::Error &error) {
         qCritical() << "Failed to create audio source bin:" << error;
         return QGst::BinPtr();
@@ -109,8 +152,9 @@ void QtGStreamerCaptureBackend::startCapture(const QString &filePath)
         m_pipeline->sendEvent(QGst::EosEvent::create());
     }
 
+    const bool isRawPcm = m_profile.format() == CaptureProfile::RawPcm;
     QGst::BinPtr audioSrcBin = createAudioSrcBin();
-    QGst::ElementPtr mux = QGst::ElementFactory::make("oggmux");
+    QGst::ElementPtr mux = QGst::ElementFactory::make(isRawPcm ? "wavenc" : "oggmux");
     QGst::ElementPtr sink = QGst::ElementFactory::make("filesink");
 
     if (!audioSrcBin || !mux || !sink) {
@@ -126,7 +170,7 @@ void QtGStreamerCaptureBackend::startCapture(const QString &filePath)
     m_pipeline->add(audioSrcBin, mux, sink);
 
     // link elements
-    QGst::PadPtr audioPad = mux->getRequestPad("audio_%u");
+    QGst::PadPtr audioPad = isRawPcm ? mux->getStaticPad("sink") : mux->getRequestPad("audio_%u");
     audioSrcBin->getStaticPad("src")->link(audioPad);
 
     mux->link(sink);
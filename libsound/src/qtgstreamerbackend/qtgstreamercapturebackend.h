@@ -26,6 +26,8 @@ public:
     void startCapture(const QString &filePath);
     void stopCapture();
     CaptureDeviceController::State captureState() const;
+    bool setProfile(const CaptureProfile &profile);
+    CaptureProfile profile() const;
 
     QStringList devices() const;
     void setDevice(const QString &deviceIdentifier);
@@ -36,6 +38,7 @@ private:
     QGst::BinPtr createAudioSrcBin();
     QGst::PipelinePtr m_pipeline;
     QString m_device;
+    CaptureProfile m_profile;
     QMap<QString, QString> m_availableDevices; //!> (identifier,human readable name)
 };
 
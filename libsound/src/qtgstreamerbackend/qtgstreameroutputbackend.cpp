@@ -19,9 +19,24 @@
 #include <QGst/Message>
 #include <QGst/Query>
 #include <QGst/StreamVolume>
+#include <QMutexLocker>
 #include <QUrl>
 
+namespace
+{
+QString toUri(const QString &uri)
+{
+    // if uri is not a real uri, assume it is a file path
+    if (uri.indexOf("://") < 0) {
+        return QUrl::fromLocalFile(uri).toEncoded();
+    }
+    return uri;
+}
+}
+
 QtGStreamerOutputBackend::QtGStreamerOutputBackend()
+    : m_positionTimer(this)
+    , m_advancePending(false)
 {
     QGst::init();
 }
@@ -33,12 +48,7 @@ QtGStreamerOutputBackend::~QtGStreamerOutputBackend()
 
 void QtGStreamerOutputBackend::setUri(const QString &uri)
 {
-    QString realUri = uri;
-
-    // if uri is not a real uri, assume it is a file path
-    if (realUri.indexOf("://") < 0) {
-        realUri = QUrl::fromLocalFile(realUri).toEncoded();
-    }
+    const QString realUri = toUri(uri);
 
     if (!m_pipeline) {
         m_pipeline = QGst::ElementFactory::make("playbin").dynamicCast<QGst::Pipeline>();
@@ -47,6 +57,9 @@ void QtGStreamerOutputBackend::setUri(const QString &uri)
             QGst::BusPtr bus = m_pipeline->bus();
             bus->addSignalWatch();
             QGlib::connect(bus, "message", this, &QtGStreamerOutputBackend::onBusMessage);
+            // playbin asks for the next uri shortly before the current stream ends, setting it
+            // from within this signal results in a gapless transition
+            QGlib::connect(m_pipeline, "about-to-finish", this, &QtGStreamerOutputBackend::onAboutToFinish);
         } else {
             qCritical() << "Failed to create the pipeline";
         }
@@ -57,6 +70,24 @@ void QtGStreamerOutputBackend::setUri(const QString &uri)
     }
 }
 
+void QtGStreamerOutputBackend::setNextUri(const QString &uri)
+{
+    QMutexLocker locker(&m_nextUriMutex);
+    m_nextUri = uri.isEmpty() ? QString() : toUri(uri);
+}
+
+void QtGStreamerOutputBackend::onAboutToFinish()
+{
+    // called from the streaming thread
+    QMutexLocker locker(&m_nextUriMutex);
+    if (m_nextUri.isEmpty() || !m_pipeline) {
+        return;
+    }
+    m_pipeline->setProperty("uri", m_nextUri);
+    m_nextUri.clear();
+    m_advancePending = true;
+}
+
 QTime QtGStreamerOutputBackend::position() const
 {
     if (m_pipeline) {
@@ -148,6 +179,10 @@ void QtGStreamerOutputBackend::pause()
 
 void QtGStreamerOutputBackend::stop()
 {
+    {
+        QMutexLocker locker(&m_nextUriMutex);
+        m_advancePending = false;
+    }
     if (m_pipeline) {
         m_pipeline->setState(QGst::StateNull);
 
@@ -175,6 +210,15 @@ void QtGStreamerOutputBackend::onBusMessage(const QGst::MessagePtr &message)
             qCritical() << message.staticCast<QGst::ErrorMessage>()->error();
             stop();
             break;
+        case QGst::MessageStreamStart: { // Playback of a new stream started
+            QMutexLocker locker(&m_nextUriMutex);
+            if (m_advancePending) {
+                m_advancePending = false;
+                locker.unlock();
+                Q_EMIT sourceAdvanced();
+            }
+            break;
+        }
         case QGst::MessageStateChanged: // The element in message->source() has changed state
             if (message->source() == m_pipeline) {
                 handlePipelineStateChange(message.staticCast<QGst::StateChangedMessage>());
@@ -198,6 +242,9 @@ void QtGStreamerOutputBackend::handlePipelineStateChange(const QGst::StateChange
                 m_positionTimer.stop();
             }
             break;
+        case QGst::StateReady:
+            // intermediate state while the pipeline is set up, it is not reported as stop
+            return;
         default:
             break;
     }
@@ -13,6 +13,7 @@
 #include "outputbackendinterface.h"
 #include <QGst/Global>
 #include <QGst/Pipeline>
+#include <QMutex>
 #include <QString>
 #include <QTimer>
 
@@ -25,6 +26,7 @@ public:
     virtual ~QtGStreamerOutputBackend();
 
     void setUri(const QString &uri);
+    void setNextUri(const QString &uri);
 
     QTime position() const;
     void setPosition(const QTime &pos);
@@ -42,16 +44,16 @@ public Q_SLOTS:
     void stop();
     void setVolume(int volume);
 
-Q_SIGNALS:
-    void positionChanged();
-    void stateChanged();
-
 private:
     void onBusMessage(const QGst::MessagePtr &message);
+    void onAboutToFinish();
     void handlePipelineStateChange(const QGst::StateChangedMessagePtr &scm);
 
     QGst::PipelinePtr m_pipeline;
-    QTimer m_positionTimer;
+    QTimer m_positionTimer; //!< child of this object, such that it is moved along with it
+    QMutex m_nextUriMutex; //!< guards next uri, which is read from the streaming thread
+    QString m_nextUri;
+    bool m_advancePending;
 };
 
 #endif
@@ -13,22 +13,34 @@ K_PLUGIN_FACTORY_WITH_JSON(BackendFactory, "qtmultimediabackend.json", registerP
 
 QtMultimediaBackend::QtMultimediaBackend(QObject *parent, const QList<QVariant> &)
     : BackendInterface(QStringLiteral("qtmultimedia"), parent)
-    , m_captureBackend(new QtMultimediaCaptureBackend(this))
-    , m_outputBackend(new QtMultimediaOutputBackend(this))
+    , m_captureBackend(nullptr)
+    , m_outputBackend(nullptr)
 {
 }
 
 QtMultimediaBackend::~QtMultimediaBackend()
 {
+    delete m_captureBackend;
+    delete m_outputBackend;
 }
 
 CaptureBackendInterface *QtMultimediaBackend::captureBackend() const
 {
+    if (!m_captureBackend) {
+        // no parent, since this backend may live in another thread than the caller
+        m_captureBackend = new QtMultimediaCaptureBackend(nullptr);
+        m_captureBackend->moveToThread(thread());
+    }
     return m_captureBackend;
 }
 
 OutputBackendInterface *QtMultimediaBackend::outputBackend() const
 {
+    if (!m_outputBackend) {
+        // no parent, since this backend may live in another thread than the caller
+        m_outputBackend = new QtMultimediaOutputBackend(nullptr);
+        m_outputBackend->moveToThread(thread());
+    }
     return m_outputBackend;
 }
 
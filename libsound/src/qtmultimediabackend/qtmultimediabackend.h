@@ -26,8 +26,9 @@ public:
     OutputBackendInterface *outputBackend() const override;
 
 private:
-    QtMultimediaCaptureBackend *m_captureBackend;
-    QtMultimediaOutputBackend *m_outputBackend;
+    // backends are created on first use
+    mutable QtMultimediaCaptureBackend *m_captureBackend;
+    mutable QtMultimediaOutputBackend *m_outputBackend;
 };
 
 #endif
@@ -9,27 +9,88 @@
 #include "libsound_debug.h"
 
 #include <QUrl>
+#include <QVideoEncoderSettings>
 
 #include <KLocalizedString>
 
+namespace
+{
+/**
+ * \return first of the \p candidates that is contained in \p available or an empty string
+ */
+QString firstSupported(const QStringList &candidates, const QStringList &available)
+{
+    for (const auto &candidate : candidates) {
+        if (available.contains(candidate)) {
+            return candidate;
+        }
+    }
+    return QString();
+}
+}
+
 QtMultimediaCaptureBackend::QtMultimediaCaptureBackend(QObject *parent)
     : CaptureBackendInterface(parent)
+    , m_recorder(this)
 {
-    QAudioEncoderSettings audioSettings;
-
-    QStringList availableCodecs = m_recorder.supportedAudioCodecs();
-    if (availableCodecs.contains(QLatin1String("audio/x-vorbis"))) {
-        audioSettings.setCodec(QStringLiteral("audio/x-vorbis"));
-    } else if (availableCodecs.contains(QLatin1String("audio/vorbis"))) {
-        audioSettings.setCodec(QStringLiteral("audio/vorbis"));
-    } else {
+    if (!setProfile(CaptureProfile::archiveProfile())) {
         qCWarning(LIBSOUND_LOG()) << "No vorbis codec was found for recordings";
-        audioSettings.setCodec(availableCodecs.first());
+        QAudioEncoderSettings audioSettings;
+        audioSettings.setCodec(m_recorder.supportedAudioCodecs().value(0));
+        audioSettings.setQuality(QMultimedia::HighQuality);
+        m_recorder.setAudioSettings(audioSettings);
     }
-    qCDebug(LIBSOUND_LOG()) << "recording codec set to" << audioSettings.codec();
+}
 
-    audioSettings.setQuality(QMultimedia::HighQuality);
-    m_recorder.setAudioSettings(audioSettings);
+bool QtMultimediaCaptureBackend::setProfile(const CaptureProfile &profile)
+{
+    QString codec;
+    QString container;
+    switch (profile.format()) {
+        case CaptureProfile::RawPcm:
+            codec = firstSupported({QStringLiteral("audio/pcm"), QStringLiteral("audio/x-raw")}, m_recorder.supportedAudioCodecs());
+            container = firstSupported({QStringLiteral("audio/x-wav"), QStringLiteral("audio/wav"), QStringLiteral("wav")}, m_recorder.supportedContainers());
+            break;
+        case CaptureProfile::Opus:
+            codec = firstSupported({QStringLiteral("audio/x-opus"), QStringLiteral("audio/opus")}, m_recorder.supportedAudioCodecs());
+            container = firstSupported({QStringLiteral("audio/ogg"), QStringLiteral("audio/x-ogg"), QStringLiteral("ogg")}, m_recorder.supportedContainers());
+            break;
+        case CaptureProfile::Vorbis:
+            codec = firstSupported({QStringLiteral("audio/x-vorbis"), QStringLiteral("audio/vorbis")}, m_recorder.supportedAudioCodecs());
+            // the default container of the Vorbis codec is Ogg
+            container = firstSupported({QStringLiteral("audio/ogg"), QStringLiteral("audio/x-ogg"), QStringLiteral("ogg")}, m_recorder.supportedContainers());
+            break;
+    }
+    if (codec.isEmpty() || (container.isEmpty() && profile.format() != CaptureProfile::Vorbis)) {
+        qCDebug(LIBSOUND_LOG()) << "Recording profile not supported:" << profile;
+        return false;
+    }
+
+    QAudioEncoderSettings audioSettings;
+    audioSettings.setCodec(codec);
+    audioSettings.setSampleRate(profile.sampleRate());
+    audioSettings.setChannelCount(profile.channels());
+    switch (profile.format()) {
+        case CaptureProfile::RawPcm:
+            break;
+        case CaptureProfile::Opus:
+            audioSettings.setEncodingMode(QMultimedia::ConstantBitRateEncoding);
+            audioSettings.setBitRate(profile.bitrate());
+            break;
+        case CaptureProfile::Vorbis:
+            audioSettings.setEncodingMode(QMultimedia::ConstantQualityEncoding);
+            audioSettings.setQuality(profile.quality() >= 0.5 ? QMultimedia::HighQuality : QMultimedia::NormalQuality);
+            break;
+    }
+    m_recorder.setEncodingSettings(audioSettings, QVideoEncoderSettings(), container);
+    m_profile = profile;
+    qCDebug(LIBSOUND_LOG()) << "recording codec set to" << codec << "in container" << container;
+    return true;
+}
+
+CaptureProfile QtMultimediaCaptureBackend::profile() const
+{
+    return m_profile;
 }
 
 CaptureDeviceController::State QtMultimediaCaptureBackend::captureState() const
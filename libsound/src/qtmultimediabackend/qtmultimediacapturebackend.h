@@ -28,13 +28,16 @@ public:
     void startCapture(const QString &filePath) override;
     void stopCapture() override;
     CaptureDeviceController::State captureState() const override;
+    bool setProfile(const CaptureProfile &profile) override;
+    CaptureProfile profile() const override;
 
     QStringList devices() const override;
     void setDevice(const QString &deviceIdentifier) override;
 
 private:
-    QAudioRecorder m_recorder;
+    QAudioRecorder m_recorder; //!< child of this object, such that it is moved along with it
     QString m_device;
+    CaptureProfile m_profile;
 };
 
 #endif
@@ -7,23 +7,47 @@
 #include "qtmultimediaoutputbackend.h"
 #include <QDir>
 #include <QMediaPlayer>
+#include <QMediaPlaylist>
 #include <QUrl>
 
 QtMultimediaOutputBackend::QtMultimediaOutputBackend(QObject *parent)
     : OutputBackendInterface(parent)
-    , m_player(new QMediaPlayer)
+    , m_player(new QMediaPlayer(this))
+    , m_playlist(new QMediaPlaylist(m_player))
 {
+    // the playlist lets the player pre-load the next source and switch without a gap
+    m_player->setPlaylist(m_playlist);
     connect(m_player, &QMediaPlayer::stateChanged, this, &QtMultimediaOutputBackend::stateChanged);
+    connect(m_playlist, &QMediaPlaylist::currentIndexChanged, this, &QtMultimediaOutputBackend::onCurrentIndexChanged);
 }
 
-QtMultimediaOutputBackend::~QtMultimediaOutputBackend()
+QtMultimediaOutputBackend::~QtMultimediaOutputBackend() = default;
+
+void QtMultimediaOutputBackend::setUri(const QString &uri)
 {
-    m_player->deleteLater();
+    m_playlist->clear();
+    m_playlist->addMedia(QUrl::fromLocalFile(uri));
+    m_playlist->setCurrentIndex(0);
 }
 
-void QtMultimediaOutputBackend::setUri(const QString &uri)
+void QtMultimediaOutputBackend::setNextUri(const QString &uri)
 {
-    m_player->setMedia(QUrl::fromLocalFile(uri));
+    // drop a previously set next source, but keep the current one
+    const int current = m_playlist->currentIndex();
+    if (current >= 0 && m_playlist->mediaCount() > current + 1) {
+        m_playlist->removeMedia(current + 1, m_playlist->mediaCount() - 1);
+    }
+    if (!uri.isEmpty()) {
+        m_playlist->addMedia(QUrl::fromLocalFile(uri));
+    }
+}
+
+void QtMultimediaOutputBackend::onCurrentIndexChanged(int index)
+{
+    // index 0 is set by setUri(), -1 marks the end of the playlist
+    if (index > 0) {
+        Q_EMIT sourceAdvanced();
+    }
 }
 
 int QtMultimediaOutputBackend::volume() const
@@ -11,6 +11,7 @@
 #include <QString>
 
 class QMediaPlayer;
+class QMediaPlaylist;
 
 class QtMultimediaOutputBackend : public OutputBackendInterface
 {
@@ -21,6 +22,7 @@ public:
     ~QtMultimediaOutputBackend() override;
 
     void setUri(const QString &uri) override;
+    void setNextUri(const QString &uri) override;
     /**
      * volume as cubic value
      */
@@ -35,7 +37,10 @@ public Q_SLOTS:
     void setVolume(int volume) override;
 
 private:
+    void onCurrentIndexChanged(int index);
+
     QMediaPlayer *m_player;
+    QMediaPlaylist *m_playlist;
 };
 
 #endif
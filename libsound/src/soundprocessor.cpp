@@ -0,0 +1,197 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include "soundprocessor.h"
+#include "libsound_debug.h"
+#include "loudnessmeter.h"
+
+#include <QFutureWatcher>
+#include <QtConcurrent>
+#include <cmath>
+
+#ifdef LIBSOUND_HAVE_VORBIS
+#include "oggvorbisfile.h"
+#endif
+
+namespace
+{
+/**
+ * Functor for QtConcurrent::mapped(), processes one file.
+ */
+struct ProcessFile {
+    typedef bool result_type;
+    SoundProcessor::Settings settings;
+    bool operator()(const QString &path) const
+    {
+        return SoundProcessor::processFile(path, settings);
+    }
+};
+
+double fromDecibel(double value)
+{
+    return std::pow(10.0, value / 20.0);
+}
+
+/**
+ * Remove leading and trailing frames of which no sample exceeds the threshold, but keep
+ * padding frames at both ends.
+ * \return true if frames were removed
+ */
+bool trimSilence(QVector<float> &samples, int sampleRate, int channels, const SoundProcessor::Settings &settings)
+{
+    const float threshold = static_cast<float>(fromDecibel(settings.silenceThreshold));
+    const auto isSilent = [&](qint64 frame) {
+        for (int channel = 0; channel < channels; ++channel) {
+            if (std::abs(samples.at(static_cast<int>(frame * channels + channel))) > threshold) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    const qint64 frames = samples.size() / channels;
+    qint64 first = 0;
+    while (first < frames && isSilent(first)) {
+        ++first;
+    }
+    if (first == frames) {
+        // keep silent files untouched
+        return false;
+    }
+    qint64 last = frames - 1;
+    while (last > first && isSilent(last)) {
+        --last;
+    }
+    const qint64 padding = static_cast<qint64>(settings.silencePadding) * sampleRate / 1000;
+    first = qMax<qint64>(0, first - padding);
+    last = qMin(frames - 1, last + padding);
+    if (first == 0 && last == frames - 1) {
+        return false;
+    }
+    samples = samples.mid(static_cast<int>(first * channels), static_cast<int>((last - first + 1) * channels));
+    return true;
+}
+}
+
+class SoundProcessorPrivate
+{
+public:
+    SoundProcessor::Settings m_settings;
+    QFutureWatcher<bool> m_watcher;
+    QStringList m_files;
+};
+
+SoundProcessor::SoundProcessor(QObject *parent)
+    : QObject(parent)
+    , d(new SoundProcessorPrivate)
+{
+    connect(&d->m_watcher, &QFutureWatcher<bool>::resultReadyAt, this, [=](int index) {
+        emit fileProcessed(d->m_files.at(index), d->m_watcher.resultAt(index));
+    });
+    connect(&d->m_watcher, &QFutureWatcher<bool>::progressValueChanged, this, [=](int value) {
+        emit progressChanged(value, d->m_files.count());
+    });
+    connect(&d->m_watcher, &QFutureWatcher<bool>::finished, this, &SoundProcessor::finished);
+}
+
+SoundProcessor::~SoundProcessor()
+{
+    d->m_watcher.cancel();
+    d->m_watcher.waitForFinished();
+}
+
+bool SoundProcessor::isAvailable()
+{
+#ifdef LIBSOUND_HAVE_VORBIS
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool SoundProcessor::processFile(const QString &path, const Settings &settings)
+{
+#ifdef LIBSOUND_HAVE_VORBIS
+    OggVorbisFile file;
+    if (!file.read(path) || file.frames() == 0) {
+        return false;
+    }
+    if (!processSamples(file.samples(), file.sampleRate(), file.channels(), settings)) {
+        // encoding again would only lose quality
+        qCDebug(LIBSOUND_LOG) << "Skip unchanged file" << path;
+        return true;
+    }
+    return file.write(path, settings.encodingQuality);
+#else
+    Q_UNUSED(settings)
+    qCWarning(LIBSOUND_LOG) << "Sound processing not available, cannot process" << path;
+    return false;
+#endif
+}
+
+bool SoundProcessor::processSamples(QVector<float> &samples, int sampleRate, int channels, const Settings &settings)
+{
+    if (channels <= 0 || samples.size() < channels) {
+        return false;
+    }
+    bool changed = trimSilence(samples, sampleRate, channels, settings);
+
+    LoudnessMeter meter(sampleRate, channels);
+    meter.addFrames(samples.constData(), samples.size() / channels);
+    const double loudness = meter.integratedLoudness();
+    float peak = 0;
+    for (float sample : qAsConst(samples)) {
+        peak = qMax(peak, std::abs(sample));
+    }
+
+    // silent signals are only trimmed
+    if (!std::isfinite(loudness) || peak <= 0) {
+        return changed;
+    }
+    const double maximumGain = fromDecibel(settings.maximumPeak) / peak;
+    const bool loudnessMatches = std::abs(settings.targetLoudness - loudness) < settings.loudnessTolerance;
+    if (loudnessMatches && maximumGain >= 1.0) {
+        return changed;
+    }
+    double gain = loudnessMatches ? 1.0 : fromDecibel(settings.targetLoudness - loudness);
+    gain = qMin(gain, maximumGain);
+    qCDebug(LIBSOUND_LOG) << "Normalize from" << loudness << "LUFS with gain" << gain;
+    for (float &sample : samples) {
+        sample = static_cast<float>(sample * gain);
+    }
+    return true;
+}
+
+SoundProcessor::Settings SoundProcessor::settings() const
+{
+    return d->m_settings;
+}
+
+void SoundProcessor::setSettings(const Settings &settings)
+{
+    d->m_settings = settings;
+}
+
+void SoundProcessor::process(const QStringList &files)
+{
+    if (isRunning()) {
+        qCWarning(LIBSOUND_LOG) << "Sound processing is already running";
+        return;
+    }
+    d->m_files = files;
+    emit progressChanged(0, files.count());
+    d->m_watcher.setFuture(QtConcurrent::mapped(d->m_files, ProcessFile {d->m_settings}));
+}
+
+void SoundProcessor::cancel()
+{
+    d->m_watcher.cancel();
+}
+
+bool SoundProcessor::isRunning() const
+{
+    return d->m_watcher.isRunning();
+}
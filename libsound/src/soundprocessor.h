@@ -0,0 +1,86 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#ifndef SOUNDPROCESSOR_H
+#define SOUNDPROCESSOR_H
+
+#include "libsound_export.h"
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+
+class SoundProcessorPrivate;
+
+/**
+ * \class SoundProcessor
+ *
+ * Offline processing of recorded sound files: every file is decoded, trimmed by its leading and
+ * trailing silence, normalized to a common loudness according to EBU R128 and encoded again.
+ * Files are processed in parallel on the global thread pool.
+ */
+class LIBSOUND_EXPORT SoundProcessor : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Settings {
+        double targetLoudness {-23.0}; //!< integrated loudness in LUFS
+        double maximumPeak {-1.0}; //!< sample peak limit in dBFS, lowers the gain if needed
+        double silenceThreshold {-50.0}; //!< in dBFS, samples below are considered silence
+        int silencePadding {100}; //!< in milliseconds of silence kept at both ends
+        double loudnessTolerance {0.5}; //!< in LU, smaller deviations from the target are not corrected
+        float encodingQuality {0.6f}; //!< Vorbis VBR quality
+    };
+
+    explicit SoundProcessor(QObject *parent = nullptr);
+    ~SoundProcessor() override;
+
+    /**
+     * \return true if libsound was built with support for decoding and encoding the sound files
+     */
+    static bool isAvailable();
+
+    /**
+     * Process a single Ogg Vorbis file in place. This method is reentrant.
+     * The file is not encoded again if its samples do not change.
+     * \return true on success
+     */
+    static bool processFile(const QString &path, const Settings &settings);
+
+    /**
+     * Trim and normalize the interleaved \p samples in place. This method is reentrant.
+     * \return true if the samples changed, false for silent signals and signals that already match the settings
+     */
+    static bool processSamples(QVector<float> &samples, int sampleRate, int channels, const Settings &settings);
+
+    Settings settings() const;
+    void setSettings(const Settings &settings);
+
+    /**
+     * Start asynchronous processing of \p files. Has no effect if processing is already running.
+     */
+    void process(const QStringList &files);
+
+    /**
+     * Cancel processing, files that are currently processed are completed.
+     */
+    void cancel();
+    bool isRunning() const;
+
+Q_SIGNALS:
+    /**
+     * Emitted after each processed file, the order corresponds to the completion of the files.
+     */
+    void fileProcessed(const QString &file, bool success);
+    void progressChanged(int processed, int total);
+    void finished();
+
+private:
+    Q_DISABLE_COPY(SoundProcessor)
+    const QScopedPointer<SoundProcessorPrivate> d;
+};
+
+#endif
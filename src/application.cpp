@@ -17,6 +17,7 @@
 #include "core/phoneme.h"
 #include "core/phonemegroup.h"
 #include "core/phrase.h"
+#include "core/phrasesearchindex.h"
 #include "core/player.h"
 #include "core/recorder.h"
 #include "core/resources/editablecourseresource.h"
@@ -35,6 +36,7 @@
 #include "models/phrasefiltermodel.h"
 #include "models/phraselistmodel.h"
 #include "models/phrasemodel.h"
+#include "models/phrasesearchmodel.h"
 #include "models/profilemodel.h"
 #include "models/skeletonmodel.h"
 #include "models/unitfiltermodel.h"
@@ -50,6 +52,7 @@
 #include <QQmlComponent>
 #include <QQmlContext>
 #include <QQmlEngine>
+#include <QStandardPaths>
 
 Application::Application(int &argc, char **argv)
     : QApplication(argc, argv)
@@ -67,9 +70,19 @@ IEditableRepository *Application::editableRepository() const
     return qobject_cast<IEditableRepository *>(m_resourceRepository);
 }
 
+PhraseSearchIndex *Application::phraseSearchIndex() const
+{
+    return m_phraseSearchIndex;
+}
+
 void Application::installResourceRepository(IResourceRepository *resourceRepository)
 {
     m_resourceRepository = resourceRepository;
+    if (!m_phraseSearchIndex) {
+        m_phraseSearchIndex = new PhraseSearchIndex(this);
+        m_phraseSearchIndex->setCacheFile(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/phrasesearch.cache"));
+    }
+    m_phraseSearchIndex->setRepository(resourceRepository);
 }
 
 void Application::registerQmlTypes()
@@ -111,6 +124,7 @@ void Application::registerQmlTypes()
     qmlRegisterType<CourseModel>("artikulate", 1, 0, "CourseModel");
     qmlRegisterType<LanguageModel>("artikulate", 1, 0, "LanguageModel");
     qmlRegisterType<LanguageResourceModel>("artikulate", 1, 0, "LanguageResourceModel");
+    qmlRegisterType<LearningProgressModel>("artikulate", 1, 0, "LearningProgressModel");
     qmlRegisterType<LearnerProfile::LearningGoalModel>("artikulate", 1, 0, "LearningGoalModel");
     qmlRegisterType<PhonemeGroupModel>("artikulate", 1, 0, "PhonemeGroupModel");
     qmlRegisterType<PhonemeModel>("artikulate", 1, 0, "PhonemeModel");
@@ -118,9 +132,9 @@ void Application::registerQmlTypes()
     qmlRegisterType<PhraseFilterModel>("artikulate", 1, 0, "PhraseFilterModel");
     qmlRegisterType<PhraseListModel>("artikulate", 1, 0, "PhraseListModel");
     qmlRegisterType<PhraseModel>("artikulate", 1, 0, "PhraseModel");
+    qmlRegisterType<PhraseSearchModel>("artikulate", 1, 0, "PhraseSearchModel");
     qmlRegisterType<ProfileModel>("artikulate", 1, 0, "ProfileModel");
     qmlRegisterType<SkeletonModel>("artikulate", 1, 0, "SkeletonModel");
     qmlRegisterType<UnitFilterModel>("artikulate", 1, 0, "UnitFilterModel");
     qmlRegisterType<UnitModel>("artikulate", 1, 0, "UnitModel");
-    //     qmlRegisterType<LearningProgressModel>("artikulate", 1, 0, "LearningProgressModel");//TODO must be ported to new trainingsession
 }
@@ -12,6 +12,7 @@
 
 class IResourceRepository;
 class IEditableRepository;
+class PhraseSearchIndex;
 class Application;
 
 #if defined(artikulateApp)
@@ -44,9 +45,16 @@ public:
      */
     IEditableRepository *editableRepository() const;
 
+    /**
+     * @brief getter for the phrase search index over all courses of the global repository
+     * @return the index
+     */
+    PhraseSearchIndex *phraseSearchIndex() const;
+
 private:
     void registerQmlTypes();
     IResourceRepository *m_resourceRepository {nullptr};
+    PhraseSearchIndex *m_phraseSearchIndex {nullptr};
 };
 
 #endif
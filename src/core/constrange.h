@@ -0,0 +1,72 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef CONSTRANGE_H
+#define CONSTRANGE_H
+
+#include <QtGlobal>
+
+/**
+ * \class ConstRange
+ * Read-only view on a contiguous sequence of elements that does not copy or own them.
+ *
+ * A range is only valid as long as the underlying container is not modified.
+ */
+template<typename T> class ConstRange
+{
+public:
+    using const_iterator = const T *;
+
+    ConstRange() = default;
+    ConstRange(const T *begin, const T *end)
+        : m_begin(begin)
+        , m_end(end)
+    {
+    }
+    const_iterator begin() const
+    {
+        return m_begin;
+    }
+    const_iterator end() const
+    {
+        return m_end;
+    }
+    int size() const
+    {
+        return static_cast<int>(m_end - m_begin);
+    }
+    int count() const
+    {
+        return size();
+    }
+    bool isEmpty() const
+    {
+        return m_begin == m_end;
+    }
+    const T &at(int index) const
+    {
+        Q_ASSERT(index >= 0 && index < size());
+        return m_begin[index];
+    }
+    const T &operator[](int index) const
+    {
+        return at(index);
+    }
+    const T &first() const
+    {
+        return at(0);
+    }
+    const T &last() const
+    {
+        return at(size() - 1);
+    }
+
+private:
+    const T *m_begin {nullptr};
+    const T *m_end {nullptr};
+};
+
+#endif
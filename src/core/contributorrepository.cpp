@@ -7,6 +7,7 @@
 #include "contributorrepository.h"
 #include "artikulate_debug.h"
 #include "language.h"
+#include "languageregistry.h"
 #include "liblearnerprofile/src/profilemanager.h"
 #include "phoneme.h"
 #include "phonemegroup.h"
@@ -18,8 +19,27 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFile>
+#include <QFutureWatcher>
 #include <QStandardPaths>
 #include <QUuid>
+#include <QtConcurrent>
+
+namespace
+{
+/**
+ * @brief snapshots from which the skeleton changes of one course are computed
+ */
+struct SkeletonSync {
+    SkeletonDiff::Snapshot skeleton;
+    SkeletonDiff::Snapshot course;
+    SkeletonDiff::Snapshot base;
+};
+
+SkeletonDiff computeSkeletonChanges(const SkeletonSync &sync)
+{
+    return SkeletonDiff::compute(sync.skeleton, sync.course, sync.base);
+}
+}
 
 ContributorRepository::ContributorRepository()
     : IEditableRepository()
@@ -40,15 +60,8 @@ void ContributorRepository::loadLanguageResources()
 {
     // load language resources
     // all other resources are only loaded on demand
-    QDir dir(":/artikulate/languages/");
-    dir.setFilter(QDir::Files | QDir::NoSymLinks);
-    QFileInfoList list = dir.entryInfoList();
-    for (int i = 0; i < list.size(); ++i) {
-        QFileInfo fileInfo = list.at(i);
-        if (fileInfo.completeSuffix() != QLatin1String("xml")) {
-            continue;
-        }
-        addLanguage(QUrl::fromLocalFile(fileInfo.absoluteFilePath()));
+    for (const auto &language : LanguageRegistry::instance()->languages()) {
+        addLanguage(language->file());
     }
 }
 
@@ -87,12 +100,14 @@ void ContributorRepository::addLanguage(const QUrl &languageFile)
         return;
     }
 
-    auto language = Language::create(languageFile);
+    auto language = LanguageRegistry::instance()->load(languageFile);
 
     emit languageResourceAboutToBeAdded(language, m_languages.count());
     m_languages.append(language);
+    m_languageIds.insert(language->id(), language.get());
     m_loadedResources.append(languageFile.toLocalFile());
     m_courses.insert(language->id(), QVector<std::shared_ptr<EditableCourseResource>>());
+    m_courseListValid = false;
     emit languageResourceAdded();
 }
 
@@ -113,6 +128,11 @@ QVector<std::shared_ptr<ILanguage>> ContributorRepository::languages() const
     return m_languages;
 }
 
+ConstRange<std::shared_ptr<ILanguage>> ContributorRepository::languageRange() const
+{
+    return ConstRange<std::shared_ptr<ILanguage>>(m_languages.constData(), m_languages.constData() + m_languages.count());
+}
+
 std::shared_ptr<ILanguage> ContributorRepository::language(int index) const
 {
     Q_ASSERT(index >= 0 && index < m_languages.count());
@@ -128,10 +148,8 @@ ILanguage *ContributorRepository::language(LearnerProfile::LearningGoal *learnin
         qCritical() << "Cannot translate non-language learning goal to language";
         return nullptr;
     }
-    for (auto language : m_languages) {
-        if (language->id() == learningGoal->identifier()) {
-            return language.get();
-        }
+    if (ILanguage *language = m_languageIds.value(learningGoal->identifier())) {
+        return language;
     }
     qCritical() << "No language registered with identifier " << learningGoal->identifier() << ": aborting";
     return nullptr;
@@ -153,15 +171,49 @@ QVector<std::shared_ptr<EditableCourseResource>> ContributorRepository::courseRe
     return m_courses[language->id()];
 }
 
-QVector<std::shared_ptr<ICourse>> ContributorRepository::courses() const
+const QVector<std::shared_ptr<ICourse>> &ContributorRepository::courseList() const
 {
-    QVector<std::shared_ptr<ICourse>> courses;
-    for (const auto &courseList : m_courses) {
-        for (const auto &course : courseList) {
-            courses.append(course);
+    if (!m_courseListValid) {
+        m_courseList.clear();
+        for (const auto &courseList : m_courses) {
+            for (const auto &course : courseList) {
+                m_courseList.append(course);
+            }
         }
+        m_courseListValid = true;
     }
-    return courses;
+    return m_courseList;
+}
+
+int ContributorRepository::courseOffset(const QString &languageId) const
+{
+    int offset = 0;
+    for (auto iter = m_courses.constBegin(); iter != m_courses.constEnd() && iter.key() < languageId; ++iter) {
+        offset += iter.value().count();
+    }
+    return offset;
+}
+
+QVector<std::shared_ptr<ICourse>> ContributorRepository::courses() const
+{
+    return courseList();
+}
+
+ConstRange<std::shared_ptr<ICourse>> ContributorRepository::courseRange() const
+{
+    const auto &courses = courseList();
+    return ConstRange<std::shared_ptr<ICourse>>(courses.constData(), courses.constData() + courses.count());
+}
+
+int ContributorRepository::courseCount() const
+{
+    return courseList().count();
+}
+
+std::shared_ptr<ICourse> ContributorRepository::course(int index) const
+{
+    Q_ASSERT(index >= 0 && index < courseCount());
+    return courseList().at(index);
 }
 
 QVector<std::shared_ptr<IEditableCourse>> ContributorRepository::editableCourses() const
@@ -182,14 +234,26 @@ QVector<std::shared_ptr<ICourse>> ContributorRepository::courses(const QString &
     }
 
     QVector<std::shared_ptr<ICourse>> courses;
-    if (m_courses.contains(languageId)) {
-        for (const auto &course : m_courses[languageId]) {
-            courses.append(course);
-        }
+    for (const auto &course : courseRange(languageId)) {
+        courses.append(course);
     }
     return courses;
 }
 
+ConstRange<std::shared_ptr<ICourse>> ContributorRepository::courseRange(const QString &languageId) const
+{
+    if (languageId.isEmpty()) {
+        return courseRange();
+    }
+    // courses of one language are contiguous in the flattened list that is ordered by language
+    const auto iter = m_courses.constFind(languageId);
+    if (iter == m_courses.constEnd()) {
+        return ConstRange<std::shared_ptr<ICourse>>();
+    }
+    const auto begin = courseList().constData() + courseOffset(languageId);
+    return ConstRange<std::shared_ptr<ICourse>>(begin, begin + iter->count());
+}
+
 std::shared_ptr<IEditableCourse> ContributorRepository::editableCourse(std::shared_ptr<ILanguage> language, int index) const
 {
     Q_ASSERT(m_courses.contains(language->id()));
@@ -286,18 +350,72 @@ void ContributorRepository::updateCourseFromSkeleton(std::shared_ptr<IEditableCo
         qCritical() << "No skeleton ID specified, aborting update.";
         return;
     }
-    std::shared_ptr<ICourse> skeleton;
-    for (const auto &iter : m_skeletonResources) {
-        if (iter->id() == course->foreignId()) {
-            skeleton = iter;
-            break;
-        }
-    }
+    const auto skeleton = this->skeleton(course->foreignId());
     if (!skeleton) {
         qCritical() << "Could not find skeleton with id " << course->foreignId() << ", aborting update.";
     } else {
-        course->updateFrom(skeleton);
+        // removals are only applied after a preview, see skeletonChanges()
+        applySkeletonChanges(skeletonChanges(course).withoutRemovals());
+    }
+}
+
+void ContributorRepository::updateCoursesFromSkeleton(std::shared_ptr<IEditableCourse> skeleton)
+{
+    if (!skeleton) {
+        return;
     }
+    // snapshots are taken on the GUI thread, the diffs of all languages are computed from them in parallel
+    const SkeletonDiff::Snapshot skeletonSnapshot(skeleton);
+    QVector<SkeletonSync> syncs;
+    for (const auto &courses : qAsConst(m_courses)) {
+        for (const auto &course : courses) {
+            if (course->foreignId() == skeleton->id()) {
+                syncs.append({skeletonSnapshot, SkeletonDiff::Snapshot(course), skeletonBase(course)});
+            }
+        }
+    }
+    const QString skeletonId = skeleton->id();
+    auto watcher = new QFutureWatcher<SkeletonDiff>(this);
+    connect(watcher, &QFutureWatcher<SkeletonDiff>::finished, this, [this, watcher, skeletonId]() {
+        const auto diffs = watcher->future().results();
+        for (const auto &diff : diffs) {
+            applySkeletonChanges(diff.withoutRemovals());
+        }
+        watcher->deleteLater();
+        qCInfo(ARTIKULATE_LOG()) << "Updated" << diffs.count() << "courses from skeleton" << skeletonId;
+        emit coursesUpdatedFromSkeleton(skeletonId);
+    });
+    watcher->setFuture(QtConcurrent::mapped(syncs, computeSkeletonChanges));
+}
+
+SkeletonDiff ContributorRepository::skeletonChanges(std::shared_ptr<IEditableCourse> course) const
+{
+    const auto skeleton = course ? this->skeleton(course->foreignId()) : nullptr;
+    if (!skeleton) {
+        return SkeletonDiff();
+    }
+    return SkeletonDiff::compute(SkeletonDiff::Snapshot(skeleton), SkeletonDiff::Snapshot(course), skeletonBase(course));
+}
+
+void ContributorRepository::applySkeletonChanges(const SkeletonDiff &diff)
+{
+    const auto course = diff.course();
+    if (!course) {
+        return;
+    }
+    diff.apply();
+    // the applied skeleton state tells skeleton retitles from translations at the next update
+    m_courseBases.insert(course->file().toLocalFile(), diff.skeleton());
+    qCInfo(ARTIKULATE_LOG()) << "Update performed with" << diff.changes().count() << "changes";
+}
+
+SkeletonDiff::Snapshot ContributorRepository::skeletonBase(const std::shared_ptr<IEditableCourse> &course) const
+{
+    const auto base = m_courseBases.constFind(course->file().toLocalFile());
+    if (base != m_courseBases.constEnd()) {
+        return *base;
+    }
+    return m_skeletonSnapshots.value(course->foreignId());
 }
 
 std::shared_ptr<EditableCourseResource> ContributorRepository::addCourse(const QUrl &courseFile)
@@ -320,8 +438,9 @@ std::shared_ptr<EditableCourseResource> ContributorRepository::addCourse(const Q
             if (!m_courses.contains(languageId)) {
                 m_courses.insert(languageId, QVector<std::shared_ptr<EditableCourseResource>>());
             }
-            emit courseAboutToBeAdded(course, m_courses[course->language()->id()].count());
+            emit courseAboutToBeAdded(course, courseOffset(languageId) + m_courses[languageId].count());
             m_courses[languageId].append(course);
+            m_courseListValid = false;
             emit courseAdded();
             emit languageCoursesChanged();
         }
@@ -331,10 +450,13 @@ std::shared_ptr<EditableCourseResource> ContributorRepository::addCourse(const Q
 
 void ContributorRepository::removeCourse(std::shared_ptr<ICourse> course)
 {
-    for (int index = 0; index < m_courses[course->language()->id()].length(); ++index) {
-        if (m_courses[course->language()->id()].at(index) == course) {
-            emit courseAboutToBeRemoved(index);
-            m_courses[course->language()->id()].removeAt(index);
+    const QString languageId = course->language()->id();
+    auto &courses = m_courses[languageId];
+    for (int index = 0; index < courses.length(); ++index) {
+        if (courses.at(index) == course) {
+            emit courseAboutToBeRemoved(courseOffset(languageId) + index);
+            courses.removeAt(index);
+            m_courseListValid = false;
             emit courseRemoved();
             return;
         }
@@ -376,6 +498,8 @@ std::shared_ptr<IEditableCourse> ContributorRepository::addSkeleton(const QUrl &
         m_loadedResources.append(resource->file().toLocalFile());
         emit skeletonAboutToBeAdded(resource.get(), m_skeletonResources.count());
         m_skeletonResources.append(resource);
+        m_skeletonIds.insert(resource->id(), resource);
+        m_skeletonSnapshots.insert(resource->id(), SkeletonDiff::Snapshot(resource));
         emit skeletonAdded();
     }
     return resource;
@@ -386,6 +510,8 @@ void ContributorRepository::removeSkeleton(SkeletonResource *skeleton)
     for (int index = 0; index < m_skeletonResources.length(); ++index) {
         if (m_skeletonResources.at(index)->id() == skeleton->id()) {
             emit skeletonAboutToBeRemoved(index, index);
+            m_skeletonIds.remove(skeleton->id());
+            m_skeletonSnapshots.remove(skeleton->id());
             m_skeletonResources.removeAt(index);
             emit skeletonRemoved();
             return;
@@ -393,6 +519,11 @@ void ContributorRepository::removeSkeleton(SkeletonResource *skeleton)
     }
 }
 
+std::shared_ptr<IEditableCourse> ContributorRepository::skeleton(const QString &id) const
+{
+    return m_skeletonIds.value(id);
+}
+
 QVector<std::shared_ptr<IEditableCourse>> ContributorRepository::skeletons() const
 {
     QVector<std::shared_ptr<IEditableCourse>> skeletonList;
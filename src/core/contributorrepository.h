@@ -64,6 +64,7 @@ public:
     void setStorageLocation(const QUrl &path);
 
     QVector<std::shared_ptr<ILanguage>> languages() const override;
+    ConstRange<std::shared_ptr<ILanguage>> languageRange() const override;
 
     /**
      * \return language by \p index
@@ -75,8 +76,15 @@ public:
      */
     Q_INVOKABLE ILanguage *language(LearnerProfile::LearningGoal *learningGoal) const;
 
+    /**
+     * \return all courses ordered by language identifier and per language by loading order
+     */
     QVector<std::shared_ptr<ICourse>> courses() const override;
+    ConstRange<std::shared_ptr<ICourse>> courseRange() const override;
+    int courseCount() const override;
+    std::shared_ptr<ICourse> course(int index) const override;
     QVector<std::shared_ptr<ICourse>> courses(const QString &languageId) const override;
+    ConstRange<std::shared_ptr<ICourse>> courseRange(const QString &languageId) const override;
     QVector<std::shared_ptr<IEditableCourse>> editableCourses() const override;
 
     /**
@@ -100,6 +108,27 @@ public:
 
     void updateCourseFromSkeleton(std::shared_ptr<IEditableCourse> course) override;
 
+    /**
+     * Update all courses derived from \p skeleton without blocking, coursesUpdatedFromSkeleton() is
+     * emitted once all changes are applied. Changes that are made to the courses meanwhile are not
+     * taken into account.
+     */
+    void updateCoursesFromSkeleton(std::shared_ptr<IEditableCourse> skeleton) override;
+
+    /**
+     * Compute the changes of \p course against its skeleton. Retitles are computed against the
+     * skeleton state of the last update of the course in this session, or against the state of
+     * the skeleton when it was loaded.
+     */
+    SkeletonDiff skeletonChanges(std::shared_ptr<IEditableCourse> course) const override;
+
+    void applySkeletonChanges(const SkeletonDiff &diff) override;
+
+    /**
+     * \return skeleton with identifier \p id or nullptr if no such skeleton is loaded
+     */
+    std::shared_ptr<IEditableCourse> skeleton(const QString &id) const;
+
     /**
      * Add language to resource manager by parsing the given language specification file.
      *
@@ -156,6 +185,7 @@ Q_SIGNALS:
     void skeletonRemoved();
     void skeletonAboutToBeRemoved(int, int);
     void languageCoursesChanged();
+    void coursesUpdatedFromSkeleton(const QString &skeletonId);
 
 private:
     /**
@@ -163,10 +193,25 @@ private:
      * for this application.
      */
     void loadLanguageResources();
+    /**
+     * \return position in courses() of the first course of language \p languageId
+     */
+    int courseOffset(const QString &languageId) const;
+    const QVector<std::shared_ptr<ICourse>> &courseList() const;
+    /**
+     * \return state of the skeleton at the last update of \p course, which is the base of its next update
+     */
+    SkeletonDiff::Snapshot skeletonBase(const std::shared_ptr<IEditableCourse> &course) const;
     QUrl m_storageLocation;
     QVector<std::shared_ptr<ILanguage>> m_languages;
+    QHash<QString, ILanguage *> m_languageIds; //!> (language-id, language)
     QMap<QString, QVector<std::shared_ptr<EditableCourseResource>>> m_courses; //!> (language-id, course-resource)
+    mutable QVector<std::shared_ptr<ICourse>> m_courseList; //!> flattened m_courses, rebuilt lazily after changes
+    mutable bool m_courseListValid {false};
     QVector<std::shared_ptr<IEditableCourse>> m_skeletonResources;
+    QHash<QString, std::shared_ptr<IEditableCourse>> m_skeletonIds; //!> (skeleton-id, skeleton)
+    QHash<QString, SkeletonDiff::Snapshot> m_skeletonSnapshots;       //!> (skeleton-id, skeleton when it was loaded)
+    QHash<QString, SkeletonDiff::Snapshot> m_courseBases;             //!> (course file, skeleton at the last update of the course)
     QStringList m_loadedResources;
 };
 
@@ -10,13 +10,18 @@
 #include "core/iunit.h"
 #include "core/language.h"
 #include "core/phrase.h"
+#include "core/resources/courseparser.h"
 #include "core/resources/editablecourseresource.h"
 #include "core/resources/skeletonresource.h"
 #include "core/trainingaction.h"
+#include "core/trainingactionpool.h"
 #include "core/unit.h"
+#include "libsound/src/soundprocessor.h"
+#include <QFileInfo>
 
 EditorSession::EditorSession(QObject *parent)
     : ISessionActions(parent)
+    , m_actionPool(new TrainingActionPool(this))
 {
     connect(this, &EditorSession::courseChanged, this, &EditorSession::skeletonModeChanged);
 }
@@ -55,14 +60,18 @@ void EditorSession::setCourse(IEditableCourse *course)
         return;
     }
     m_course = course;
+    if (!m_skeletonChanges.isEmpty()) {
+        m_skeletonChanges = SkeletonDiff();
+        emit skeletonChangesChanged();
+    }
 
-    connect(course, &IEditableCourse::unitChanged, this, [=](std::shared_ptr<IEditableUnit> unit) {
-        this->updateActions(unit);
-        emit actionsChanged(); // TODO much too global effect
-    });
+    disconnect(m_courseConnection);
+    if (m_course) {
+        m_courseConnection = connect(m_course, &IEditableCourse::unitChanged, this, &EditorSession::updateActions);
+    }
     updateTrainingActions();
-    if (m_course && m_course->units().count() > 0) {
-        setActiveUnit(m_course->units().first().get());
+    if (m_course && m_course->unitCount() > 0) {
+        setActiveUnit(m_course->unitRange().first().get());
     }
     emit languageChanged();
     emit courseChanged();
@@ -78,45 +87,32 @@ IUnit *EditorSession::activeUnit() const
 
 void EditorSession::setActiveUnit(IUnit *unit)
 {
-    // checking phrases in increasing order ensures that always the first phrase is selected
-    for (int i = 0; i < m_actions.count(); ++i) {
-        for (int j = 0; j < m_actions.at(i)->actions().count(); ++j) {
-            const auto testPhrase = qobject_cast<TrainingAction *>(m_actions.at(i)->actions().at(j))->phrase();
-            if (unit == testPhrase->unit().get()) {
-                if (auto action = activeAction()) {
-                    action->setChecked(false);
-                }
-                m_indexUnit = i;
-                m_indexPhrase = j;
-                if (auto action = activeAction()) {
-                    action->setChecked(true);
-                }
-                emit phraseChanged();
-                return;
-            }
-        }
+    // unit actions always start with the unit's first phrase
+    const int unitIndex = m_unitIndex.value(unit, -1);
+    if (unitIndex >= 0 && openUnitAction(unitIndex)) {
+        selectAction(unitIndex, 0);
     }
 }
 
 void EditorSession::setActivePhrase(IPhrase *phrase)
 {
-    for (int i = 0; i < m_actions.count(); ++i) {
-        for (int j = 0; j < m_actions.at(i)->actions().count(); ++j) {
-            const auto testPhrase = qobject_cast<TrainingAction *>(m_actions.at(i)->actions().at(j))->phrase();
-            if (phrase == testPhrase) {
-                if (auto action = activeAction()) {
-                    action->setChecked(false);
-                }
-                m_indexUnit = i;
-                m_indexPhrase = j;
-                if (auto action = activeAction()) {
-                    action->setChecked(true);
-                }
-                emit phraseChanged();
-                return;
-            }
-        }
+    auto iter = m_phraseIndex.constFind(phrase);
+    if (iter != m_phraseIndex.constEnd()) {
+        selectAction(iter->first, iter->second);
+    }
+}
+
+void EditorSession::selectAction(int unitIndex, int phraseIndex)
+{
+    if (auto action = activeAction()) {
+        action->setChecked(false);
     }
+    m_indexUnit = unitIndex;
+    m_indexPhrase = phraseIndex;
+    if (auto action = activeAction()) {
+        action->setChecked(true);
+    }
+    emit phraseChanged();
 }
 
 IPhrase *EditorSession::activePhrase() const
@@ -132,9 +128,18 @@ void EditorSession::switchToPreviousPhrase()
     if (hasPreviousPhrase()) {
         if (m_indexPhrase == 0) {
             qCDebug(ARTIKULATE_CORE()) << "switching to previous unit";
-            if (m_indexUnit > 0) {
-                --m_indexUnit;
-                m_indexPhrase = m_actions.at(m_indexUnit)->actions().count() - 1;
+            // entered units are opened, units that turn out to be empty lose their action
+            int unitIndex = m_indexUnit - 1;
+            bool opened {false};
+            while (!opened && unitIndex >= 0) {
+                opened = openUnitAction(unitIndex);
+                if (!opened) {
+                    --unitIndex;
+                }
+            }
+            if (opened) {
+                m_indexUnit = unitIndex;
+                m_indexPhrase = m_actions.at(m_indexUnit)->actionsCount() - 1;
             }
         } else {
             --m_indexPhrase;
@@ -151,10 +156,16 @@ void EditorSession::switchToPreviousPhrase()
 void EditorSession::switchToNextPhrase()
 {
     if (hasNextPhrase()) {
-        if (m_indexPhrase >= m_actions.at(m_indexUnit)->actions().count() - 1) {
+        if (m_indexPhrase >= m_actions.at(m_indexUnit)->actionsCount() - 1) {
             qCDebug(ARTIKULATE_CORE()) << "switching to next unit";
-            if (m_indexUnit < m_actions.count() - 1) {
-                ++m_indexUnit;
+            // entered units are opened, units that turn out to be empty lose their action
+            const int unitIndex = m_indexUnit + 1;
+            bool opened {false};
+            while (!opened && unitIndex < m_actions.count()) {
+                opened = openUnitAction(unitIndex);
+            }
+            if (opened) {
+                m_indexUnit = unitIndex;
                 m_indexPhrase = 0;
             }
         } else {
@@ -180,7 +191,7 @@ bool EditorSession::hasNextPhrase() const
         return true;
     }
     if (m_actions.constLast()) {
-        if (m_indexPhrase < m_actions.constLast()->actions().count() - 1) {
+        if (m_indexPhrase < m_actions.constLast()->actionsCount() - 1) {
             return true;
         }
     }
@@ -196,12 +207,139 @@ void EditorSession::updateCourseFromSkeleton()
     m_repository->updateCourseFromSkeleton(m_course->self());
 }
 
+void EditorSession::previewSkeletonChanges()
+{
+    if (!m_course) {
+        qCritical() << "Not previewing skeleton changes, no course set.";
+        return;
+    }
+    m_skeletonChanges = m_repository->skeletonChanges(m_course->self());
+    emit skeletonChangesChanged();
+}
+
+void EditorSession::applySkeletonChanges()
+{
+    if (m_skeletonChanges.isEmpty()) {
+        return;
+    }
+    m_repository->applySkeletonChanges(m_skeletonChanges);
+    m_skeletonChanges = SkeletonDiff();
+    emit skeletonChangesChanged();
+}
+
+QVariantMap EditorSession::skeletonChanges() const
+{
+    QVariantMap changes;
+    if (m_skeletonChanges.isEmpty()) {
+        return changes;
+    }
+    using ChangeType = SkeletonDiff::ChangeType;
+    int retitled = 0;
+    int conflicts = 0;
+    for (const auto &change : m_skeletonChanges.changes()) {
+        if (change.type == ChangeType::UnitRetitled || change.type == ChangeType::PhraseRetitled) {
+            ++(change.conflict ? conflicts : retitled);
+        }
+    }
+    changes[QStringLiteral("added")] = m_skeletonChanges.count(ChangeType::UnitAdded) + m_skeletonChanges.count(ChangeType::PhraseAdded);
+    // unit moves are not applied, courses keep their own unit order
+    changes[QStringLiteral("moved")] = m_skeletonChanges.count(ChangeType::PhraseMoved);
+    changes[QStringLiteral("retitled")] = retitled;
+    changes[QStringLiteral("conflicts")] = conflicts;
+    changes[QStringLiteral("removed")] = m_skeletonChanges.count(ChangeType::UnitRemoved) + m_skeletonChanges.count(ChangeType::PhraseRemoved);
+    return changes;
+}
+
+void EditorSession::updateCoursesFromSkeleton()
+{
+    if (!m_course || !skeletonMode()) {
+        qCritical() << "Not updating courses from skeleton, no skeleton set.";
+        return;
+    }
+    m_repository->updateCoursesFromSkeleton(m_course->self());
+}
+
+void EditorSession::normalizeSoundFiles()
+{
+    if (!m_course) {
+        qCritical() << "Not normalizing sound files, no course set.";
+        return;
+    }
+    if (!SoundProcessor::isAvailable()) {
+        qCWarning(ARTIKULATE_LOG) << "Sound processing is not supported by this build";
+        return;
+    }
+    if (isProcessingSoundFiles()) {
+        return;
+    }
+    if (!m_soundProcessor) {
+        m_soundProcessor = new SoundProcessor(this);
+        connect(m_soundProcessor, &SoundProcessor::fileProcessed, this, &EditorSession::soundFileProcessed);
+        connect(m_soundProcessor, &SoundProcessor::progressChanged, this, [=](int processed, int total) {
+            m_processedSoundFiles = processed;
+            m_totalSoundFiles = total;
+            emit soundFileProgressChanged();
+        });
+        connect(m_soundProcessor, &SoundProcessor::finished, this, &EditorSession::processingSoundFilesChanged);
+    }
+
+    QStringList files;
+    const auto addFile = [&files](const QUrl &sound) {
+        const QString file = sound.toLocalFile();
+        if (!file.isEmpty() && QFileInfo::exists(file)) {
+            files.append(file);
+        }
+    };
+    for (const auto &unit : m_course->unitRange()) {
+        if (!unit->isLoaded()) {
+            // recordings of units that are not opened are read from their source
+            const auto phrases = CourseParser::scanPhrases(unit->source(), m_course->file());
+            for (const auto &phrase : phrases) {
+                addFile(phrase.sound);
+            }
+            continue;
+        }
+        for (const auto &phrase : unit->phraseRange()) {
+            addFile(phrase->sound());
+        }
+    }
+    m_soundProcessor->process(files);
+    emit processingSoundFilesChanged();
+}
+
+void EditorSession::cancelSoundFileProcessing()
+{
+    if (m_soundProcessor) {
+        m_soundProcessor->cancel();
+    }
+}
+
+bool EditorSession::isSoundProcessingAvailable() const
+{
+    return SoundProcessor::isAvailable();
+}
+
+bool EditorSession::isProcessingSoundFiles() const
+{
+    return m_soundProcessor && m_soundProcessor->isRunning();
+}
+
+int EditorSession::processedSoundFiles() const
+{
+    return m_processedSoundFiles;
+}
+
+int EditorSession::totalSoundFiles() const
+{
+    return m_totalSoundFiles;
+}
+
 TrainingAction *EditorSession::activeAction() const
 {
     if (m_indexUnit < 0 || m_indexPhrase < 0) {
         return nullptr;
     }
-    return qobject_cast<TrainingAction *>(m_actions.at(m_indexUnit)->actions().at(m_indexPhrase));
+    return m_actions.at(m_indexUnit)->action(m_indexPhrase);
 }
 
 void EditorSession::updateTrainingActions()
@@ -211,6 +349,13 @@ void EditorSession::updateTrainingActions()
         action->deleteLater();
     }
     m_actions.clear();
+    m_phraseIndex.clear();
+    m_unitIndex.clear();
+    m_actionUnits.clear();
+    for (const auto &connection : qAsConst(m_unitConnections)) {
+        disconnect(connection);
+    }
+    m_unitConnections.clear();
 
     if (!m_course) {
         m_indexUnit = -1;
@@ -218,26 +363,42 @@ void EditorSession::updateTrainingActions()
         return;
     }
 
-    const auto unitList = m_course->units();
-    for (const auto &unit : qAsConst(unitList)) {
-        auto action = new TrainingAction(unit->title(), this);
-        const auto phraseList = unit->phrases();
-        for (const auto &phrase : qAsConst(phraseList)) {
-            action->appendAction(new TrainingAction(phrase, this, unit.get()));
-        }
-        if (action->actions().count() > 0) {
-            m_actions.append(action);
-        } else {
-            action->deleteLater();
+    for (const auto &unit : m_course->unitRange()) {
+        // single phrase changes are patched into the existing actions
+        Unit *unitPtr = unit.get();
+        m_unitConnections.append(connect(unitPtr, &IUnit::phraseAboutToBeAdded, this, [=](std::shared_ptr<IPhrase> phrase, int index) {
+            insertPhraseAction(unitPtr, phrase, index);
+        }));
+        m_unitConnections.append(connect(unitPtr, &IUnit::phraseAboutToBeRemoved, this, [=](int index) {
+            removePhraseAction(unitPtr, index);
+        }));
+        m_unitConnections.append(connect(unitPtr, &IUnit::phrasesReset, this, [=]() {
+            resetPhraseActions(unitPtr);
+        }));
+        m_unitConnections.append(connect(unitPtr, &Unit::loaded, this, [=]() {
+            fillPhraseActions(unitPtr);
+        }));
+
+        // only the headers of units that are not loaded are known, they get their phrase actions when opened
+        if (unit->isLoaded() && unit->phraseCount() == 0) {
+            continue;
         }
+        const int unitIndex = m_actions.count();
+        auto action = new TrainingAction(unit->title(), m_actionPool, this);
+        connect(action, &TrainingAction::triggered, unitPtr, &Unit::ensureLoaded);
+        action->setPhrases(unit->phraseRange());
+        m_actions.append(action);
+        m_actionUnits.append(unitPtr);
+        m_unitIndex.insert(unitPtr, unitIndex);
+        updatePhraseIndex(unitIndex, 0);
     }
 
     // update indices
     m_indexUnit = -1;
     m_indexPhrase = -1;
-    if (m_course->units().count() > 0) {
+    if (!m_actions.isEmpty()) {
         m_indexUnit = 0;
-        if (m_course->units().constFirst()->phrases().count() > 0) {
+        if (m_actions.first()->actionsCount() > 0) {
             m_indexPhrase = 0;
         }
     }
@@ -246,23 +407,134 @@ void EditorSession::updateTrainingActions()
 
 void EditorSession::updateActions(std::shared_ptr<IEditableUnit> changedUnit)
 {
-    int unitIndex = -1;
-    for (int i = 0; i < m_course->units().size(); ++i) {
-        if (changedUnit == m_course->units().at(i)) {
-            unitIndex = i;
-            break;
+    // phrase changes of units with actions are already patched, only a unit that gains its first
+    // or loses its last phrase changes the unit level of the action tree
+    const bool hasUnitAction = m_unitIndex.contains(changedUnit.get());
+    if (hasUnitAction == (changedUnit->phraseCount() > 0)) {
+        return;
+    }
+    IPhrase *phrase = activePhrase();
+    updateTrainingActions();
+    if (phrase) {
+        setActivePhrase(phrase);
+    }
+}
+
+void EditorSession::insertPhraseAction(IUnit *unit, std::shared_ptr<IPhrase> phrase, int index)
+{
+    auto iter = m_unitIndex.constFind(unit);
+    if (iter == m_unitIndex.constEnd()) {
+        return; // unit gets its first phrase, handled by updateActions
+    }
+    const int unitIndex = iter.value();
+    m_actions.at(unitIndex)->insertPhrase(index, phrase);
+    updatePhraseIndex(unitIndex, index);
+    if (m_indexUnit == unitIndex) {
+        if (m_indexPhrase >= index) {
+            ++m_indexPhrase;
         }
+        emit phraseChanged();
+    }
+}
+
+void EditorSession::removePhraseAction(IUnit *unit, int index)
+{
+    auto iter = m_unitIndex.constFind(unit);
+    if (iter == m_unitIndex.constEnd()) {
+        return;
     }
-    Q_ASSERT(unitIndex >= 0);
+    const int unitIndex = iter.value();
     auto unitAction = m_actions.at(unitIndex);
+    if (unitAction->actionsCount() <= 1) {
+        return; // unit loses its last phrase, handled by updateActions
+    }
+    m_phraseIndex.remove(unitAction->phraseAt(index));
+    unitAction->removeAction(index);
+    updatePhraseIndex(unitIndex, index);
+    if (m_indexUnit == unitIndex) {
+        if (m_indexPhrase > index) {
+            --m_indexPhrase;
+        } else if (m_indexPhrase == index) {
+            m_indexPhrase = qMin(index, unitAction->actionsCount() - 1);
+            if (auto action = activeAction()) {
+                action->setChecked(true);
+            }
+        }
+        emit phraseChanged();
+    }
+}
 
-    // TODO this is a heavy operation if only one phrase was changed
-    unitAction->clearActions();
-    for (int i = 0; i < changedUnit->phrases().size(); ++i) {
-        unitAction->appendAction(new TrainingAction(changedUnit->phrases().at(i), this, changedUnit.get()));
+void EditorSession::resetPhraseActions(IUnit *unit)
+{
+    auto iter = m_unitIndex.constFind(unit);
+    if (iter == m_unitIndex.constEnd() || unit->phraseCount() == 0) {
+        return; // unit level changes are handled by updateActions
+    }
+    const int unitIndex = iter.value();
+    auto unitAction = m_actions.at(unitIndex);
+    IPhrase *phrase = m_indexUnit == unitIndex ? activePhrase() : nullptr;
+    for (int i = 0; i < unitAction->actionsCount(); ++i) {
+        m_phraseIndex.remove(unitAction->phraseAt(i));
+    }
+    unitAction->setPhrases(unit->phraseRange());
+    updatePhraseIndex(unitIndex, 0);
+    if (m_indexUnit == unitIndex) {
+        const int phraseIndex = phrase ? unit->indexOf(phrase) : -1;
+        m_indexPhrase = phraseIndex >= 0 ? phraseIndex : qMin(m_indexPhrase, unitAction->actionsCount() - 1);
+        if (auto action = activeAction()) {
+            action->setChecked(true);
+        }
+        emit phraseChanged();
     }
+}
 
-    emit unitAction->actionsChanged();
+void EditorSession::fillPhraseActions(Unit *unit)
+{
+    const int unitIndex = m_unitIndex.value(unit, -1);
+    if (unitIndex < 0) {
+        return;
+    }
+    if (unit->phraseCount() == 0) {
+        removeUnitAction(unitIndex);
+        return;
+    }
+    m_actions.at(unitIndex)->setPhrases(unit->phraseRange());
+    updatePhraseIndex(unitIndex, 0);
+}
+
+bool EditorSession::openUnitAction(int unitIndex)
+{
+    Unit *unit = m_actionUnits.at(unitIndex);
+    unit->ensureLoaded();
+    return m_unitIndex.contains(unit);
+}
+
+void EditorSession::removeUnitAction(int unitIndex)
+{
+    auto action = m_actions.takeAt(unitIndex);
+    action->clearActions();
+    action->deleteLater();
+    m_unitIndex.remove(m_actionUnits.takeAt(unitIndex));
+    for (int i = unitIndex; i < m_actions.count(); ++i) {
+        m_unitIndex.insert(m_actionUnits.at(i), i);
+        updatePhraseIndex(i, 0);
+    }
+    if (m_indexUnit > unitIndex) {
+        --m_indexUnit;
+    } else if (m_indexUnit == unitIndex) {
+        // the entered unit had no phrase that could have been selected
+        m_indexUnit = qMin(unitIndex, m_actions.count() - 1);
+        m_indexPhrase = -1;
+    }
+    emit actionsChanged();
+}
+
+void EditorSession::updatePhraseIndex(int unitIndex, int firstPhraseIndex)
+{
+    const auto unitAction = m_actions.at(unitIndex);
+    for (int i = firstPhraseIndex; i < unitAction->actionsCount(); ++i) {
+        m_phraseIndex.insert(unitAction->phraseAt(i), qMakePair(unitIndex, i));
+    }
 }
 
 QVector<TrainingAction *> EditorSession::trainingActions() const
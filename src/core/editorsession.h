@@ -10,6 +10,10 @@
 #include "artikulatecore_export.h"
 #include "isessionactions.h"
 #include "phrase.h"
+#include "resources/skeletondiff.h"
+#include <QHash>
+#include <QPair>
+#include <QVariantMap>
 #include <memory.h>
 
 class ILanguage;
@@ -19,6 +23,8 @@ class Unit;
 class IPhrase;
 class SkeletonResource;
 class IEditableRepository;
+class SoundProcessor;
+class TrainingActionPool;
 
 /**
  * \class EditorSession
@@ -37,6 +43,22 @@ class ARTIKULATECORE_EXPORT EditorSession : public ISessionActions
     Q_PROPERTY(IPhrase *phrase READ activePhrase WRITE setActivePhrase NOTIFY phraseChanged)
     Q_PROPERTY(bool hasNextPhrase READ hasNextPhrase NOTIFY phraseChanged)
     Q_PROPERTY(bool hasPreviousPhrase READ hasPreviousPhrase NOTIFY phraseChanged)
+    /**
+     * @brief true if this build can normalize sound files
+     */
+    Q_PROPERTY(bool soundProcessingAvailable READ isSoundProcessingAvailable CONSTANT)
+    /**
+     * @brief true while sound files of the course are normalized
+     */
+    Q_PROPERTY(bool processingSoundFiles READ isProcessingSoundFiles NOTIFY processingSoundFilesChanged)
+    Q_PROPERTY(int processedSoundFiles READ processedSoundFiles NOTIFY soundFileProgressChanged)
+    Q_PROPERTY(int totalSoundFiles READ totalSoundFiles NOTIFY soundFileProgressChanged)
+    /**
+     * @brief number of previewed skeleton changes by kind: added, moved, retitled, conflicts and removed
+     *
+     * Empty if no changes are previewed, see previewSkeletonChanges().
+     */
+    Q_PROPERTY(QVariantMap skeletonChanges READ skeletonChanges NOTIFY skeletonChangesChanged)
 
 public:
     explicit EditorSession(QObject *parent = nullptr);
@@ -55,6 +77,30 @@ public:
     Q_INVOKABLE void switchToPreviousPhrase();
     Q_INVOKABLE void switchToNextPhrase();
     Q_INVOKABLE void updateCourseFromSkeleton();
+    /**
+     * @brief compute all changes of the current course against its skeleton, including removals
+     */
+    Q_INVOKABLE void previewSkeletonChanges();
+    /**
+     * @brief apply the previewed skeleton changes, which unlinks elements removed from the skeleton
+     */
+    Q_INVOKABLE void applySkeletonChanges();
+    QVariantMap skeletonChanges() const;
+    /**
+     * @brief update all courses derived from the current skeleton, see IEditableRepository::updateCoursesFromSkeleton()
+     */
+    Q_INVOKABLE void updateCoursesFromSkeleton();
+    /**
+     * @brief trim silence and normalize loudness of all sound files of the current course
+     *
+     * The files are processed in the background, progress is reported per file.
+     */
+    Q_INVOKABLE void normalizeSoundFiles();
+    Q_INVOKABLE void cancelSoundFileProcessing();
+    bool isSoundProcessingAvailable() const;
+    bool isProcessingSoundFiles() const;
+    int processedSoundFiles() const;
+    int totalSoundFiles() const;
     TrainingAction *activeAction() const override;
     QVector<TrainingAction *> trainingActions() const override;
 
@@ -62,17 +108,46 @@ Q_SIGNALS:
     void skeletonModeChanged();
     void languageChanged();
     void unitChanged();
+    void processingSoundFilesChanged();
+    void soundFileProgressChanged();
+    void soundFileProcessed(const QString &file, bool success);
+    void skeletonChangesChanged();
 
 private:
     Q_DISABLE_COPY(EditorSession)
     void updateTrainingActions();
     void updateActions(std::shared_ptr<IEditableUnit> unit);
+    void insertPhraseAction(IUnit *unit, std::shared_ptr<IPhrase> phrase, int index);
+    void removePhraseAction(IUnit *unit, int index);
+    void resetPhraseActions(IUnit *unit);
+    /**
+     * @brief create the phrase actions of @p unit after its phrases were loaded
+     */
+    void fillPhraseActions(Unit *unit);
+    /**
+     * @brief load the unit of the unit action at @p unitIndex
+     * @return false if the unit turned out to be empty and its action was removed
+     */
+    bool openUnitAction(int unitIndex);
+    void removeUnitAction(int unitIndex);
+    void updatePhraseIndex(int unitIndex, int firstPhraseIndex);
+    void selectAction(int unitIndex, int phraseIndex);
     IEditableRepository *m_repository {nullptr};
     bool m_editSkeleton {false};
     IEditableCourse *m_course {nullptr};
+    TrainingActionPool *m_actionPool;
     QVector<TrainingAction *> m_actions;
+    QHash<const IPhrase *, QPair<int, int>> m_phraseIndex; //!< phrase to (unit action, phrase action) index
+    QHash<const IUnit *, int> m_unitIndex;                //!< unit to unit action index
+    QVector<Unit *> m_actionUnits;                        //!< unit of each unit action
+    QVector<QMetaObject::Connection> m_unitConnections;
+    QMetaObject::Connection m_courseConnection;
     int m_indexUnit {-1};
     int m_indexPhrase {-1};
+    SoundProcessor *m_soundProcessor {nullptr};
+    int m_processedSoundFiles {0};
+    int m_totalSoundFiles {0};
+    SkeletonDiff m_skeletonChanges; //!< previewed changes of the current course
 };
 
 #endif
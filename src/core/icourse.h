@@ -8,6 +8,7 @@
 #define ICOURSE_H
 
 #include "artikulatecore_export.h"
+#include "constrange.h"
 #include <QMap>
 #include <QObject>
 #include <QUrl>
@@ -42,6 +43,13 @@ public:
      * @return list of units in course
      */
     virtual QVector<std::shared_ptr<Unit>> units() = 0;
+    /**
+     * @brief view on the units without copying the unit list, loads the units if needed
+     *
+     * The view is invalidated by adding or removing units.
+     */
+    virtual ConstRange<std::shared_ptr<Unit>> unitRange() = 0;
+    virtual int unitCount() = 0;
     virtual QUrl file() const = 0;
 
 protected:
@@ -47,11 +47,21 @@ public:
     Q_INVOKABLE virtual bool sync() = 0;
     /**
      * @brief Update course from skeleton
-     * This method imports all units and phrases from the specified skeleton
+     * This method adds, moves and retitles units and phrases according to the specified skeleton
+     * as one batch. Units and phrases whose skeleton element was removed stay linked, removals are
+     * only applied through a previewed SkeletonDiff.
      *
      * @param skeleton
      */
     virtual void updateFrom(std::shared_ptr<ICourse> skeleton) = 0;
+    /**
+     * @brief start a batch of changes to the units of this course
+     *
+     * All units, including those added during the batch, defer their phrase signals until the
+     * matching endUpdate() call, see IEditableUnit::beginUpdate(). Batches can be nested.
+     */
+    virtual void beginUpdate() = 0;
+    virtual void endUpdate() = 0;
     virtual bool isModified() const = 0;
     virtual std::shared_ptr<IEditableCourse> self() const = 0;
 
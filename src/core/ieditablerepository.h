@@ -9,6 +9,7 @@
 
 #include "artikulatecore_export.h"
 #include "iresourcerepository.h"
+#include "resources/skeletondiff.h"
 #include <memory>
 
 class IEditableCourse;
@@ -28,11 +29,27 @@ public:
     virtual std::shared_ptr<IEditableCourse> editableCourse(std::shared_ptr<ILanguage> language, int index) const = 0;
     virtual QVector<std::shared_ptr<IEditableCourse>> skeletons() const = 0;
     /**
-     * Imports units and phrases from skeleton, deassociates removed ones.
+     * Imports, moves and retitles units and phrases from skeleton. Removed ones stay associated,
+     * they are only deassociated by applying previewed changes, see skeletonChanges().
      *
      * \param course the course to be updated
      */
     virtual void updateCourseFromSkeleton(std::shared_ptr<IEditableCourse> course) = 0;
+    /**
+     * Updates all courses derived from \p skeleton like updateCourseFromSkeleton(). The changes of
+     * the courses of all languages are computed in parallel and applied on the GUI thread.
+     *
+     * \param skeleton the skeleton whose courses shall be updated
+     */
+    virtual void updateCoursesFromSkeleton(std::shared_ptr<IEditableCourse> skeleton) = 0;
+    /**
+     * \return all changes of \p course against its skeleton including removals, for preview
+     */
+    virtual SkeletonDiff skeletonChanges(std::shared_ptr<IEditableCourse> course) const = 0;
+    /**
+     * Applies previewed changes \p diff to its course, see skeletonChanges()
+     */
+    virtual void applySkeletonChanges(const SkeletonDiff &diff) = 0;
 
 Q_SIGNALS:
     void skeletonAboutToBeAdded(std::shared_ptr<IEditableCourse>, int);
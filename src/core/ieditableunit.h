@@ -34,6 +34,15 @@ public:
     virtual void setI18nTitle(const QString &title) = 0;
     virtual void addPhrase(std::shared_ptr<IEditablePhrase> phrase, int index) = 0;
     virtual void removePhrase(std::shared_ptr<IPhrase> phrase) = 0;
+    /**
+     * @brief start a batch of phrase changes
+     *
+     * Until the matching endUpdate() call, adding and removing phrases does not emit per phrase
+     * signals. Instead, phrasesAboutToBeReset() is emitted before the first change and
+     * phrasesReset() after the outermost batch ended. Batches can be nested.
+     */
+    virtual void beginUpdate() = 0;
+    virtual void endUpdate() = 0;
 
 Q_SIGNALS:
     void modified();
@@ -8,6 +8,7 @@
 #define IRESOURCEREPOSITORY_H
 
 #include "artikulatecore_export.h"
+#include "constrange.h"
 #include <QObject>
 #include <memory>
 
@@ -35,12 +36,33 @@ public:
      */
     virtual QVector<std::shared_ptr<ICourse>> courses() const = 0;
 
+    /**
+     * @brief view on all loaded courses in the order of courses() without copying the course list
+     *
+     * The view is invalidated by adding or removing courses.
+     */
+    virtual ConstRange<std::shared_ptr<ICourse>> courseRange() const = 0;
+
+    virtual int courseCount() const = 0;
+
+    /**
+     * @return course at position @p index of courses()
+     */
+    virtual std::shared_ptr<ICourse> course(int index) const = 0;
+
     /**
      * @param language to use for filtering
      * @return list of all loaded courses filtered by the named language
      */
     virtual QVector<std::shared_ptr<ICourse>> courses(const QString &languageId) const = 0;
 
+    /**
+     * @brief view on the courses of language @p languageId without copying, all courses for an empty identifier
+     *
+     * The view is invalidated by adding or removing courses.
+     */
+    virtual ConstRange<std::shared_ptr<ICourse>> courseRange(const QString &languageId) const = 0;
+
     /**
      * @brief Requests a refresh of all resources
      *
@@ -53,7 +75,15 @@ public:
      */
     virtual QVector<std::shared_ptr<ILanguage>> languages() const = 0;
 
+    /**
+     * @brief view on all available languages in the order of languages() without copying the language list
+     */
+    virtual ConstRange<std::shared_ptr<ILanguage>> languageRange() const = 0;
+
 Q_SIGNALS:
+    /**
+     * @brief emitted before @p course is inserted at position @p index of courses()
+     */
     void courseAboutToBeAdded(std::shared_ptr<ICourse>, int index);
     void courseAdded();
     void courseAboutToBeRemoved(int);
@@ -8,6 +8,7 @@
 #define IUNIT_H
 
 #include "artikulatecore_export.h"
+#include "constrange.h"
 #include <QMap>
 #include <QObject>
 #include <QUrl>
@@ -33,6 +34,19 @@ public:
     virtual QString title() const = 0;
     virtual QString i18nTitle() const = 0;
     virtual QVector<std::shared_ptr<IPhrase>> phrases() const = 0;
+    /**
+     * @brief view on the phrases without copying the phrase list, invalidated by adding or removing phrases
+     */
+    virtual ConstRange<std::shared_ptr<IPhrase>> phraseRange() const = 0;
+    virtual int phraseCount() const = 0;
+    /**
+     * @return position of @p phrase in this unit or -1 if it is not contained
+     */
+    virtual int indexOf(const IPhrase *phrase) const = 0;
+    /**
+     * @return phrase with identifier @p id or nullptr if no such phrase exists
+     */
+    virtual std::shared_ptr<IPhrase> findPhrase(const QString &id) const = 0;
     virtual std::shared_ptr<IUnit> self() const = 0;
 
 Q_SIGNALS:
@@ -45,6 +59,14 @@ Q_SIGNALS:
     void phraseAdded(std::shared_ptr<IPhrase>);
     void phraseAboutToBeRemoved(int);
     void phraseRemoved();
+    /**
+     * @brief emitted before the first phrase change of a batch, see IEditableUnit::beginUpdate()
+     */
+    void phrasesAboutToBeReset();
+    /**
+     * @brief emitted once all phrase changes of a batch are applied
+     */
+    void phrasesReset();
 
 protected:
     IUnit(QObject *parent = nullptr)
@@ -18,6 +18,7 @@
 std::shared_ptr<Language> Language::create(QUrl file)
 {
     auto language = std::shared_ptr<Language>(new Language());
+    language->setFile(file);
     // load basic information from language file, but does not parse everything
     QXmlStreamReader xml;
     QFile handle(file.toLocalFile());
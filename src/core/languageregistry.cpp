@@ -0,0 +1,79 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "languageregistry.h"
+#include "artikulate_debug.h"
+#include "language.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+namespace
+{
+const QString builtInLanguageDirectory = QStringLiteral(":/artikulate/languages/");
+}
+
+LanguageRegistry *LanguageRegistry::instance()
+{
+    static LanguageRegistry registry;
+    return &registry;
+}
+
+QVector<std::shared_ptr<Language>> LanguageRegistry::languages()
+{
+    QMutexLocker locker(&m_mutex);
+    loadBuiltInLanguages();
+    return m_builtInLanguages;
+}
+
+std::shared_ptr<Language> LanguageRegistry::language(const QString &id)
+{
+    QMutexLocker locker(&m_mutex);
+    loadBuiltInLanguages();
+    return m_ids.value(id);
+}
+
+std::shared_ptr<Language> LanguageRegistry::load(const QUrl &file)
+{
+    QMutexLocker locker(&m_mutex);
+    return loadFile(file.toLocalFile());
+}
+
+std::shared_ptr<Language> LanguageRegistry::loadFile(const QString &file)
+{
+    const QString path = QFileInfo(file).absoluteFilePath();
+    auto iter = m_files.constFind(path);
+    if (iter != m_files.constEnd()) {
+        return iter.value();
+    }
+    auto language = Language::create(QUrl::fromLocalFile(path));
+    m_files.insert(path, language);
+    if (language && !language->id().isEmpty()) {
+        if (m_ids.contains(language->id())) {
+            qCWarning(ARTIKULATE_CORE()) << "Language" << language->id() << "is specified by several files, using first one";
+        } else {
+            m_ids.insert(language->id(), language);
+        }
+    }
+    return language;
+}
+
+void LanguageRegistry::loadBuiltInLanguages()
+{
+    if (m_builtInLoaded) {
+        return;
+    }
+    m_builtInLoaded = true;
+    QDir dir(builtInLanguageDirectory);
+    dir.setFilter(QDir::Files | QDir::NoSymLinks);
+    const QFileInfoList list = dir.entryInfoList();
+    for (const auto &fileInfo : list) {
+        if (fileInfo.completeSuffix() != QLatin1String("xml")) {
+            continue;
+        }
+        m_builtInLanguages.append(loadFile(fileInfo.absoluteFilePath()));
+    }
+}
@@ -0,0 +1,58 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef LANGUAGEREGISTRY_H
+#define LANGUAGEREGISTRY_H
+
+#include "artikulatecore_export.h"
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QUrl>
+#include <QVector>
+#include <memory>
+
+class Language;
+
+/**
+ * \class LanguageRegistry
+ * Process wide registry of parsed language specifications.
+ *
+ * Each language file is parsed only once and the resulting language object is shared by all
+ * repositories. Shared languages must be treated as immutable.
+ */
+class ARTIKULATECORE_EXPORT LanguageRegistry
+{
+public:
+    static LanguageRegistry *instance();
+
+    /**
+     * @return languages of all files in the application's language resource directory, parsed on first call
+     */
+    QVector<std::shared_ptr<Language>> languages();
+    /**
+     * @return language with identifier @p id or nullptr if no such language is loaded
+     */
+    std::shared_ptr<Language> language(const QString &id);
+    /**
+     * @return language parsed from @p file, repeated calls for the same file return the same object
+     */
+    std::shared_ptr<Language> load(const QUrl &file);
+
+private:
+    LanguageRegistry() = default;
+    Q_DISABLE_COPY(LanguageRegistry)
+    std::shared_ptr<Language> loadFile(const QString &file);
+    void loadBuiltInLanguages();
+
+    QMutex m_mutex;
+    QHash<QString, std::shared_ptr<Language>> m_files; //!< (file path, language)
+    QHash<QString, std::shared_ptr<Language>> m_ids;   //!< (language identifier, language)
+    QVector<std::shared_ptr<Language>> m_builtInLanguages;
+    bool m_builtInLoaded {false};
+};
+
+#endif
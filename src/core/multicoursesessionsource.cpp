@@ -0,0 +1,94 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "multicoursesessionsource.h"
+#include "icourse.h"
+#include "unit.h"
+
+MultiCourseSessionSource::MultiCourseSessionSource(const QVector<std::shared_ptr<ICourse>> &courses, int openCourses)
+    : m_openCourses(qMax(1, openCourses))
+{
+    m_cursors.reserve(courses.count());
+    for (const auto &course : courses) {
+        Cursor cursor;
+        cursor.course = course;
+        m_cursors.append(cursor);
+    }
+    reset();
+}
+
+MultiCourseSessionSource::~MultiCourseSessionSource() = default;
+
+SessionSource::Entry MultiCourseSessionSource::next()
+{
+    // round robin over the active courses, an exhausted course is replaced by the next course
+    while (!m_active.isEmpty()) {
+        m_current %= m_active.count();
+        Cursor &cursor = m_cursors[m_active.at(m_current)];
+        if (auto phrase = advance(cursor)) {
+            ++m_current;
+            return Entry {phrase, cursor.course};
+        }
+        if (m_nextCursor < m_cursors.count()) {
+            m_active[m_current] = m_nextCursor++;
+        } else {
+            m_active.removeAt(m_current);
+        }
+    }
+    return Entry();
+}
+
+void MultiCourseSessionSource::reset()
+{
+    for (auto &cursor : m_cursors) {
+        cursor.exhausted = false;
+        cursor.unit = 0;
+        cursor.phrase = 0;
+    }
+    m_active.clear();
+    for (m_nextCursor = 0; m_nextCursor < qMin(m_openCourses, m_cursors.count()); ++m_nextCursor) {
+        m_active.append(m_nextCursor);
+    }
+    m_current = 0;
+}
+
+int MultiCourseSessionSource::openedCourses() const
+{
+    int count {0};
+    for (const auto &cursor : m_cursors) {
+        if (cursor.opened) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::shared_ptr<IPhrase> MultiCourseSessionSource::advance(Cursor &cursor)
+{
+    if (cursor.exhausted) {
+        return nullptr;
+    }
+    if (!cursor.opened) {
+        cursor.opened = true;
+        cursor.progress = progressValues(cursor.course.get());
+    }
+    // units are read in place, a course may change its units between two calls
+    while (cursor.unit < cursor.course->unitCount()) {
+        const auto unit = cursor.course->unitRange().at(cursor.unit);
+        unit->ensureLoaded();
+        const auto phrases = unit->phraseRange();
+        while (cursor.phrase < phrases.count()) {
+            const auto phrase = phrases.at(cursor.phrase++);
+            if (accepts(phrase.get(), cursor.progress)) {
+                return phrase;
+            }
+        }
+        ++cursor.unit;
+        cursor.phrase = 0;
+    }
+    cursor.exhausted = true;
+    return nullptr;
+}
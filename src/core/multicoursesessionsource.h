@@ -0,0 +1,55 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef MULTICOURSESESSIONSOURCE_H
+#define MULTICOURSESESSIONSOURCE_H
+
+#include "artikulatecore_export.h"
+#include "sessionsource.h"
+#include <QVector>
+
+/**
+ * \class MultiCourseSessionSource
+ * Interleaves the phrases of several courses, taking one phrase of each open course in turn.
+ *
+ * Only a small number of courses is open at the same time, the next course is opened once an
+ * open course is exhausted. Hence the unit list of a course, which may trigger loading the
+ * course file, is only requested when the stream draws the first phrase from this course.
+ */
+class ARTIKULATECORE_EXPORT MultiCourseSessionSource : public SessionSource
+{
+public:
+    /**
+     * @param openCourses number of courses that are interleaved at the same time
+     */
+    explicit MultiCourseSessionSource(const QVector<std::shared_ptr<ICourse>> &courses, int openCourses = 2);
+    ~MultiCourseSessionSource() override;
+    Entry next() override;
+    void reset() override;
+    /**
+     * @return number of courses whose units were requested so far
+     */
+    int openedCourses() const;
+
+private:
+    struct Cursor {
+        std::shared_ptr<ICourse> course;
+        bool opened {false};
+        bool exhausted {false};
+        QHash<QString, int> progress;
+        int unit {0};
+        int phrase {0};
+    };
+    std::shared_ptr<IPhrase> advance(Cursor &cursor);
+
+    QVector<Cursor> m_cursors;
+    QVector<int> m_active; //!< cursors that are interleaved currently
+    int m_openCourses {2};
+    int m_nextCursor {0}; //!< first cursor that was not interleaved yet
+    int m_current {0};    //!< position in m_active
+};
+
+#endif
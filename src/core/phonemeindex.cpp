@@ -0,0 +1,60 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "phonemeindex.h"
+#include "iphrase.h"
+#include "phoneme.h"
+#include <QSet>
+
+void PhonemeIndex::clear()
+{
+    m_phrases.clear();
+}
+
+void PhonemeIndex::addPhrase(IPhrase *phrase)
+{
+    const auto phonemes = phrase->phonemes();
+    for (const auto phoneme : phonemes) {
+        m_phrases[phoneme->id()].append(phrase);
+    }
+}
+
+QVector<IPhrase *> PhonemeIndex::phrases(const QString &phonemeId) const
+{
+    return m_phrases.value(phonemeId);
+}
+
+QStringList PhonemeIndex::phonemes() const
+{
+    return m_phrases.keys();
+}
+
+bool PhonemeIndex::isEmpty() const
+{
+    return m_phrases.isEmpty();
+}
+
+QVector<IPhrase *> PhonemeIndex::collect(const QStringList &phonemeIds, int maximum) const
+{
+    QVector<IPhrase *> result;
+    QSet<IPhrase *> seen;
+    for (const auto &id : phonemeIds) {
+        auto iter = m_phrases.constFind(id);
+        if (iter == m_phrases.constEnd()) {
+            continue;
+        }
+        for (const auto phrase : iter.value()) {
+            if (result.count() >= maximum) {
+                return result;
+            }
+            if (!seen.contains(phrase)) {
+                seen.insert(phrase);
+                result.append(phrase);
+            }
+        }
+    }
+    return result;
+}
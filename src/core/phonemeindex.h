@@ -0,0 +1,42 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PHONEMEINDEX_H
+#define PHONEMEINDEX_H
+
+#include "artikulatecore_export.h"
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+class IPhrase;
+
+/**
+ * \class PhonemeIndex
+ * Inverted index from phoneme identifiers to the phrases that exercise them.
+ */
+class ARTIKULATECORE_EXPORT PhonemeIndex
+{
+public:
+    void clear();
+    void addPhrase(IPhrase *phrase);
+    /**
+     * @return phrases containing phoneme @p phonemeId in insertion order
+     */
+    QVector<IPhrase *> phrases(const QString &phonemeId) const;
+    QStringList phonemes() const;
+    bool isEmpty() const;
+    /**
+     * @brief collect phrases for @p phonemeIds, phrases of earlier phonemes come first
+     * @return at most @p maximum distinct phrases
+     */
+    QVector<IPhrase *> collect(const QStringList &phonemeIds, int maximum) const;
+
+private:
+    QHash<QString, QVector<IPhrase *>> m_phrases;
+};
+
+#endif
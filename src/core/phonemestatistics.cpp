@@ -0,0 +1,102 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "phonemestatistics.h"
+#include "iphrase.h"
+#include "liblearnerprofile/src/profilemanager.h"
+#include "phoneme.h"
+#include <QPair>
+#include <QVector>
+#include <algorithm>
+
+namespace
+{
+const QString attemptsContainer {QStringLiteral("phoneme-attempts")};
+const QString successesContainer {QStringLiteral("phoneme-successes")};
+}
+
+PhonemeStatistics::PhonemeStatistics(LearnerProfile::ProfileManager *manager)
+    : m_manager(manager)
+{
+}
+
+void PhonemeStatistics::load(LearnerProfile::Learner *learner, LearnerProfile::LearningGoal *goal)
+{
+    clear();
+    m_learner = learner;
+    m_goal = goal;
+    if (!m_manager || !m_learner || !m_goal) {
+        return;
+    }
+    const auto attempts = m_manager->progressValues(m_learner, m_goal, attemptsContainer);
+    const auto successes = m_manager->progressValues(m_learner, m_goal, successesContainer);
+    for (auto iter = attempts.constBegin(); iter != attempts.constEnd(); ++iter) {
+        m_entries.insert(iter.key(), Entry {iter.value(), successes.value(iter.key())});
+    }
+}
+
+void PhonemeStatistics::clear()
+{
+    m_entries.clear();
+    m_learner = nullptr;
+    m_goal = nullptr;
+}
+
+LearnerProfile::LearningGoal *PhonemeStatistics::goal() const
+{
+    return m_goal;
+}
+
+void PhonemeStatistics::record(const IPhrase *phrase, bool success)
+{
+    const auto phonemes = phrase->phonemes();
+    const bool store = m_manager && m_learner && m_goal && !phonemes.isEmpty();
+    if (store) {
+        m_manager->beginTransaction();
+    }
+    for (const auto phoneme : phonemes) {
+        Entry &entry = m_entries[phoneme->id()];
+        ++entry.attempts;
+        if (success) {
+            ++entry.successes;
+        }
+        if (store) {
+            m_manager->recordProgressValue(m_learner, m_goal, attemptsContainer, phoneme->id(), entry.attempts);
+            m_manager->recordProgressValue(m_learner, m_goal, successesContainer, phoneme->id(), entry.successes);
+        }
+    }
+    if (store) {
+        m_manager->commitTransaction();
+    }
+}
+
+PhonemeStatistics::Entry PhonemeStatistics::entry(const QString &phonemeId) const
+{
+    return m_entries.value(phonemeId);
+}
+
+double PhonemeStatistics::successRate(const QString &phonemeId) const
+{
+    const Entry entry = m_entries.value(phonemeId);
+    return (entry.successes + 1.0) / (entry.attempts + 2.0);
+}
+
+QStringList PhonemeStatistics::weakestPhonemes(const QStringList &candidates, int count) const
+{
+    QVector<QPair<double, QString>> rated;
+    rated.reserve(candidates.count());
+    for (const auto &id : candidates) {
+        rated.append(qMakePair(successRate(id), id));
+    }
+    const int resultCount = qBound(0, count, rated.count());
+    std::partial_sort(rated.begin(), rated.begin() + resultCount, rated.end());
+
+    QStringList result;
+    for (int i = 0; i < resultCount; ++i) {
+        result.append(rated.at(i).second);
+    }
+    return result;
+}
@@ -0,0 +1,66 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PHONEMESTATISTICS_H
+#define PHONEMESTATISTICS_H
+
+#include "artikulatecore_export.h"
+#include <QHash>
+#include <QStringList>
+
+class IPhrase;
+
+namespace LearnerProfile
+{
+class Learner;
+class LearningGoal;
+class ProfileManager;
+}
+
+/**
+ * \class PhonemeStatistics
+ * Per-learner success statistics of phonemes for one language.
+ *
+ * Every recorded phrase result counts for all phonemes of the phrase. The values are stored as
+ * progress values of the language goal, such that they are shared by all courses of a language.
+ */
+class ARTIKULATECORE_EXPORT PhonemeStatistics
+{
+public:
+    struct Entry {
+        int attempts {0};
+        int successes {0};
+    };
+
+    explicit PhonemeStatistics(LearnerProfile::ProfileManager *manager = nullptr);
+    /**
+     * @brief load statistics of @p learner, no data is persisted if any argument is null
+     */
+    void load(LearnerProfile::Learner *learner, LearnerProfile::LearningGoal *goal);
+    void clear();
+    /**
+     * @return language goal the statistics were loaded for
+     */
+    LearnerProfile::LearningGoal *goal() const;
+    void record(const IPhrase *phrase, bool success);
+    Entry entry(const QString &phonemeId) const;
+    /**
+     * @return smoothed success rate in (0,1), phonemes without attempts are rated 0.5
+     */
+    double successRate(const QString &phonemeId) const;
+    /**
+     * @return up to @p count phonemes of @p candidates ordered from weakest to strongest
+     */
+    QStringList weakestPhonemes(const QStringList &candidates, int count) const;
+
+private:
+    LearnerProfile::ProfileManager *m_manager;
+    LearnerProfile::Learner *m_learner {nullptr};
+    LearnerProfile::LearningGoal *m_goal {nullptr};
+    QHash<QString, Entry> m_entries;
+};
+
+#endif
@@ -0,0 +1,88 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "phraseprefetcher.h"
+#include "artikulate_debug.h"
+#include "iphrase.h"
+#include <QFile>
+#include <QtConcurrent>
+
+namespace
+{
+// files older than this are assumed to be evicted from the page cache again
+constexpr int maximumWarmFiles {64};
+constexpr qint64 readChunkSize {64 * 1024};
+}
+
+PhrasePrefetcher::PhrasePrefetcher(QObject *parent)
+    : QObject(parent)
+{
+}
+
+PhrasePrefetcher::~PhrasePrefetcher()
+{
+    waitForFinished();
+}
+
+void PhrasePrefetcher::prefetch(const QVector<IPhrase *> &phrases)
+{
+    for (const auto phrase : phrases) {
+        const QString file = phrase->sound().toLocalFile();
+        if (file.isEmpty() || m_pending.contains(file) || m_warm.contains(file)) {
+            continue;
+        }
+        auto watcher = new QFutureWatcher<bool>(this);
+        connect(watcher, &QFutureWatcher<bool>::finished, this, [=]() {
+            m_pending.remove(file);
+            if (watcher->result()) {
+                markWarm(file);
+            }
+            watcher->deleteLater();
+        });
+        m_pending.insert(file, watcher);
+        watcher->setFuture(QtConcurrent::run(&PhrasePrefetcher::warmFile, file));
+    }
+}
+
+bool PhrasePrefetcher::isWarm(const QString &file) const
+{
+    return m_warm.contains(file);
+}
+
+bool PhrasePrefetcher::isPending(const QString &file) const
+{
+    return m_pending.contains(file);
+}
+
+void PhrasePrefetcher::waitForFinished()
+{
+    for (auto watcher : qAsConst(m_pending)) {
+        watcher->waitForFinished();
+    }
+}
+
+bool PhrasePrefetcher::warmFile(const QString &file)
+{
+    QFile soundFile(file);
+    if (!soundFile.open(QIODevice::ReadOnly)) {
+        qCDebug(ARTIKULATE_CORE()) << "Could not prefetch sound file" << file;
+        return false;
+    }
+    QByteArray buffer(readChunkSize, Qt::Uninitialized);
+    while (soundFile.read(buffer.data(), readChunkSize) > 0) {
+        // reading is sufficient to populate the page cache
+    }
+    return true;
+}
+
+void PhrasePrefetcher::markWarm(const QString &file)
+{
+    m_warm.append(file);
+    while (m_warm.count() > maximumWarmFiles) {
+        m_warm.removeFirst();
+    }
+    emit fileWarmed(file);
+}
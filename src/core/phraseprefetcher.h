@@ -0,0 +1,50 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PHRASEPREFETCHER_H
+#define PHRASEPREFETCHER_H
+
+#include "artikulatecore_export.h"
+#include <QFutureWatcher>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+
+class IPhrase;
+
+/**
+ * \class PhrasePrefetcher
+ * Reads sound files of upcoming phrases in the background, such that the operating system's page
+ * cache holds them when playback is requested.
+ */
+class ARTIKULATECORE_EXPORT PhrasePrefetcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PhrasePrefetcher(QObject *parent = nullptr);
+    ~PhrasePrefetcher() override;
+    /**
+     * @brief schedule sound files of @p phrases for reading, already warm files are skipped
+     */
+    void prefetch(const QVector<IPhrase *> &phrases);
+    bool isWarm(const QString &file) const;
+    bool isPending(const QString &file) const;
+    void waitForFinished();
+
+Q_SIGNALS:
+    void fileWarmed(const QString &file);
+
+private:
+    static bool warmFile(const QString &file);
+    void markWarm(const QString &file);
+
+    QHash<QString, QFutureWatcher<bool> *> m_pending;
+    QStringList m_warm; //!< most recently warmed files, oldest first
+};
+
+#endif
@@ -0,0 +1,716 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "phrasesearchindex.h"
+#include "artikulate_debug.h"
+#include "icourse.h"
+#include "ieditablecourse.h"
+#include "iphrase.h"
+#include "iresourcerepository.h"
+#include "iunit.h"
+#include "phoneme.h"
+#include "resources/courseparser.h"
+#include "unit.h"
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+const quint32 cacheMagic {0x41525453};
+const quint32 cacheVersion {1};
+const int exactScore {4};
+const int prefixScore {2};
+const int fuzzyScore {1};
+const int minimumFuzzyLength {3};
+const int compactionThreshold {1024};
+
+// trigrams of the term padded by one space at each side, i.e. as many trigrams as characters
+QStringList trigrams(const QString &term)
+{
+    const QString padded = QLatin1Char(' ') + term + QLatin1Char(' ');
+    QStringList result;
+    for (int i = 0; i + 3 <= padded.length(); ++i) {
+        result.append(padded.mid(i, 3));
+    }
+    return result;
+}
+
+// document of a phrase that is read from the source of a unit that is not loaded
+PhraseSearchIndex::Document summaryDocument(int course, const IUnit *unit, const CourseParser::PhraseSummary &phrase)
+{
+    PhraseSearchIndex::Document document;
+    document.course = course;
+    document.unitId = unit->id();
+    document.unitTitle = unit->title();
+    document.phraseId = phrase.id;
+    document.text = phrase.text;
+    document.i18nText = phrase.i18nText;
+    document.phonemes = phrase.phonemeIds;
+    return document;
+}
+}
+
+PhraseSearchIndex::PhraseSearchIndex(QObject *parent)
+    : QObject(parent)
+{
+}
+
+PhraseSearchIndex::~PhraseSearchIndex() = default;
+
+void PhraseSearchIndex::setRepository(IResourceRepository *repository)
+{
+    if (m_repository == repository) {
+        return;
+    }
+    if (m_repository) {
+        disconnect(m_repository, nullptr, this, nullptr);
+    }
+    m_repository = repository;
+    if (m_repository) {
+        // repositories add courses one by one, hence changes are collected
+        connect(m_repository, &IResourceRepository::courseAdded, this, &PhraseSearchIndex::scheduleRebuild);
+        connect(m_repository, &IResourceRepository::courseRemoved, this, &PhraseSearchIndex::scheduleRebuild);
+    }
+    invalidate();
+}
+
+IResourceRepository *PhraseSearchIndex::repository() const
+{
+    return m_repository;
+}
+
+void PhraseSearchIndex::setCacheFile(const QString &path)
+{
+    m_cacheFile = path;
+}
+
+QString PhraseSearchIndex::cacheFile() const
+{
+    return m_cacheFile;
+}
+
+void PhraseSearchIndex::scheduleRebuild()
+{
+    if (m_rebuildPending) {
+        return;
+    }
+    m_rebuildPending = true;
+    QMetaObject::invokeMethod(this, &PhraseSearchIndex::invalidate, Qt::QueuedConnection);
+}
+
+void PhraseSearchIndex::invalidate()
+{
+    m_rebuildPending = false;
+    m_built = false;
+    // documents stay readable until the next query, which is started by this notification
+    emit indexChanged();
+}
+
+void PhraseSearchIndex::ensureBuilt()
+{
+    if (!m_built) {
+        build();
+    }
+}
+
+void PhraseSearchIndex::clear()
+{
+    for (auto &connection : m_connections) {
+        QObject::disconnect(connection);
+    }
+    m_connections.clear();
+    m_courses.clear();
+    m_documents.clear();
+    m_removedCount = 0;
+    m_liveDocuments.clear();
+    m_termIds.clear();
+    m_terms.clear();
+    m_postings.clear();
+    m_trigrams.clear();
+    m_sortedTerms.clear();
+    m_sortedTermsValid = true;
+}
+
+void PhraseSearchIndex::rebuild()
+{
+    m_rebuildPending = false;
+    build();
+    emit indexChanged();
+}
+
+void PhraseSearchIndex::build()
+{
+    clear();
+    m_built = true;
+    if (!m_repository) {
+        return;
+    }
+
+    QHash<QString, QVector<Document>> cached;
+    if (!m_cacheFile.isEmpty()) {
+        loadCache(cached);
+    }
+    bool cacheOutdated {false};
+    int cacheHits {0};
+    for (const auto &course : m_repository->courseRange()) {
+        Course entry;
+        entry.course = course;
+        entry.id = course->id();
+        entry.live = dynamic_cast<IEditableCourse *>(course.get()) != nullptr;
+        const QFileInfo info(course->file().toLocalFile());
+        if (!entry.live && course->file().isLocalFile() && info.exists() && info.lastModified().isValid()) {
+            entry.file = info.absoluteFilePath();
+            entry.lastModified = info.lastModified();
+            entry.size = info.size();
+        }
+        m_courses.append(entry);
+        const int index = m_courses.count() - 1;
+
+        auto iter = entry.file.isEmpty() ? cached.end() : cached.find(entry.id + QLatin1Char('\n') + entry.file);
+        if (iter != cached.end()) {
+            for (auto &document : iter.value()) {
+                document.course = index;
+                addDocument(std::move(document));
+            }
+            ++cacheHits;
+        } else {
+            indexCourse(index);
+            cacheOutdated = cacheOutdated || !entry.file.isEmpty();
+        }
+    }
+    if (!m_cacheFile.isEmpty() && (cacheOutdated || cacheHits != cached.count())) {
+        saveCache();
+    }
+}
+
+void PhraseSearchIndex::indexCourse(int course)
+{
+    auto object = m_courses.at(course).course.lock();
+    if (!object) {
+        return;
+    }
+    for (const auto &unit : object->unitRange()) {
+        indexUnit(course, unit.get());
+    }
+    if (!m_courses.at(course).live) {
+        return;
+    }
+    ICourse *courseObject = object.get();
+    m_connections.append(connect(courseObject, &ICourse::unitAboutToBeAdded, this, [this, course](std::shared_ptr<Unit> unit, int) {
+        indexUnit(course, unit.get());
+        emit indexChanged();
+    }));
+    m_connections.append(connect(courseObject, &ICourse::unitsAboutToBeRemoved, this, [this, course, courseObject](int first, int last) {
+        const auto units = courseObject->unitRange();
+        for (int i = first; i <= last && i < units.count(); ++i) {
+            removeDocuments(course, units.at(i).get());
+        }
+        emit indexChanged();
+    }));
+}
+
+void PhraseSearchIndex::indexUnit(int course, Unit *unit)
+{
+    if (unit->isLoaded()) {
+        for (const auto &phrase : unit->phraseRange()) {
+            indexPhrase(course, unit, phrase);
+        }
+    } else {
+        // only the source of units that are not opened is read, phrases are created on request
+        const auto courseObject = m_courses.at(course).course.lock();
+        const auto phrases = CourseParser::scanPhrases(unit->source(), courseObject ? courseObject->file() : QUrl());
+        for (const auto &phrase : phrases) {
+            addDocument(summaryDocument(course, unit, phrase));
+        }
+    }
+    if (!m_courses.at(course).live) {
+        return;
+    }
+    m_connections.append(connect(unit, &Unit::loaded, this, [this, course, unit]() {
+        linkPhrases(course, unit);
+    }));
+    m_connections.append(connect(unit, &IUnit::phraseAdded, this, [this, course, unit](std::shared_ptr<IPhrase> phrase) {
+        indexPhrase(course, unit, phrase);
+        emit indexChanged();
+    }));
+    m_connections.append(connect(unit, &IUnit::phraseAboutToBeRemoved, this, [this, unit](int index) {
+        removePhrase(unit->phraseRange().at(index).get());
+        emit indexChanged();
+    }));
+    m_connections.append(connect(unit, &IUnit::phrasesAboutToBeReset, this, [this, unit]() {
+        for (const auto &phrase : unit->phraseRange()) {
+            removePhrase(phrase.get());
+        }
+    }));
+    m_connections.append(connect(unit, &IUnit::phrasesReset, this, [this, course, unit]() {
+        for (const auto &phrase : unit->phraseRange()) {
+            indexPhrase(course, unit, phrase);
+        }
+        emit indexChanged();
+    }));
+    m_connections.append(connect(unit, &IUnit::titleChanged, this, [this, unit]() {
+        for (const auto &phrase : unit->phraseRange()) {
+            updatePhrase(phrase.get());
+        }
+        emit indexChanged();
+    }));
+}
+
+void PhraseSearchIndex::indexPhrase(int course, IUnit *unit, std::shared_ptr<IPhrase> phrase)
+{
+    addDocument(createDocument(course, unit, phrase));
+    if (m_courses.at(course).live) {
+        followPhrase(phrase.get());
+    }
+}
+
+void PhraseSearchIndex::followPhrase(IPhrase *phrase)
+{
+    const auto update = [this, phrase]() {
+        updatePhrase(phrase);
+        emit indexChanged();
+    };
+    m_connections.append(connect(phrase, &IPhrase::idChanged, this, update));
+    m_connections.append(connect(phrase, &IPhrase::textChanged, this, update));
+    m_connections.append(connect(phrase, &IPhrase::i18nTextChanged, this, update));
+    m_connections.append(connect(phrase, &IPhrase::phonemesChanged, this, update));
+}
+
+void PhraseSearchIndex::linkPhrases(int course, Unit *unit)
+{
+    // loading creates the same phrases that were read from the source, hence documents are kept
+    for (int i = 0; i < m_documents.count(); ++i) {
+        auto &document = m_documents[i];
+        if (document.removed || document.course != course || document.unitId != unit->id() || !document.phrase.expired()) {
+            continue;
+        }
+        const auto phrase = unit->findPhrase(document.phraseId);
+        if (!phrase) {
+            continue;
+        }
+        document.phrase = phrase;
+        m_liveDocuments.insert(phrase.get(), i);
+        followPhrase(phrase.get());
+    }
+    // phrase elements that were skipped when loading
+    removeUnlinkedDocuments(course, unit);
+}
+
+PhraseSearchIndex::Document PhraseSearchIndex::createDocument(int course, const IUnit *unit, const std::shared_ptr<IPhrase> &phrase) const
+{
+    Document document;
+    document.course = course;
+    document.unitId = unit->id();
+    document.unitTitle = unit->title();
+    document.phraseId = phrase->id();
+    document.text = phrase->text();
+    document.i18nText = phrase->i18nText();
+    const auto phonemes = phrase->phonemes();
+    for (const auto phoneme : phonemes) {
+        document.phonemes.append(phoneme->id());
+    }
+    document.phrase = phrase;
+    return document;
+}
+
+void PhraseSearchIndex::updatePhrase(IPhrase *phrase)
+{
+    const int document = m_liveDocuments.value(phrase, -1);
+    const auto unit = phrase->unit();
+    if (document < 0 || !unit) {
+        return;
+    }
+    const int course = m_documents.at(document).course;
+    m_liveDocuments.remove(phrase);
+    removeDocument(document);
+    addDocument(createDocument(course, unit.get(), phrase->self()));
+}
+
+void PhraseSearchIndex::removePhrase(IPhrase *phrase)
+{
+    const int document = m_liveDocuments.value(phrase, -1);
+    if (document >= 0) {
+        m_liveDocuments.remove(phrase);
+        removeDocument(document);
+    }
+    disconnect(phrase, nullptr, this, nullptr);
+}
+
+void PhraseSearchIndex::removeDocuments(int course, const IUnit *unit)
+{
+    for (const auto &phrase : unit->phraseRange()) {
+        removePhrase(phrase.get());
+    }
+    removeUnlinkedDocuments(course, unit);
+    disconnect(unit, nullptr, this, nullptr);
+}
+
+void PhraseSearchIndex::removeUnlinkedDocuments(int course, const IUnit *unit)
+{
+    // compaction renumbers documents, hence it only runs after all documents are marked
+    for (auto &document : m_documents) {
+        if (!document.removed && document.course == course && document.unitId == unit->id() && document.phrase.expired()) {
+            document.removed = true;
+            ++m_removedCount;
+        }
+    }
+    compactIfNeeded();
+}
+
+void PhraseSearchIndex::addDocument(Document document)
+{
+    const int number = m_documents.count();
+    QVector<int> terms;
+    const auto addTerms = [this, &terms](const QStringList &tokens) {
+        for (const auto &token : tokens) {
+            const int term = termId(token);
+            if (!terms.contains(term)) {
+                terms.append(term);
+            }
+        }
+    };
+    addTerms(tokenize(document.text));
+    addTerms(tokenize(document.i18nText));
+    addTerms(tokenize(document.unitTitle));
+    for (const auto &phoneme : qAsConst(document.phonemes)) {
+        const QString term = normalize(phoneme);
+        if (!term.isEmpty()) {
+            addTerms({term});
+        }
+    }
+    for (const int term : qAsConst(terms)) {
+        m_postings[term].append(number);
+    }
+    const auto phrase = document.phrase.lock();
+    if (phrase && m_courses.at(document.course).live) {
+        m_liveDocuments.insert(phrase.get(), number);
+    }
+    m_documents.append(std::move(document));
+}
+
+void PhraseSearchIndex::removeDocument(int document)
+{
+    if (m_documents.at(document).removed) {
+        return;
+    }
+    // postings are only cleaned up by compaction, until then queries skip removed documents
+    m_documents[document].removed = true;
+    ++m_removedCount;
+    compactIfNeeded();
+}
+
+void PhraseSearchIndex::compactIfNeeded()
+{
+    if (m_compactionPending || m_removedCount <= compactionThreshold || 2 * m_removedCount <= m_documents.count()) {
+        return;
+    }
+    // removals happen within signal handlers and phrase(), whose callers still use the old numbers
+    m_compactionPending = true;
+    QMetaObject::invokeMethod(
+        this,
+        [this]() {
+            m_compactionPending = false;
+            if (m_removedCount > compactionThreshold && 2 * m_removedCount > m_documents.count()) {
+                compact();
+                emit indexChanged();
+            }
+        },
+        Qt::QueuedConnection);
+}
+
+void PhraseSearchIndex::compact()
+{
+    QVector<Document> documents;
+    documents.reserve(m_documents.count() - m_removedCount);
+    for (auto &document : m_documents) {
+        if (!document.removed) {
+            documents.append(std::move(document));
+        }
+    }
+    m_documents.clear();
+    m_removedCount = 0;
+    m_liveDocuments.clear();
+    m_termIds.clear();
+    m_terms.clear();
+    m_postings.clear();
+    m_trigrams.clear();
+    m_sortedTerms.clear();
+    m_sortedTermsValid = true;
+    for (auto &document : documents) {
+        addDocument(std::move(document));
+    }
+}
+
+int PhraseSearchIndex::termId(const QString &term)
+{
+    auto iter = m_termIds.constFind(term);
+    if (iter != m_termIds.constEnd()) {
+        return iter.value();
+    }
+    const int id = m_terms.count();
+    m_termIds.insert(term, id);
+    m_terms.append(term);
+    m_postings.append(QVector<int>());
+    const auto termTrigrams = trigrams(term);
+    for (const auto &trigram : termTrigrams) {
+        m_trigrams[trigram].append(id);
+    }
+    m_sortedTermsValid = false;
+    return id;
+}
+
+int PhraseSearchIndex::count()
+{
+    ensureBuilt();
+    return m_documents.count() - m_removedCount;
+}
+
+const PhraseSearchIndex::Document &PhraseSearchIndex::document(int document) const
+{
+    return m_documents.at(document);
+}
+
+std::shared_ptr<ICourse> PhraseSearchIndex::course(int document) const
+{
+    return m_courses.at(m_documents.at(document).course).course.lock();
+}
+
+IPhrase *PhraseSearchIndex::phrase(int document)
+{
+    if (auto phrase = m_documents.at(document).phrase.lock()) {
+        return phrase.get();
+    }
+    const auto course = this->course(document);
+    if (!course) {
+        return nullptr;
+    }
+    const QString unitId = m_documents.at(document).unitId;
+    const QString phraseId = m_documents.at(document).phraseId;
+    const bool live = m_courses.at(m_documents.at(document).course).live;
+    for (const auto &unit : course->unitRange()) {
+        if (unit->id() == unitId) {
+            // documents of live courses are linked when their unit is loaded, which keeps their numbers
+            unit->ensureLoaded();
+            const auto phrase = unit->findPhrase(phraseId);
+            if (!live) {
+                m_documents[document].phrase = phrase;
+            }
+            return phrase.get();
+        }
+    }
+    return nullptr;
+}
+
+QString PhraseSearchIndex::normalize(const QString &text)
+{
+    const QString decomposed = text.normalized(QString::NormalizationForm_D);
+    QString result;
+    result.reserve(decomposed.length());
+    for (const QChar &character : decomposed) {
+        if (character.category() != QChar::Mark_NonSpacing) {
+            result.append(character);
+        }
+    }
+    return result.toCaseFolded();
+}
+
+QStringList PhraseSearchIndex::tokenize(const QString &text)
+{
+    const QString normalized = normalize(text);
+    QStringList tokens;
+    int start = -1;
+    for (int i = 0; i <= normalized.length(); ++i) {
+        // spacing marks are kept, they form the vowels of e.g. Devanagari words
+        const bool word = i < normalized.length() && (normalized.at(i).isLetterOrNumber() || normalized.at(i).isMark());
+        if (word && start < 0) {
+            start = i;
+        } else if (!word && start >= 0) {
+            tokens.append(normalized.mid(start, i - start));
+            start = -1;
+        }
+    }
+    return tokens;
+}
+
+void PhraseSearchIndex::addPostings(int term, int score, QHash<int, int> &scores) const
+{
+    for (const int document : m_postings.at(term)) {
+        if (m_documents.at(document).removed) {
+            continue;
+        }
+        int &value = scores[document];
+        value = qMax(value, score);
+    }
+}
+
+QHash<int, int> PhraseSearchIndex::match(const QString &token) const
+{
+    if (!m_sortedTermsValid) {
+        m_sortedTerms.resize(m_terms.count());
+        std::iota(m_sortedTerms.begin(), m_sortedTerms.end(), 0);
+        std::sort(m_sortedTerms.begin(), m_sortedTerms.end(), [this](int left, int right) {
+            return m_terms.at(left) < m_terms.at(right);
+        });
+        m_sortedTermsValid = true;
+    }
+
+    // terms with prefix token are consecutive in sorted order
+    QHash<int, int> scores;
+    auto iter = std::lower_bound(m_sortedTerms.cbegin(), m_sortedTerms.cend(), token, [this](int term, const QString &value) {
+        return m_terms.at(term) < value;
+    });
+    for (; iter != m_sortedTerms.cend() && m_terms.at(*iter).startsWith(token); ++iter) {
+        addPostings(*iter, m_terms.at(*iter).length() == token.length() ? exactScore : prefixScore, scores);
+    }
+    if (!scores.isEmpty() || token.length() < minimumFuzzyLength) {
+        return scores;
+    }
+
+    // fuzzy match of terms with a Dice coefficient of at least 0.5 over their trigrams
+    const QStringList tokenTrigrams = trigrams(token);
+    QHash<int, int> sharedTrigrams;
+    for (const auto &trigram : tokenTrigrams) {
+        const auto terms = m_trigrams.value(trigram);
+        for (const int term : terms) {
+            ++sharedTrigrams[term];
+        }
+    }
+    for (auto shared = sharedTrigrams.constBegin(); shared != sharedTrigrams.constEnd(); ++shared) {
+        if (4 * shared.value() >= tokenTrigrams.count() + m_terms.at(shared.key()).length()) {
+            addPostings(shared.key(), fuzzyScore, scores);
+        }
+    }
+    return scores;
+}
+
+QVector<PhraseSearchIndex::Result> PhraseSearchIndex::search(const QString &query, int maximum)
+{
+    QVector<Result> results;
+    const QStringList tokens = tokenize(query);
+    if (tokens.isEmpty() || maximum <= 0) {
+        return results;
+    }
+    ensureBuilt();
+    QHash<int, int> scores = match(tokens.first());
+    for (int i = 1; i < tokens.count() && !scores.isEmpty(); ++i) {
+        const QHash<int, int> tokenScores = match(tokens.at(i));
+        for (auto iter = scores.begin(); iter != scores.end();) {
+            const auto tokenScore = tokenScores.constFind(iter.key());
+            if (tokenScore == tokenScores.constEnd()) {
+                iter = scores.erase(iter);
+            } else {
+                iter.value() += tokenScore.value();
+                ++iter;
+            }
+        }
+    }
+
+    results.reserve(scores.count());
+    for (auto iter = scores.constBegin(); iter != scores.constEnd(); ++iter) {
+        Result result;
+        result.document = iter.key();
+        result.score = iter.value();
+        results.append(result);
+    }
+    const auto better = [](const Result &left, const Result &right) {
+        return left.score != right.score ? left.score > right.score : left.document < right.document;
+    };
+    if (results.count() > maximum) {
+        std::partial_sort(results.begin(), results.begin() + maximum, results.end(), better);
+        results.resize(maximum);
+    } else {
+        std::sort(results.begin(), results.end(), better);
+    }
+    return results;
+}
+
+bool PhraseSearchIndex::loadCache(QHash<QString, QVector<Document>> &documents) const
+{
+    QFile file(m_cacheFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_15);
+    quint32 magic {0};
+    quint32 version {0};
+    stream >> magic >> version;
+    if (magic != cacheMagic || version != cacheVersion) {
+        qCDebug(ARTIKULATE_CORE()) << "Ignoring phrase search cache of unknown format" << m_cacheFile;
+        return false;
+    }
+    quint32 courseCount {0};
+    stream >> courseCount;
+    for (quint32 i = 0; i < courseCount && stream.status() == QDataStream::Ok; ++i) {
+        QString id;
+        QString path;
+        QDateTime lastModified;
+        qint64 size {-1};
+        quint32 documentCount {0};
+        stream >> id >> path >> lastModified >> size >> documentCount;
+        QVector<Document> courseDocuments;
+        for (quint32 j = 0; j < documentCount && stream.status() == QDataStream::Ok; ++j) {
+            Document document;
+            stream >> document.unitId >> document.unitTitle >> document.phraseId >> document.text >> document.i18nText >> document.phonemes;
+            courseDocuments.append(document);
+        }
+        const QFileInfo info(path);
+        if (info.exists() && info.lastModified() == lastModified && info.size() == size) {
+            documents.insert(id + QLatin1Char('\n') + path, courseDocuments);
+        }
+    }
+    if (stream.status() != QDataStream::Ok) {
+        qCWarning(ARTIKULATE_CORE()) << "Ignoring corrupted phrase search cache" << m_cacheFile;
+        documents.clear();
+        return false;
+    }
+    return true;
+}
+
+void PhraseSearchIndex::saveCache() const
+{
+    QVector<QVector<int>> courseDocuments(m_courses.count());
+    for (int i = 0; i < m_documents.count(); ++i) {
+        if (!m_documents.at(i).removed) {
+            courseDocuments[m_documents.at(i).course].append(i);
+        }
+    }
+    quint32 courseCount {0};
+    for (const auto &course : m_courses) {
+        if (!course.file.isEmpty()) {
+            ++courseCount;
+        }
+    }
+
+    QDir().mkpath(QFileInfo(m_cacheFile).absolutePath());
+    QSaveFile file(m_cacheFile);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(ARTIKULATE_CORE()) << "Could not write phrase search cache" << m_cacheFile;
+        return;
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_15);
+    stream << cacheMagic << cacheVersion << courseCount;
+    for (int i = 0; i < m_courses.count(); ++i) {
+        const Course &course = m_courses.at(i);
+        if (course.file.isEmpty()) {
+            continue;
+        }
+        stream << course.id << course.file << course.lastModified << course.size << static_cast<quint32>(courseDocuments.at(i).count());
+        for (const int number : courseDocuments.at(i)) {
+            const Document &document = m_documents.at(number);
+            stream << document.unitId << document.unitTitle << document.phraseId << document.text << document.i18nText << document.phonemes;
+        }
+    }
+    if (!file.commit()) {
+        qCWarning(ARTIKULATE_CORE()) << "Could not write phrase search cache" << m_cacheFile;
+    }
+}
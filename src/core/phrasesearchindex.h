@@ -0,0 +1,167 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PHRASESEARCHINDEX_H
+#define PHRASESEARCHINDEX_H
+
+#include "artikulatecore_export.h"
+#include <QDateTime>
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+#include <memory>
+
+class ICourse;
+class IPhrase;
+class IResourceRepository;
+class IUnit;
+class Unit;
+
+/**
+ * \class PhraseSearchIndex
+ * Inverted index over phrase texts, translations, phoneme identifiers and unit titles of all
+ * courses of a resource repository.
+ *
+ * Terms are case folded and stripped of diacritics. Each query term matches indexed terms
+ * exactly, by prefix or, if neither exists, by trigram similarity; all query terms must match.
+ * Editable courses are followed through their change signals. All other courses can only change
+ * on disk, their documents are persisted to the cache file and restored without parsing the
+ * course as long as the course file is unchanged. Units that are not loaded are indexed from
+ * their source, their phrases are only created when they are requested.
+ *
+ * The index is built on the first query after the repository or its course list changed, such that
+ * courses are not read before a search is started. Document numbers stay valid until indexChanged()
+ * is emitted.
+ */
+class ARTIKULATECORE_EXPORT PhraseSearchIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Document {
+        int course {-1};
+        QString unitId;
+        QString unitTitle;
+        QString phraseId;
+        QString text;
+        QString i18nText;
+        QStringList phonemes;
+        std::weak_ptr<IPhrase> phrase; //!< only set if the unit of the phrase is loaded
+        bool removed {false};
+    };
+    struct Result {
+        int document {-1};
+        int score {0};
+    };
+
+    explicit PhraseSearchIndex(QObject *parent = nullptr);
+    ~PhraseSearchIndex() override;
+    void setRepository(IResourceRepository *repository);
+    IResourceRepository *repository() const;
+    /**
+     * @brief set file to persist the index of unmodifiable courses, an empty path disables persistence
+     */
+    void setCacheFile(const QString &path);
+    QString cacheFile() const;
+    /**
+     * @brief index all courses of the repository, courses with valid cache entries are not loaded
+     */
+    void rebuild();
+    /**
+     * @return number of indexed phrases
+     */
+    int count();
+    /**
+     * @return at most @p maximum results ordered by descending score and then by index order
+     */
+    QVector<Result> search(const QString &query, int maximum);
+    const Document &document(int document) const;
+    std::shared_ptr<ICourse> course(int document) const;
+    /**
+     * @brief resolve the phrase of @p document, which loads its course if it was restored from cache
+     * and its unit if the unit was indexed from its source
+     */
+    IPhrase *phrase(int document);
+    /**
+     * @return @p text in case folded form without diacritics
+     */
+    static QString normalize(const QString &text);
+    static QStringList tokenize(const QString &text);
+
+Q_SIGNALS:
+    void indexChanged();
+
+private:
+    struct Course {
+        std::weak_ptr<ICourse> course;
+        QString id;
+        QString file;
+        QDateTime lastModified;
+        qint64 size {-1};
+        bool live {false}; //!< course is editable and followed through its signals
+    };
+
+    void scheduleRebuild();
+    /**
+     * @brief mark the index outdated, it is built again on the next query
+     */
+    void invalidate();
+    /**
+     * @brief build the index if it is outdated, without notification as the caller uses it right away
+     */
+    void ensureBuilt();
+    void build();
+    void clear();
+    void indexCourse(int course);
+    void indexUnit(int course, Unit *unit);
+    void indexPhrase(int course, IUnit *unit, std::shared_ptr<IPhrase> phrase);
+    void followPhrase(IPhrase *phrase);
+    /**
+     * @brief attach the phrases of @p unit to the documents that were read from its source
+     */
+    void linkPhrases(int course, Unit *unit);
+    Document createDocument(int course, const IUnit *unit, const std::shared_ptr<IPhrase> &phrase) const;
+    void updatePhrase(IPhrase *phrase);
+    void removePhrase(IPhrase *phrase);
+    void addDocument(Document document);
+    void removeDocument(int document);
+    void removeDocuments(int course, const IUnit *unit);
+    /**
+     * @brief remove documents of @p unit that were read from its source and are not linked to a phrase
+     */
+    void removeUnlinkedDocuments(int course, const IUnit *unit);
+    /**
+     * @brief schedule compaction if enough documents are removed, compaction runs from the event loop
+     * as it renumbers the documents and is announced by indexChanged()
+     */
+    void compactIfNeeded();
+    void compact();
+    int termId(const QString &term);
+    void addPostings(int term, int score, QHash<int, int> &scores) const;
+    QHash<int, int> match(const QString &token) const;
+    bool loadCache(QHash<QString, QVector<Document>> &documents) const;
+    void saveCache() const;
+
+    IResourceRepository *m_repository {nullptr};
+    QString m_cacheFile;
+    bool m_rebuildPending {false};
+    bool m_built {false};
+    bool m_compactionPending {false};
+    QVector<Course> m_courses;
+    QVector<Document> m_documents;
+    int m_removedCount {0};
+    QHash<const IPhrase *, int> m_liveDocuments;
+    QHash<QString, int> m_termIds;
+    QVector<QString> m_terms;
+    QVector<QVector<int>> m_postings; //!< ascending document numbers per term
+    QHash<QString, QVector<int>> m_trigrams; //!< terms per trigram
+    mutable QVector<int> m_sortedTerms;
+    mutable bool m_sortedTermsValid {true};
+    QVector<QMetaObject::Connection> m_connections;
+};
+
+#endif
@@ -9,7 +9,15 @@
 
 #include "artikulate_debug.h"
 #include <QList>
+#include <QPointer>
 #include <QString>
+#include <QStringList>
+
+namespace
+{
+// the single output device is followed by the player that started playback last
+QPointer<Player> s_attachedPlayer;
+}
 
 Player::Player(QObject *parent)
     : QObject(parent)
@@ -42,27 +50,65 @@ Player::PlaybackState Player::state() const
 
 void Player::playback()
 {
-    OutputDeviceController::self().disconnect();
     if (!m_soundFile.isValid()) {
         qCritical() << "Abort playing sound, no file available";
         return;
     }
     qCDebug(ARTIKULATE_LOG) << this << "Playback sound in file " << m_soundFile.toLocalFile();
+    attachToOutput();
     OutputDeviceController::self().play(QUrl::fromLocalFile(m_soundFile.toLocalFile()));
     m_playbackState = PlayingState;
-    connect(&OutputDeviceController::self(), &OutputDeviceController::started, this, &Player::updateState);
-    connect(&OutputDeviceController::self(), &OutputDeviceController::stopped, this, &Player::updateState);
     emit stateChanged();
 }
 
-void Player::stop()
+void Player::playbackQueue(const QStringList &files)
 {
+    if (files.isEmpty()) {
+        qCritical() << "Abort playing sound queue, no files given";
+        return;
+    }
+    qCDebug(ARTIKULATE_LOG) << this << "Playback sound queue" << files;
     OutputDeviceController::self().stop();
-    OutputDeviceController::self().disconnect();
-    m_playbackState = StoppedState;
+    attachToOutput();
+    for (const QString &file : files) {
+        OutputDeviceController::self().enqueue(file);
+    }
+    m_playbackState = PlayingState;
     emit stateChanged();
 }
 
+void Player::stop()
+{
+    OutputDeviceController::self().stop();
+    detachFromOutput();
+}
+
+void Player::attachToOutput()
+{
+    if (s_attachedPlayer == this) {
+        return;
+    }
+    if (s_attachedPlayer) {
+        s_attachedPlayer->detachFromOutput();
+    }
+    s_attachedPlayer = this;
+    connect(&OutputDeviceController::self(), &OutputDeviceController::started, this, &Player::updateState);
+    connect(&OutputDeviceController::self(), &OutputDeviceController::stopped, this, &Player::updateState);
+}
+
+void Player::detachFromOutput()
+{
+    disconnect(&OutputDeviceController::self(), nullptr, this, nullptr);
+    if (s_attachedPlayer == this) {
+        s_attachedPlayer = nullptr;
+    }
+    // either stopped or output device is taken over by another player
+    if (m_playbackState != StoppedState) {
+        m_playbackState = StoppedState;
+        emit stateChanged();
+    }
+}
+
 void Player::updateState()
 {
     if (OutputDeviceController::self().state() == OutputDeviceController::StoppedState && state() == PlayingState) {
@@ -25,6 +25,10 @@ public:
     ~Player() override = default;
 
     Q_INVOKABLE void playback();
+    /**
+     * Play the given local sound files one after another without gaps between them.
+     */
+    Q_INVOKABLE void playbackQueue(const QStringList &files);
     Q_INVOKABLE void stop();
     PlaybackState state() const;
     void setSoundFile(const QUrl &fileUrl);
@@ -40,6 +44,13 @@ private Q_SLOTS:
 
 private:
     Q_DISABLE_COPY(Player)
+    /**
+     * Make this player the one that follows the state of the output device. A previously
+     * attached player is detached.
+     */
+    void attachToOutput();
+    void detachFromOutput();
+
     QUrl m_soundFile;
     PlaybackState m_playbackState;
 };
@@ -9,20 +9,23 @@
 #include "libsound/src/capturedevicecontroller.h"
 
 #include <QDir>
+#include <QFileInfo>
 #include <QList>
 #include <QString>
 
 Recorder::Recorder(QObject *parent)
     : QObject(parent)
     , m_state(StoppedState)
-    , m_recordingBufferFile(QDir::tempPath() + QStringLiteral("/XXXXXX.ogg"))
+    , m_purpose(ComparisonRecording)
 {
 }
 
 Recorder::~Recorder()
 {
     // clear resources
-    m_recordingBufferFile.close();
+    if (m_recordingBufferFile) {
+        m_recordingBufferFile->close();
+    }
 }
 
 Recorder::CaptureState Recorder::state() const
@@ -30,15 +33,35 @@ Recorder::CaptureState Recorder::state() const
     return m_state;
 }
 
+Recorder::RecordingPurpose Recorder::purpose() const
+{
+    return m_purpose;
+}
+
+void Recorder::setPurpose(RecordingPurpose purpose)
+{
+    if (purpose == m_purpose) {
+        return;
+    }
+    m_purpose = purpose;
+    emit purposeChanged();
+}
+
 void Recorder::startCapture()
 {
     if (CaptureDeviceController::self().state() == CaptureDeviceController::RecordingState) {
         qCWarning(ARTIKULATE_LOG) << "Stopped capture before starting new capture, since was still active.";
         CaptureDeviceController::self().stopCapture();
     }
-    m_recordingBufferFile.open();
-    qCDebug(ARTIKULATE_LOG) << "Start recording to temporary file " << m_recordingBufferFile.fileName();
-    CaptureDeviceController::self().startCapture(m_recordingBufferFile.fileName());
+    CaptureDeviceController::self().setProfile(m_purpose == ArchiveRecording ? CaptureProfile::archiveProfile() : CaptureProfile::comparisonProfile());
+    // buffer file suffix must match the container of the recording
+    const QString suffix = CaptureDeviceController::self().profile().fileSuffix();
+    if (!m_recordingBufferFile || QFileInfo(m_recordingBufferFile->fileName()).suffix() != suffix) {
+        m_recordingBufferFile.reset(new QTemporaryFile(QDir::tempPath() + QStringLiteral("/XXXXXX.") + suffix));
+    }
+    m_recordingBufferFile->open();
+    qCDebug(ARTIKULATE_LOG) << "Start recording to temporary file " << m_recordingBufferFile->fileName();
+    CaptureDeviceController::self().startCapture(m_recordingBufferFile->fileName());
     m_state = RecordingState;
     emit stateChanged();
 }
@@ -53,20 +76,20 @@ void Recorder::stop()
 
 QString Recorder::recordingFile() const
 {
-    if (!m_recordingBufferFile.isOpen()) {
+    if (!m_recordingBufferFile || !m_recordingBufferFile->isOpen()) {
         return QString();
     }
-    return m_recordingBufferFile.fileName();
+    return m_recordingBufferFile->fileName();
 }
 
 void Recorder::storeToFile(const QString &path)
 {
-    if (m_recordingBufferFile.isOpen()) {
+    if (m_recordingBufferFile && m_recordingBufferFile->isOpen()) {
         QFile targetFile;
         targetFile.setFileName(path);
         if (!targetFile.exists() || targetFile.remove()) {
-            m_recordingBufferFile.copy(path);
-            m_recordingBufferFile.close();
+            m_recordingBufferFile->copy(path);
+            m_recordingBufferFile->close();
             emit recordingFileChanged();
         } else {
             qCritical() << "Could not save buffered sound data to file, aborting.";
@@ -78,8 +101,8 @@ void Recorder::storeToFile(const QString &path)
 
 void Recorder::clearBuffer()
 {
-    if (m_recordingBufferFile.isOpen()) {
-        m_recordingBufferFile.close();
+    if (m_recordingBufferFile && m_recordingBufferFile->isOpen()) {
+        m_recordingBufferFile->close();
         emit recordingFileChanged();
     }
 }
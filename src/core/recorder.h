@@ -11,16 +11,26 @@
 #include <QObject>
 #include <QTemporaryFile>
 #include <QUrl>
+#include <memory>
 
 class ARTIKULATECORE_EXPORT Recorder : public QObject
 {
     Q_OBJECT
     Q_PROPERTY(QString recordingFile READ recordingFile NOTIFY recordingFileChanged)
     Q_PROPERTY(CaptureState state READ state NOTIFY stateChanged)
+    /**
+     * Purpose of the recordings, defines their format. Default is ComparisonRecording.
+     */
+    Q_PROPERTY(RecordingPurpose purpose READ purpose WRITE setPurpose NOTIFY purposeChanged)
 
 public:
     Q_ENUMS(CaptureState)
     enum CaptureState { StoppedState = 0, RecordingState = 1 };
+    Q_ENUMS(RecordingPurpose)
+    enum RecordingPurpose {
+        ComparisonRecording = 0, //!< learner take that is discarded after comparison, recorded without encoding
+        ArchiveRecording = 1 //!< recording that is stored in a course, recorded at high quality
+    };
 
     explicit Recorder(QObject *parent = nullptr);
     ~Recorder() override;
@@ -30,16 +40,20 @@ public:
     Q_INVOKABLE void storeToFile(const QString &path);
     Q_INVOKABLE void clearBuffer();
     CaptureState state() const;
+    RecordingPurpose purpose() const;
+    void setPurpose(RecordingPurpose purpose);
     QString recordingFile() const;
 
 Q_SIGNALS:
     void stateChanged();
+    void purposeChanged();
     void recordingFileChanged();
 
 private:
     Q_DISABLE_COPY(Recorder)
     CaptureState m_state;
-    QTemporaryFile m_recordingBufferFile;
+    RecordingPurpose m_purpose;
+    std::unique_ptr<QTemporaryFile> m_recordingBufferFile;
 };
 
 #endif // RECORDER_H
@@ -7,6 +7,7 @@
 #include "resourcerepository.h"
 #include "artikulate_debug.h"
 #include "core/language.h"
+#include "core/languageregistry.h"
 #include "resources/courseresource.h"
 #include <QDir>
 #include <QDirIterator>
@@ -24,15 +25,8 @@ ResourceRepository::ResourceRepository(const QUrl &storageLocation)
     qCDebug(ARTIKULATE_CORE()) << "Repository created from with location" << m_storageLocation;
     // load language resources
     // all other resources are only loaded on demand
-    QDir dir(":/artikulate/languages/");
-    dir.setFilter(QDir::Files | QDir::NoSymLinks);
-    QFileInfoList list = dir.entryInfoList();
-    for (int i = 0; i < list.size(); ++i) {
-        QFileInfo fileInfo = list.at(i);
-        if (fileInfo.completeSuffix() != QLatin1String("xml")) {
-            continue;
-        }
-        loadLanguage(fileInfo.absoluteFilePath());
+    for (const auto &language : LanguageRegistry::instance()->languages()) {
+        addLanguage(language);
     }
 }
 
@@ -45,43 +39,58 @@ QUrl ResourceRepository::storageLocation() const
 
 QVector<std::shared_ptr<ICourse>> ResourceRepository::courses() const
 {
-    QVector<std::shared_ptr<ICourse>> courses;
-    for (const auto &course : m_courses) {
-        courses.append(course);
-    }
-    return courses;
+    return m_courses;
+}
+
+ConstRange<std::shared_ptr<ICourse>> ResourceRepository::courseRange() const
+{
+    return ConstRange<std::shared_ptr<ICourse>>(m_courses.constData(), m_courses.constData() + m_courses.count());
+}
+
+int ResourceRepository::courseCount() const
+{
+    return m_courses.count();
+}
+
+std::shared_ptr<ICourse> ResourceRepository::course(int index) const
+{
+    Q_ASSERT(index >= 0 && index < m_courses.count());
+    return m_courses.at(index);
 }
 
 QVector<std::shared_ptr<ICourse>> ResourceRepository::courses(const QString &languageId) const
 {
-    QVector<std::shared_ptr<ICourse>> courses;
-    for (const auto &course : m_courses) {
-        if (course->language() && course->language()->id() == languageId) {
-            continue;
-        }
-        courses.append(course);
+    if (languageId.isEmpty()) {
+        return m_courses;
     }
-    return courses;
+    return m_languageCourses.value(languageId);
 }
 
-QVector<std::shared_ptr<ILanguage>> ResourceRepository::languages() const
+ConstRange<std::shared_ptr<ICourse>> ResourceRepository::courseRange(const QString &languageId) const
 {
-    QVector<std::shared_ptr<ILanguage>> languages;
-    for (const auto &language : m_languages) {
-        if (language == nullptr) {
-            continue;
-        }
-        languages.append(language);
+    if (languageId.isEmpty()) {
+        return courseRange();
+    }
+    const auto iter = m_languageCourses.constFind(languageId);
+    if (iter == m_languageCourses.constEnd()) {
+        return ConstRange<std::shared_ptr<ICourse>>();
     }
-    return languages;
+    return ConstRange<std::shared_ptr<ICourse>>(iter->constData(), iter->constData() + iter->count());
+}
+
+QVector<std::shared_ptr<ILanguage>> ResourceRepository::languages() const
+{
+    return m_languages;
+}
+
+ConstRange<std::shared_ptr<ILanguage>> ResourceRepository::languageRange() const
+{
+    return ConstRange<std::shared_ptr<ILanguage>>(m_languages.constData(), m_languages.constData() + m_languages.count());
 }
 
 std::shared_ptr<ILanguage> ResourceRepository::language(const QString &id) const
 {
-    if (m_languages.contains(id)) {
-        return m_languages.value(id);
-    }
-    return nullptr;
+    return m_languageIds.value(id);
 }
 
 void ResourceRepository::reloadCourses()
@@ -124,22 +133,22 @@ bool ResourceRepository::loadCourse(const QString &resourceFile)
 
     emit courseAboutToBeAdded(resource, m_courses.count());
     m_courses.append(resource);
+    m_languageCourses[resource->language()->id()].append(resource);
     emit courseAdded();
     m_loadedCourses.append(resourceFile);
     return true;
 }
 
-bool ResourceRepository::loadLanguage(const QString &resourceFile)
+bool ResourceRepository::addLanguage(std::shared_ptr<ILanguage> language)
 {
-    auto language = Language::create(QUrl::fromLocalFile(resourceFile));
-    if (!language) {
-        qCWarning(ARTIKULATE_CORE()) << "Could not load language" << resourceFile;
+    if (language == nullptr) {
         return false;
     }
-    if (m_languages.contains(language->id())) {
-        qCWarning(ARTIKULATE_CORE()) << "Could not load language" << resourceFile;
+    if (m_languageIds.contains(language->id())) {
+        qCWarning(ARTIKULATE_CORE()) << "Skipping already loaded language" << language->id();
         return false;
     }
-    m_languages.insert(language->id(), language);
+    m_languages.append(language);
+    m_languageIds.insert(language->id(), language);
     return true;
 }
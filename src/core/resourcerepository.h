@@ -53,16 +53,26 @@ public:
      */
     QVector<std::shared_ptr<ICourse>> courses() const override;
 
+    ConstRange<std::shared_ptr<ICourse>> courseRange() const override;
+
+    int courseCount() const override;
+
+    std::shared_ptr<ICourse> course(int index) const override;
+
     /**
-     * @return list of available courses
+     * @return list of available courses for language @p languageId, all courses for an empty identifier
      */
     QVector<std::shared_ptr<ICourse>> courses(const QString &languageId) const override;
 
+    ConstRange<std::shared_ptr<ICourse>> courseRange(const QString &languageId) const override;
+
     /**
      * @return list of all available language specifications
      */
     QVector<std::shared_ptr<ILanguage>> languages() const override;
 
+    ConstRange<std::shared_ptr<ILanguage>> languageRange() const override;
+
     std::shared_ptr<ILanguage> language(const QString &id) const;
 
 public Q_SLOTS:
@@ -73,9 +83,11 @@ public Q_SLOTS:
 
 private:
     bool loadCourse(const QString &resourceFile);
-    bool loadLanguage(const QString &resourceFile);
+    bool addLanguage(std::shared_ptr<ILanguage> language);
     QVector<std::shared_ptr<ICourse>> m_courses;
-    QHash<QString, std::shared_ptr<ILanguage>> m_languages; ///>! (language-identifier, language resource)
+    QHash<QString, QVector<std::shared_ptr<ICourse>>> m_languageCourses; ///>! (language-identifier, courses in loading order)
+    QVector<std::shared_ptr<ILanguage>> m_languages;
+    QHash<QString, std::shared_ptr<ILanguage>> m_languageIds; ///>! (language-identifier, language resource)
     QStringList m_loadedCourses;
     const QUrl m_storageLocation;
 };
@@ -21,6 +21,40 @@
 #include <QXmlSchemaValidator>
 #include <QXmlStreamReader>
 
+namespace
+{
+const QString unitPlaceholderText = QStringLiteral("unit placeholder %1");
+
+/**
+ * @return true if the tag name that ends before @p position is complete
+ */
+bool isTagNameEnd(const QByteArray &document, int position)
+{
+    if (position >= document.size()) {
+        return false;
+    }
+    const char c = document.at(position);
+    return c == '>' || c == '/' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @return phrase type named by @p type, IPhrase::Type::AllTypes if the name is unknown
+ */
+IPhrase::Type phraseType(const QString &type)
+{
+    if (type == QLatin1String("word")) {
+        return IPhrase::Type::Word;
+    } else if (type == QLatin1String("expression")) {
+        return IPhrase::Type::Expression;
+    } else if (type == QLatin1String("sentence")) {
+        return IPhrase::Type::Sentence;
+    } else if (type == QLatin1String("paragraph")) {
+        return IPhrase::Type::Paragraph;
+    }
+    return IPhrase::Type::AllTypes;
+}
+}
+
 QXmlSchema CourseParser::loadXmlSchema(const QString &schemeName)
 {
     QString relPath = QStringLiteral(":/artikulate/schemes/%1.xsd").arg(schemeName);
@@ -100,6 +134,174 @@ std::vector<std::shared_ptr<Unit>> CourseParser::parseUnits(const QUrl &path, QV
     return units;
 }
 
+std::vector<std::shared_ptr<Unit>> CourseParser::scanUnits(const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes)
+{
+    std::vector<std::shared_ptr<Unit>> units;
+
+    QFile file(path.toLocalFile());
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCCritical(ARTIKULATE_PARSER()) << "Could not open course file" << path.toLocalFile();
+        return units;
+    }
+    const QByteArray document = file.readAll();
+    file.close();
+
+    // unit elements are parsed on their own and hence must not depend on the document encoding
+    QXmlStreamReader declaration(document);
+    declaration.readNext();
+    const QString encoding = declaration.documentEncoding().toString();
+    const bool utf16 = document.startsWith("\xFF\xFE") || document.startsWith("\xFE\xFF");
+    bool ok = !utf16 && (encoding.isEmpty() || encoding.compare(QLatin1String("UTF-8"), Qt::CaseInsensitive) == 0);
+    const auto elements = ok ? scanUnitElements(document, ok) : QVector<QPair<int, int>>();
+
+    for (const auto &element : elements) {
+        std::shared_ptr<Unit> unit = Unit::create();
+        ok = parseUnitHeader(QByteArray::fromRawData(document.constData() + element.first, element.second - element.first), unit.get());
+        if (!ok) {
+            break;
+        }
+        unit->setSource(document, element.first, element.second, [path, phonemes](const QByteArray &element) {
+            return parsePhrases(element, path, phonemes);
+        });
+        units.push_back(std::move(unit));
+    }
+    if (!ok) {
+        qCWarning(ARTIKULATE_PARSER()) << "Could not scan units, parsing complete course file" << path.toLocalFile();
+        return parseUnits(path, phonemes, false);
+    }
+    return units;
+}
+
+QVector<QPair<int, int>> CourseParser::scanUnitElements(const QByteArray &document, bool &ok)
+{
+    QVector<QPair<int, int>> elements;
+    ok = true;
+
+    // every '<' outside of comments and character data starts markup, since it must be escaped in text and attributes
+    int begin = -1; // start of the currently open unit element
+    int position = document.indexOf('<');
+    while (position >= 0) {
+        const char *markup = document.constData() + position;
+        int next = position + 1;
+        if (qstrncmp(markup, "<!--", 4) == 0) {
+            next = document.indexOf("-->", position + 4);
+        } else if (qstrncmp(markup, "<![CDATA[", 9) == 0) {
+            next = document.indexOf("]]>", position + 9);
+        } else if (qstrncmp(markup, "<unit", 5) == 0 && isTagNameEnd(document, position + 5)) {
+            next = document.indexOf('>', position);
+            if (begin >= 0 || next < 0) {
+                ok = false;
+                break;
+            }
+            if (document.at(next - 1) == '/') {
+                elements.append(qMakePair(position, next + 1));
+            } else {
+                begin = position;
+            }
+        } else if (qstrncmp(markup, "</unit", 6) == 0 && isTagNameEnd(document, position + 6)) {
+            next = document.indexOf('>', position);
+            if (begin < 0 || next < 0) {
+                ok = false;
+                break;
+            }
+            elements.append(qMakePair(begin, next + 1));
+            begin = -1;
+        }
+        if (next < 0) {
+            ok = false;
+            break;
+        }
+        position = document.indexOf('<', next);
+    }
+    ok &= begin < 0;
+    return elements;
+}
+
+bool CourseParser::parseUnitHeader(const QByteArray &element, Unit *unit)
+{
+    QXmlStreamReader xml(element);
+    if (!xml.readNextStartElement() || xml.name() != "unit") {
+        return false;
+    }
+    while (xml.readNextStartElement()) {
+        if (xml.name() == "id") {
+            unit->setId(xml.readElementText());
+        } else if (xml.name() == "foreignId") {
+            unit->setForeignId(xml.readElementText());
+        } else if (xml.name() == "title") {
+            unit->setTitle(xml.readElementText());
+        } else {
+            // phrases are only tokenized here
+            xml.skipCurrentElement();
+        }
+    }
+    return !xml.hasError();
+}
+
+QVector<CourseParser::PhraseSummary> CourseParser::scanPhrases(const QByteArray &element, const QUrl &path)
+{
+    QVector<PhraseSummary> phrases;
+    QXmlStreamReader xml(element);
+    while (!xml.atEnd() && !xml.hasError()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement || xml.name() != "phrase") {
+            continue;
+        }
+        PhraseSummary phrase;
+        while (xml.readNextStartElement()) {
+            if (xml.name() == "id") {
+                phrase.id = xml.readElementText();
+            } else if (xml.name() == "foreignId") {
+                phrase.foreignId = xml.readElementText();
+            } else if (xml.name() == "text") {
+                phrase.text = xml.readElementText();
+            } else if (xml.name() == "i18nText") {
+                phrase.i18nText = xml.readElementText();
+            } else if (xml.name() == "type") {
+                phrase.type = phraseType(xml.readElementText());
+            } else if (xml.name() == "soundFile") {
+                const QString fileName = xml.readElementText();
+                if (!fileName.isEmpty()) {
+                    phrase.sound = QUrl::fromLocalFile(path.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash).path() + '/' + fileName);
+                }
+            } else if (xml.name() == "phonemes") {
+                while (xml.readNextStartElement()) {
+                    if (xml.name() == "phonemeID") {
+                        phrase.phonemeIds.append(xml.readElementText());
+                    } else {
+                        xml.skipCurrentElement();
+                    }
+                }
+            } else {
+                xml.skipCurrentElement();
+            }
+        }
+        phrases.append(phrase);
+    }
+    if (xml.hasError()) {
+        qCCritical(ARTIKULATE_PARSER()) << "Error occurred when scanning unit of Course XML file:" << path.toLocalFile();
+    }
+    return phrases;
+}
+
+QVector<std::shared_ptr<Phrase>> CourseParser::parsePhrases(const QByteArray &element, const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes)
+{
+    QVector<std::shared_ptr<Phrase>> phrases;
+    QXmlStreamReader xml(element);
+    while (!xml.atEnd() && !xml.hasError()) {
+        if (xml.readNext() == QXmlStreamReader::StartElement && xml.name() == "phrase") {
+            bool elementOk {false};
+            auto phrase = parsePhrase(xml, path, phonemes, elementOk);
+            if (elementOk) {
+                phrases.append(phrase);
+            }
+        }
+    }
+    if (xml.hasError()) {
+        qCCritical(ARTIKULATE_PARSER()) << "Error occurred when reading unit of Course XML file:" << path.toLocalFile();
+    }
+    return phrases;
+}
+
 std::shared_ptr<Unit> CourseParser::parseUnit(QXmlStreamReader &xml, const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes, bool skipIncomplete, bool &ok)
 {
     std::shared_ptr<Unit> unit = Unit::create();
@@ -128,7 +330,7 @@ std::shared_ptr<Unit> CourseParser::parseUnit(QXmlStreamReader &xml, const QUrl
             } else if (xml.name() == "phrase") {
                 auto phrase = parsePhrase(xml, path, phonemes, elementOk);
                 if (elementOk && (!skipIncomplete || !phrase->soundFileUrl().isEmpty())) {
-                    unit->addPhrase(phrase, unit->phrases().size());
+                    unit->addPhrase(phrase, unit->phraseCount());
                 }
                 ok &= elementOk;
             } else {
@@ -185,15 +387,9 @@ std::shared_ptr<Phrase> CourseParser::parsePhrase(QXmlStreamReader &xml, const Q
                 }
                 ok &= elementOk;
             } else if (xml.name() == "type") {
-                const QString type = parseElement(xml, elementOk);
-                if (type == "word") {
-                    phrase->setType(IPhrase::Type::Word);
-                } else if (type == "expression") {
-                    phrase->setType(IPhrase::Type::Expression);
-                } else if (type == "sentence") {
-                    phrase->setType(IPhrase::Type::Sentence);
-                } else if (type == "paragraph") {
-                    phrase->setType(IPhrase::Type::Paragraph);
+                const IPhrase::Type type = phraseType(parseElement(xml, elementOk));
+                if (type != IPhrase::Type::AllTypes) {
+                    phrase->setType(type);
                 }
                 ok &= elementOk;
             } else if (xml.name() == "editState") {
@@ -262,6 +458,49 @@ QString CourseParser::parseElement(QXmlStreamReader &xml, bool &ok)
 }
 
 QDomDocument CourseParser::serializedDocument(std::shared_ptr<IEditableCourse> course, bool trainingExport)
+{
+    return serializedDocument(course, trainingExport, nullptr);
+}
+
+QByteArray CourseParser::serializedCourse(std::shared_ptr<IEditableCourse> course)
+{
+    QVector<std::shared_ptr<Unit>> unloadedUnits;
+    const QDomDocument document = serializedDocument(course, false, &unloadedUnits);
+    return splicedDocument(document, unloadedUnits);
+}
+
+QDomComment CourseParser::unitPlaceholder(QDomDocument &document, int index)
+{
+    return document.createComment(unitPlaceholderText.arg(index));
+}
+
+QByteArray CourseParser::splicedDocument(const QDomDocument &document, const QVector<std::shared_ptr<Unit>> &units)
+{
+    const QByteArray serialized = document.toByteArray();
+    if (units.isEmpty()) {
+        return serialized;
+    }
+    QByteArray spliced;
+    spliced.reserve(serialized.size());
+    int position = 0;
+    for (int i = 0; i < units.count(); ++i) {
+        // placeholders are searched in serialized order, thus spliced bytes can never be mistaken for one
+        const QByteArray placeholder = "<!--" + unitPlaceholderText.arg(i).toUtf8() + "-->";
+        const int index = serialized.indexOf(placeholder, position);
+        Q_ASSERT(index >= 0);
+        if (index < 0) {
+            qCCritical(ARTIKULATE_PARSER()) << "Missing placeholder of unit" << units.at(i)->id();
+            continue;
+        }
+        spliced.append(serialized.constData() + position, index - position);
+        spliced.append(units.at(i)->source());
+        position = index + placeholder.size();
+    }
+    spliced.append(serialized.constData() + position, serialized.size() - position);
+    return spliced;
+}
+
+QDomDocument CourseParser::serializedDocument(std::shared_ptr<IEditableCourse> course, bool trainingExport, QVector<std::shared_ptr<Unit>> *unloadedUnits)
 {
     QDomDocument document;
     // prepare xml header
@@ -284,7 +523,13 @@ QDomDocument CourseParser::serializedDocument(std::shared_ptr<IEditableCourse> c
 
     QDomElement unitListElement = document.createElement(QStringLiteral("units"));
     // create units
-    for (auto unit : course->units()) {
+    for (const auto &unit : course->unitRange()) {
+        if (unloadedUnits && !unit->isLoaded()) {
+            unitListElement.appendChild(unitPlaceholder(document, unloadedUnits->count()));
+            unloadedUnits->append(unit);
+            continue;
+        }
+        unit->ensureLoaded();
         QDomElement unitElement = document.createElement(QStringLiteral("unit"));
 
         QDomElement unitIdElement = document.createElement(QStringLiteral("id"));
@@ -383,8 +628,10 @@ bool CourseParser::exportCourseToGhnsPackage(std::shared_ptr<IEditableCourse> co
         return false;
     }
 
-    for (auto &unit : course->units()) {
-        for (auto &phrase : unit->phrases()) {
+    // exporting needs every recording, thus all units are loaded
+    for (const auto &unit : course->unitRange()) {
+        unit->ensureLoaded();
+        for (const auto &phrase : unit->phraseRange()) {
             if (QFile::exists(phrase->soundFileUrl())) {
                 tar.addLocalFile(phrase->soundFileUrl(), phrase->id() + ".ogg");
             }
@@ -8,6 +8,11 @@
 #define COURSEPARSER_H
 
 #include "artikulatecore_export.h"
+#include "core/iphrase.h"
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
 #include <QVector>
 #include <memory>
 
@@ -20,15 +25,28 @@ class Phoneme;
 class IResourceRepository;
 class QXmlSchema;
 class QJSonDocument;
+class QByteArray;
+class QDomComment;
 class QDomDocument;
 class QDomElement;
 class QXmlStreamReader;
-class QString;
-class QUrl;
 
 class ARTIKULATECORE_EXPORT CourseParser
 {
 public:
+    /**
+     * @brief plain data of a phrase element, read without creating the phrase
+     */
+    struct PhraseSummary {
+        QString id;
+        QString foreignId;
+        QString text;
+        QString i18nText;
+        IPhrase::Type type {IPhrase::Type::AllTypes};
+        QUrl sound;
+        QStringList phonemeIds;
+    };
+
     /**
      * Load XSD file given by its file name (without ".xsd" suffix). The method searches exclusively
      * the standard install dir for XSD files in subdirectory "schemes/".
@@ -56,11 +74,55 @@ public:
      */
     static std::vector<std::shared_ptr<Unit>> parseUnits(const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes = QVector<std::shared_ptr<Phoneme>>(), bool skipIncomplete = false);
 
+    /**
+     * @brief Scan units from XML file without creating their phrases
+     *
+     * Only the byte ranges of the unit elements and their identifiers and titles are read, the
+     * phrases of a unit are parsed when the unit is opened, see Unit::ensureLoaded().
+     * Files that cannot be scanned, e.g. because they are not UTF-8 encoded, are parsed completely.
+     *
+     * @param path the path to the file
+     * @param phonemes list of phonemes that are generated for the language of the unit
+     * @return scanned units
+     */
+    static std::vector<std::shared_ptr<Unit>> scanUnits(const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes = QVector<std::shared_ptr<Phoneme>>());
+
+    /**
+     * @brief Read the phrases of a unit element without creating phrase objects
+     *
+     * Used to look into units that are not opened, see Unit::source().
+     *
+     * @param element the unit element
+     * @param path the path of the course file, sound files are resolved relative to it
+     * @return summaries of all phrases in document order
+     */
+    static QVector<PhraseSummary> scanPhrases(const QByteArray &element, const QUrl &path);
+
     static QDomDocument serializedDocument(std::shared_ptr<IEditableCourse> course, bool trainingExport);
+    /**
+     * @brief serialize @p course for its course file, units that are not loaded are copied from their original bytes
+     */
+    static QByteArray serializedCourse(std::shared_ptr<IEditableCourse> course);
+    /**
+     * @return comment that stands in for the unit element of the unit with index @p index in splicedDocument()
+     */
+    static QDomComment unitPlaceholder(QDomDocument &document, int index);
+    /**
+     * @brief serialize @p document and replace its unit placeholders by the sources of @p units
+     * @param units units that are not loaded, ordered by the index of their placeholders
+     */
+    static QByteArray splicedDocument(const QDomDocument &document, const QVector<std::shared_ptr<Unit>> &units);
     static QDomElement serializedPhrase(std::shared_ptr<IEditablePhrase> phrase, QDomDocument &document);
     static bool exportCourseToGhnsPackage(std::shared_ptr<IEditableCourse> course, const QString &exportPath);
 
 private:
+    static QDomDocument serializedDocument(std::shared_ptr<IEditableCourse> course, bool trainingExport, QVector<std::shared_ptr<Unit>> *unloadedUnits);
+    /**
+     * @return byte ranges of all unit elements in @p document
+     */
+    static QVector<QPair<int, int>> scanUnitElements(const QByteArray &document, bool &ok);
+    static bool parseUnitHeader(const QByteArray &element, Unit *unit);
+    static QVector<std::shared_ptr<Phrase>> parsePhrases(const QByteArray &element, const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes);
     static std::shared_ptr<Unit> parseUnit(QXmlStreamReader &xml, const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes, bool skipIncomplete, bool &ok);
     static std::shared_ptr<Phrase> parsePhrase(QXmlStreamReader &xml, const QUrl &path, QVector<std::shared_ptr<Phoneme>> phonemes, bool &ok);
     static QStringList parsePhonemeIds(QXmlStreamReader &xml, bool &ok);
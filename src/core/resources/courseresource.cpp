@@ -62,7 +62,8 @@ void CourseResourcePrivate::loadCourse(CourseResource *parent, bool skipIncomple
     }
 
     QVector<std::shared_ptr<Phoneme>> phonemes = m_language->phonemes();
-    auto units = CourseParser::parseUnits(m_file, phonemes, skipIncomplete);
+    // without skipping, phrases are only needed for units that are opened and thus parsed on demand
+    auto units = skipIncomplete ? CourseParser::parseUnits(m_file, phonemes, true) : CourseParser::scanUnits(m_file, phonemes);
     for (auto &unit : units) {
         if (!skipIncomplete || unit->phrases().count() > 0) {
             parent->addUnit(std::move(unit));
@@ -143,7 +144,7 @@ CourseResource::CourseResource(const QUrl &path, IResourceRepository *repository
 
     // find correct language
     if (repository != nullptr) {
-        for (const auto &language : repository->languages()) {
+        for (const auto &language : repository->languageRange()) {
             if (language == nullptr) {
                 continue;
             }
@@ -269,6 +270,19 @@ QVector<std::shared_ptr<Unit>> CourseResource::units()
     return d->m_units;
 }
 
+ConstRange<std::shared_ptr<Unit>> CourseResource::unitRange()
+{
+    if (d->m_courseLoaded == false) {
+        d->loadCourse(this, d->m_skipIncomplete);
+    }
+    return ConstRange<std::shared_ptr<Unit>>(d->m_units.constData(), d->m_units.constData() + d->m_units.count());
+}
+
+int CourseResource::unitCount()
+{
+    return unitRange().count();
+}
+
 QUrl CourseResource::file() const
 {
     return d->m_file;
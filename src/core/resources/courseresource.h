@@ -83,6 +83,10 @@ public:
 
     QVector<std::shared_ptr<Unit>> units() override;
 
+    ConstRange<std::shared_ptr<Unit>> unitRange() override;
+
+    int unitCount() override;
+
 Q_SIGNALS:
     void idChanged();
     void foreignIdChanged();
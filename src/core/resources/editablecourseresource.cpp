@@ -10,6 +10,7 @@
 #include "core/phrase.h"
 #include "core/unit.h"
 #include "courseparser.h"
+#include "skeletondiff.h"
 #include <KLocalizedString>
 #include <KTar>
 #include <QDir>
@@ -177,7 +178,7 @@ bool EditableCourseResource::exportToFile(const QUrl &filePath) const
         return false;
     }
 
-    file.write(CourseParser::serializedDocument(self(), false).toByteArray());
+    file.write(CourseParser::serializedCourse(self()));
     return true;
 }
 
@@ -187,55 +188,67 @@ std::shared_ptr<Unit> EditableCourseResource::addUnit(std::shared_ptr<Unit> unit
     m_course->addUnit(unit);
     unit->setCourse(self());
     connect(unit.get(), &Unit::phrasesChanged, this, &IEditableCourse::unitChanged);
+    if (m_updateDepth > 0) {
+        unit->beginUpdate();
+        m_updatingUnits.append(unit);
+    }
     return unit;
 }
 
 QVector<std::shared_ptr<Unit>> EditableCourseResource::units()
+{
+    unitRange(); // ensure that units are loaded and attached to this course
+    return m_course->units();
+}
+
+ConstRange<std::shared_ptr<Unit>> EditableCourseResource::unitRange()
 {
     if (!m_unitsLoaded) {
-        for (auto &unit : m_course->units()) {
+        for (const auto &unit : m_course->unitRange()) {
             unit->setCourse(self());
         }
         m_unitsLoaded = true;
     }
-    return m_course->units();
+    return m_course->unitRange();
+}
+
+int EditableCourseResource::unitCount()
+{
+    return unitRange().count();
 }
 
 void EditableCourseResource::updateFrom(std::shared_ptr<ICourse> skeleton)
 {
-    for (auto skeletonUnit : skeleton->units()) {
-        // find matching unit or create one
-        std::shared_ptr<Unit> matchingUnit;
-        auto it = std::find_if(m_course->units().cbegin(), m_course->units().cend(), [skeletonUnit](std::shared_ptr<Unit> compareUnit) { return compareUnit->foreignId() == skeletonUnit->id(); });
-        if (it == m_course->units().cend()) {
-            // import complete unit
-            auto importUnit = Unit::create();
-            importUnit->setId(skeletonUnit->id());
-            importUnit->setForeignId(skeletonUnit->id());
-            importUnit->setTitle(skeletonUnit->title());
-            matchingUnit = m_course->addUnit(std::move(importUnit));
-        } else {
-            matchingUnit = *it;
-        }
+    unitRange(); // ensure that units are loaded before diffing
+    // removals unlink units and phrases from the skeleton, these are only applied after a preview of the diff
+    const auto diff = SkeletonDiff::compute(skeleton, self()).withoutRemovals();
+    diff.apply();
 
-        // import phrases
-        for (auto skeletonPhrase : skeletonUnit->phrases()) {
-            auto it = std::find_if(matchingUnit->phrases().cbegin(), matchingUnit->phrases().cend(), [skeletonPhrase](std::shared_ptr<IPhrase> comparePhrase) { return comparePhrase->foreignId() == skeletonPhrase->id(); });
-            if (it == matchingUnit->phrases().cend()) {
-                // import complete Phrase
-                std::shared_ptr<Phrase> importPhrase = Phrase::create();
-                importPhrase->setId(skeletonPhrase->id());
-                importPhrase->setForeignId(skeletonPhrase->id());
-                importPhrase->setText(skeletonPhrase->text());
-                importPhrase->seti18nText(skeletonPhrase->i18nText());
-                importPhrase->setType(skeletonPhrase->type());
-                importPhrase->setUnit(matchingUnit);
-                matchingUnit->addPhrase(importPhrase, matchingUnit->phrases().size());
-            }
-        }
+    qCInfo(ARTIKULATE_LOG()) << "Update performed with" << diff.changes().count() << "changes";
+}
+
+void EditableCourseResource::beginUpdate()
+{
+    if (m_updateDepth++ > 0) {
+        return;
+    }
+    m_updatingUnits = m_course->units();
+    for (const auto &unit : qAsConst(m_updatingUnits)) {
+        unit->beginUpdate();
     }
+}
 
-    qCInfo(ARTIKULATE_LOG()) << "Update performed!";
+void EditableCourseResource::endUpdate()
+{
+    Q_ASSERT(m_updateDepth > 0);
+    if (m_updateDepth <= 0 || --m_updateDepth > 0) {
+        return;
+    }
+    const auto units = m_updatingUnits;
+    m_updatingUnits.clear();
+    for (const auto &unit : units) {
+        unit->endUpdate();
+    }
 }
 
 bool EditableCourseResource::isModified() const
@@ -279,23 +292,24 @@ bool EditableCourseResource::createPhraseAfter(IPhrase *previousPhrase)
     }
 
     // find index
-    int index = parentUnit->phrases().size();
-    for (int i = 0; i < parentUnit->phrases().size(); ++i) {
-        if (parentUnit->phrases().at(i)->id() == previousPhrase->id()) {
-            index = i;
-            break;
-        }
+    parentUnit->ensureLoaded();
+    int index = parentUnit->phraseCount();
+    if (const auto containedPhrase = parentUnit->findPhrase(previousPhrase->id())) {
+        index = parentUnit->indexOf(containedPhrase.get());
     }
 
-    // find globally unique phrase id inside course
-    QStringList phraseIds;
-    for (auto unit : m_course->units()) {
-        for (auto &phrase : unit->phrases()) {
-            phraseIds.append(phrase->id());
+    // find globally unique phrase id inside course, units that are not loaded are only searched textually
+    auto isUsed = [this](const QString &id) {
+        const QByteArray encodedId = id.toUtf8();
+        for (const auto &unit : m_course->unitRange()) {
+            if (unit->isLoaded() ? unit->findPhrase(id) != nullptr : unit->source().contains(encodedId)) {
+                return true;
+            }
         }
-    }
+        return false;
+    };
     QString id = QUuid::createUuid().toString();
-    while (phraseIds.contains(id)) {
+    while (isUsed(id)) {
         id = QUuid::createUuid().toString();
         qCWarning(ARTIKULATE_LOG) << "Phrase id generator has found a collision, recreating id.";
     }
@@ -82,7 +82,11 @@ public:
 
     std::shared_ptr<Unit> addUnit(std::shared_ptr<Unit> unit) override;
     QVector<std::shared_ptr<Unit>> units() override;
+    ConstRange<std::shared_ptr<Unit>> unitRange() override;
+    int unitCount() override;
     void updateFrom(std::shared_ptr<ICourse> course) override;
+    void beginUpdate() override;
+    void endUpdate() override;
     bool isModified() const override;
     QUrl file() const override;
     std::shared_ptr<IEditableCourse> self() const override;
@@ -111,6 +115,8 @@ private:
     void setSelf(std::shared_ptr<ICourse> self) override;
     mutable bool m_unitsLoaded {false}; ///< parsing of all units is postponed until needed, this variable indicates if they are read
     bool m_modified {false};
+    int m_updateDepth {0};
+    QVector<std::shared_ptr<Unit>> m_updatingUnits; ///< units that joined the current batch
     const std::unique_ptr<CourseResource> m_course;
 };
 
@@ -0,0 +1,409 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "skeletondiff.h"
+#include "core/icourse.h"
+#include "core/ieditablecourse.h"
+#include "core/ieditablephrase.h"
+#include "core/phrase.h"
+#include "core/unit.h"
+#include <QHash>
+#include <QSet>
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+/**
+ * @return flags marking a longest increasing subsequence of @p positions, these elements keep their place
+ */
+QVector<bool> stableElements(const QVector<int> &positions)
+{
+    QVector<int> tails; // element with the smallest position that ends a subsequence of each length
+    QVector<int> predecessors(positions.count(), -1);
+    for (int i = 0; i < positions.count(); ++i) {
+        auto iter = std::lower_bound(tails.begin(), tails.end(), positions.at(i), [&positions](int element, int position) {
+            return positions.at(element) < position;
+        });
+        const int length = static_cast<int>(iter - tails.begin());
+        predecessors[i] = length > 0 ? tails.at(length - 1) : -1;
+        if (iter == tails.end()) {
+            tails.append(i);
+        } else {
+            *iter = i;
+        }
+    }
+    QVector<bool> stable(positions.count(), false);
+    for (int i = tails.isEmpty() ? -1 : tails.last(); i >= 0; i = predecessors.at(i)) {
+        stable[i] = true;
+    }
+    return stable;
+}
+
+void addPhraseChanges(QVector<SkeletonDiff::Change> &changes,
+                      const QVector<CourseParser::PhraseSummary> &skeletonPhrases,
+                      const QString &unitId,
+                      const QVector<CourseParser::PhraseSummary> &phrases,
+                      const QVector<CourseParser::PhraseSummary> &basePhrases)
+{
+    using ChangeType = SkeletonDiff::ChangeType;
+
+    QHash<QString, int> positions; //!< (foreign id, position in course unit)
+    for (int i = 0; i < phrases.count(); ++i) {
+        const QString &foreignId = phrases.at(i).foreignId;
+        if (!foreignId.isEmpty()) {
+            positions.insert(foreignId, i);
+        }
+    }
+    QHash<QString, QString> baseTexts; //!< (id, text)
+    for (const auto &phrase : basePhrases) {
+        baseTexts.insert(phrase.id, phrase.text);
+    }
+
+    QVector<int> matchedPositions;
+    for (const auto &skeletonPhrase : skeletonPhrases) {
+        const int position = positions.value(skeletonPhrase.id, -1);
+        if (position >= 0) {
+            matchedPositions.append(position);
+        }
+    }
+    const QVector<bool> stable = stableElements(matchedPositions);
+
+    QSet<QString> skeletonIds;
+    QString previousId;
+    int matched = 0;
+    for (const auto &skeletonPhrase : skeletonPhrases) {
+        const QString &id = skeletonPhrase.id;
+        skeletonIds.insert(id);
+        const int position = positions.value(id, -1);
+        SkeletonDiff::Change change;
+        change.unitId = unitId;
+        change.phraseId = id;
+        if (position < 0) {
+            change.type = ChangeType::PhraseAdded;
+            change.previousId = previousId;
+            change.text = skeletonPhrase.text;
+            change.i18nText = skeletonPhrase.i18nText;
+            change.phraseType = skeletonPhrase.type;
+            changes.append(change);
+        } else {
+            const auto &phrase = phrases.at(position);
+            if (!stable.at(matched)) {
+                change.type = ChangeType::PhraseMoved;
+                change.previousId = previousId;
+                changes.append(change);
+            }
+            ++matched;
+            const auto baseText = baseTexts.constFind(id);
+            if (baseText != baseTexts.constEnd() && *baseText != skeletonPhrase.text && phrase.text != skeletonPhrase.text) {
+                change.type = ChangeType::PhraseRetitled;
+                change.previousId.clear();
+                change.text = skeletonPhrase.text;
+                change.conflict = phrase.text != *baseText;
+                changes.append(change);
+            }
+        }
+        previousId = id;
+    }
+
+    for (const auto &phrase : phrases) {
+        if (!phrase.foreignId.isEmpty() && !skeletonIds.contains(phrase.foreignId)) {
+            SkeletonDiff::Change change;
+            change.type = ChangeType::PhraseRemoved;
+            change.unitId = unitId;
+            change.phraseId = phrase.foreignId;
+            changes.append(change);
+        }
+    }
+}
+}
+
+SkeletonDiff::Snapshot::Snapshot(const std::shared_ptr<ICourse> &course)
+    : m_course(course)
+    , m_null(!course)
+{
+    if (!course) {
+        return;
+    }
+    m_file = course->file();
+    const auto units = course->unitRange();
+    m_units.reserve(units.count());
+    for (const auto &unit : units) {
+        UnitData data;
+        data.id = unit->id();
+        data.foreignId = unit->foreignId();
+        data.title = unit->title();
+        data.loaded = unit->isLoaded();
+        if (!data.loaded) {
+            data.source = unit->source();
+        } else {
+            data.phrases.reserve(unit->phraseCount());
+            for (const auto &phrase : unit->phraseRange()) {
+                CourseParser::PhraseSummary summary;
+                summary.id = phrase->id();
+                summary.foreignId = phrase->foreignId();
+                summary.text = phrase->text();
+                summary.i18nText = phrase->i18nText();
+                summary.type = phrase->type();
+                data.phrases.append(summary);
+            }
+        }
+        m_units.append(data);
+    }
+}
+
+bool SkeletonDiff::Snapshot::isNull() const
+{
+    return m_null;
+}
+
+QVector<CourseParser::PhraseSummary> SkeletonDiff::Snapshot::phrases(const UnitData &unit) const
+{
+    return unit.loaded ? unit.phrases : CourseParser::scanPhrases(unit.source, m_file);
+}
+
+SkeletonDiff SkeletonDiff::compute(std::shared_ptr<ICourse> skeleton, std::shared_ptr<ICourse> course, std::shared_ptr<ICourse> base)
+{
+    return compute(Snapshot(skeleton), Snapshot(course), Snapshot(base));
+}
+
+SkeletonDiff SkeletonDiff::compute(const Snapshot &skeleton, const Snapshot &course, const Snapshot &base)
+{
+    SkeletonDiff diff;
+    diff.m_course = course.m_course;
+    diff.m_skeleton = skeleton;
+    if (skeleton.isNull() || course.isNull()) {
+        return diff;
+    }
+
+    // units are compared from their phrase summaries, which does not load them
+    const auto &courseUnits = course.m_units;
+    QHash<QString, int> positions; //!< (foreign id, position in course)
+    for (int i = 0; i < courseUnits.count(); ++i) {
+        const QString &foreignId = courseUnits.at(i).foreignId;
+        if (!foreignId.isEmpty()) {
+            positions.insert(foreignId, i);
+        }
+    }
+    QHash<QString, const Snapshot::UnitData *> baseUnits;
+    for (const auto &unit : base.m_units) {
+        baseUnits.insert(unit.id, &unit);
+    }
+
+    const auto &skeletonUnits = skeleton.m_units;
+    QVector<int> matchedPositions;
+    for (const auto &skeletonUnit : skeletonUnits) {
+        const int position = positions.value(skeletonUnit.id, -1);
+        if (position >= 0) {
+            matchedPositions.append(position);
+        }
+    }
+    const QVector<bool> stable = stableElements(matchedPositions);
+
+    QSet<QString> skeletonIds;
+    QString previousId;
+    int matched = 0;
+    for (const auto &skeletonUnit : skeletonUnits) {
+        const QString &id = skeletonUnit.id;
+        skeletonIds.insert(id);
+        const int position = positions.value(id, -1);
+        const Snapshot::UnitData *baseUnit = baseUnits.value(id);
+        const auto skeletonPhrases = skeleton.phrases(skeletonUnit);
+        const auto basePhrases = baseUnit ? base.phrases(*baseUnit) : QVector<CourseParser::PhraseSummary>();
+        Change change;
+        change.unitId = id;
+        if (position < 0) {
+            change.type = ChangeType::UnitAdded;
+            change.previousId = previousId;
+            change.text = skeletonUnit.title;
+            diff.m_changes.append(change);
+            addPhraseChanges(diff.m_changes, skeletonPhrases, id, QVector<CourseParser::PhraseSummary>(), basePhrases);
+        } else {
+            const auto &unit = courseUnits.at(position);
+            if (!stable.at(matched)) {
+                change.type = ChangeType::UnitMoved;
+                change.previousId = previousId;
+                diff.m_changes.append(change);
+            }
+            ++matched;
+            if (baseUnit && baseUnit->title != skeletonUnit.title && unit.title != skeletonUnit.title) {
+                change.type = ChangeType::UnitRetitled;
+                change.previousId.clear();
+                change.text = skeletonUnit.title;
+                change.conflict = unit.title != baseUnit->title;
+                diff.m_changes.append(change);
+            }
+            addPhraseChanges(diff.m_changes, skeletonPhrases, id, course.phrases(unit), basePhrases);
+        }
+        previousId = id;
+    }
+
+    for (const auto &unit : courseUnits) {
+        if (!unit.foreignId.isEmpty() && !skeletonIds.contains(unit.foreignId)) {
+            Change change;
+            change.type = ChangeType::UnitRemoved;
+            change.unitId = unit.foreignId;
+            diff.m_changes.append(change);
+        }
+    }
+    return diff;
+}
+
+std::shared_ptr<ICourse> SkeletonDiff::course() const
+{
+    return m_course.lock();
+}
+
+const SkeletonDiff::Snapshot &SkeletonDiff::skeleton() const
+{
+    return m_skeleton;
+}
+
+const QVector<SkeletonDiff::Change> &SkeletonDiff::changes() const
+{
+    return m_changes;
+}
+
+bool SkeletonDiff::isEmpty() const
+{
+    return m_changes.isEmpty();
+}
+
+int SkeletonDiff::count(ChangeType type) const
+{
+    return static_cast<int>(std::count_if(m_changes.cbegin(), m_changes.cend(), [type](const Change &change) {
+        return change.type == type;
+    }));
+}
+
+SkeletonDiff SkeletonDiff::withoutRemovals() const
+{
+    SkeletonDiff diff;
+    diff.m_course = m_course;
+    diff.m_skeleton = m_skeleton;
+    std::copy_if(m_changes.cbegin(), m_changes.cend(), std::back_inserter(diff.m_changes), [](const Change &change) {
+        return change.type != ChangeType::UnitRemoved && change.type != ChangeType::PhraseRemoved;
+    });
+    return diff;
+}
+
+void SkeletonDiff::apply() const
+{
+    auto course = std::dynamic_pointer_cast<IEditableCourse>(m_course.lock());
+    if (!course || m_changes.isEmpty()) {
+        return;
+    }
+
+    course->beginUpdate();
+    QHash<QString, std::shared_ptr<Unit>> units; //!< (foreign id, unit)
+    for (const auto &unit : course->unitRange()) {
+        if (!unit->foreignId().isEmpty()) {
+            units.insert(unit->foreignId(), unit);
+        }
+    }
+    QHash<const Unit *, QHash<QString, std::shared_ptr<IPhrase>>> phrases; //!< per unit (foreign id, phrase), filled on first use
+    auto phrasesOf = [&phrases](const std::shared_ptr<Unit> &unit) -> QHash<QString, std::shared_ptr<IPhrase>> & {
+        auto iter = phrases.find(unit.get());
+        if (iter == phrases.end()) {
+            iter = phrases.insert(unit.get(), QHash<QString, std::shared_ptr<IPhrase>>());
+            unit->ensureLoaded();
+            for (const auto &phrase : unit->phraseRange()) {
+                if (!phrase->foreignId().isEmpty()) {
+                    iter->insert(phrase->foreignId(), phrase);
+                }
+            }
+        }
+        return *iter;
+    };
+    auto positionAfter = [&phrasesOf](const std::shared_ptr<Unit> &unit, const QString &previousId) {
+        if (previousId.isEmpty()) {
+            return 0;
+        }
+        const auto previous = phrasesOf(unit).value(previousId);
+        return previous ? unit->indexOf(previous.get()) + 1 : unit->phraseCount();
+    };
+
+    for (const auto &change : m_changes) {
+        const auto unit = units.value(change.unitId);
+        switch (change.type) {
+            case ChangeType::UnitAdded: {
+                if (unit) {
+                    break;
+                }
+                auto importUnit = Unit::create();
+                importUnit->setId(change.unitId);
+                importUnit->setForeignId(change.unitId);
+                importUnit->setTitle(change.text);
+                units.insert(change.unitId, course->addUnit(std::move(importUnit)));
+                break;
+            }
+            case ChangeType::UnitRemoved:
+                if (unit) {
+                    unit->setForeignId(QString());
+                    units.remove(change.unitId);
+                }
+                break;
+            case ChangeType::UnitMoved:
+                // courses keep their own unit order
+                break;
+            case ChangeType::UnitRetitled:
+                if (unit && !change.conflict) {
+                    unit->setTitle(change.text);
+                }
+                break;
+            case ChangeType::PhraseAdded: {
+                if (!unit || phrasesOf(unit).contains(change.phraseId)) {
+                    break;
+                }
+                std::shared_ptr<Phrase> importPhrase = Phrase::create();
+                importPhrase->setId(change.phraseId);
+                importPhrase->setForeignId(change.phraseId);
+                importPhrase->setText(change.text);
+                importPhrase->seti18nText(change.i18nText);
+                importPhrase->setType(change.phraseType);
+                importPhrase->setUnit(unit);
+                unit->addPhrase(importPhrase, positionAfter(unit, change.previousId));
+                if (unit->findPhrase(change.phraseId).get() == importPhrase.get()) {
+                    phrasesOf(unit).insert(change.phraseId, importPhrase);
+                }
+                break;
+            }
+            case ChangeType::PhraseRemoved: {
+                if (!unit) {
+                    break;
+                }
+                auto phrase = std::dynamic_pointer_cast<IEditablePhrase>(phrasesOf(unit).take(change.phraseId));
+                if (phrase) {
+                    phrase->setForeignId(QString());
+                }
+                break;
+            }
+            case ChangeType::PhraseMoved: {
+                if (!unit) {
+                    break;
+                }
+                auto phrase = std::dynamic_pointer_cast<IEditablePhrase>(phrasesOf(unit).value(change.phraseId));
+                if (!phrase) {
+                    break;
+                }
+                unit->removePhrase(phrase);
+                unit->addPhrase(phrase, positionAfter(unit, change.previousId));
+                break;
+            }
+            case ChangeType::PhraseRetitled: {
+                if (!unit || change.conflict) {
+                    break;
+                }
+                auto phrase = std::dynamic_pointer_cast<IEditablePhrase>(phrasesOf(unit).value(change.phraseId));
+                if (phrase) {
+                    phrase->setText(change.text);
+                }
+                break;
+            }
+        }
+    }
+    course->endUpdate();
+}
@@ -0,0 +1,133 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef SKELETONDIFF_H
+#define SKELETONDIFF_H
+
+#include "artikulatecore_export.h"
+#include "core/iphrase.h"
+#include "courseparser.h"
+#include <QByteArray>
+#include <QString>
+#include <QUrl>
+#include <QVector>
+#include <memory>
+
+class ICourse;
+
+/**
+ * \class SkeletonDiff
+ * Change set that brings a course in line with the skeleton it is derived from.
+ *
+ * Units and phrases of the course are matched to the skeleton by their foreign identifiers, all
+ * lookups are hash based. Content of the course without foreign identifier is never touched.
+ * Skeleton elements without counterpart are added, counterparts whose skeleton element is gone
+ * are removed and counterparts out of skeleton order are moved. Changed unit titles and phrase
+ * texts can only be told apart from translations if the skeleton state of the last update is
+ * given as base: then an element is retitled if the skeleton changed it, which conflicts if the
+ * course changed it as well. Units that are not loaded are compared from their source, computing
+ * a diff does not load them.
+ *
+ * Diffs are computed from snapshots, which are plain copies of courses. Snapshots are taken on the
+ * GUI thread and can be compared on any thread.
+ */
+class ARTIKULATECORE_EXPORT SkeletonDiff
+{
+public:
+    enum class ChangeType { UnitAdded, UnitRemoved, UnitMoved, UnitRetitled, PhraseAdded, PhraseRemoved, PhraseMoved, PhraseRetitled };
+
+    struct Change {
+        ChangeType type {ChangeType::UnitAdded};
+        QString unitId;     //!< identifier of the skeleton unit, i.e. foreign identifier of the course unit
+        QString phraseId;   //!< identifier of the skeleton phrase, empty for unit changes
+        QString previousId; //!< for added and moved elements the preceding skeleton sibling, empty if it is the first
+        QString text;       //!< new title or phrase text for added and retitled elements
+        QString i18nText;
+        IPhrase::Type phraseType {IPhrase::Type::Word};
+        bool conflict {false}; //!< retitled element was also changed in the course and is kept by apply()
+    };
+
+    /**
+     * @brief plain copy of the units and phrases of a course
+     *
+     * Taking a snapshot neither loads nor parses units, units that are not loaded are copied as
+     * their source and read when the snapshot is compared.
+     */
+    class ARTIKULATECORE_EXPORT Snapshot
+    {
+    public:
+        Snapshot() = default;
+        explicit Snapshot(const std::shared_ptr<ICourse> &course);
+        bool isNull() const;
+
+    private:
+        friend class SkeletonDiff;
+        struct UnitData {
+            QString id;
+            QString foreignId;
+            QString title;
+            bool loaded {false};
+            QByteArray source;                            //!< unit element if the unit is not loaded
+            QVector<CourseParser::PhraseSummary> phrases; //!< phrases if the unit is loaded
+        };
+        /**
+         * @return phrases of @p unit, which are read from its source if it was not loaded
+         */
+        QVector<CourseParser::PhraseSummary> phrases(const UnitData &unit) const;
+
+        std::weak_ptr<ICourse> m_course;
+        QUrl m_file;
+        QVector<UnitData> m_units;
+        bool m_null {true};
+    };
+
+    SkeletonDiff() = default;
+
+    /**
+     * @brief compute the changes needed to update @p course from @p skeleton
+     * @param base state of the skeleton at the last update of the course, if known
+     */
+    static SkeletonDiff compute(std::shared_ptr<ICourse> skeleton, std::shared_ptr<ICourse> course, std::shared_ptr<ICourse> base = nullptr);
+
+    /**
+     * @brief compute the changes needed to update the course of @p course from @p skeleton
+     *
+     * Only the snapshots are read, thus this method can be called from any thread.
+     *
+     * @param base state of the skeleton at the last update of the course, if known
+     */
+    static SkeletonDiff compute(const Snapshot &skeleton, const Snapshot &course, const Snapshot &base = Snapshot());
+
+    std::shared_ptr<ICourse> course() const;
+    /**
+     * @return state of the skeleton this diff was computed from, which is the base of the next update
+     */
+    const Snapshot &skeleton() const;
+    const QVector<Change> &changes() const;
+    bool isEmpty() const;
+    int count(ChangeType type) const;
+
+    /**
+     * @return copy of this diff without removed units and phrases, which only adds, moves and retitles
+     */
+    SkeletonDiff withoutRemovals() const;
+
+    /**
+     * @brief apply all changes to the course as one batch, see IEditableCourse::beginUpdate()
+     *
+     * Removed units and phrases are kept in the course and only lose their foreign identifier.
+     * Unit moves are not applied since courses keep their own unit order, conflicting retitles
+     * are skipped.
+     */
+    void apply() const;
+
+private:
+    std::weak_ptr<ICourse> m_course;
+    Snapshot m_skeleton;
+    QVector<Change> m_changes;
+};
+
+#endif
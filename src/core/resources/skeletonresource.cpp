@@ -64,14 +64,15 @@ public:
         m_modified = false;
     }
 
-    QVector<std::shared_ptr<Unit>> units();
+    const QVector<std::shared_ptr<Unit>> &units();
 
     std::shared_ptr<Unit> appendUnit(std::shared_ptr<Unit> unit);
 
     /**
      * @return the skeleton resource as serialized byte array
+     * @param unloadedUnits units that are only referenced by placeholders, see CourseParser::splicedDocument()
      */
-    QDomDocument serializedSkeleton();
+    QDomDocument serializedSkeleton(QVector<std::shared_ptr<Unit>> &unloadedUnits);
 
     std::weak_ptr<ICourse> m_self;
     QUrl m_path;
@@ -80,17 +81,19 @@ public:
     QString m_description;
     bool m_unitsParsed {false};
     bool m_modified {false};
+    int m_updateDepth {0};
+    QVector<std::shared_ptr<Unit>> m_updatingUnits; ///!< units that joined the current batch
 
 protected:
     QVector<std::shared_ptr<Unit>> m_units; ///!< the units variable is loaded lazily and shall never be access directly
 };
 
-QVector<std::shared_ptr<Unit>> SkeletonResourcePrivate::units()
+const QVector<std::shared_ptr<Unit>> &SkeletonResourcePrivate::units()
 {
     if (m_unitsParsed) {
         return m_units;
     }
-    auto units = CourseParser::parseUnits(m_path);
+    auto units = CourseParser::scanUnits(m_path);
     for (auto &unit : units) {
         Q_ASSERT(m_self.lock() != nullptr);
         unit->setCourse(m_self.lock());
@@ -107,10 +110,14 @@ std::shared_ptr<Unit> SkeletonResourcePrivate::appendUnit(std::shared_ptr<Unit>
     m_modified = true;
     Q_ASSERT(m_self.lock() != nullptr);
     unit->setCourse(m_self.lock());
+    if (m_updateDepth > 0) {
+        unit->beginUpdate();
+        m_updatingUnits.append(unit);
+    }
     return m_units.last();
 }
 
-QDomDocument SkeletonResourcePrivate::serializedSkeleton()
+QDomDocument SkeletonResourcePrivate::serializedSkeleton(QVector<std::shared_ptr<Unit>> &unloadedUnits)
 {
     QDomDocument document;
     // prepare xml header
@@ -131,7 +138,12 @@ QDomDocument SkeletonResourcePrivate::serializedSkeleton()
 
     QDomElement unitListElement = document.createElement(QStringLiteral("units"));
     // create units
-    for (auto unit : units()) {
+    for (const auto &unit : units()) {
+        if (!unit->isLoaded()) {
+            unitListElement.appendChild(CourseParser::unitPlaceholder(document, unloadedUnits.count()));
+            unloadedUnits.append(unit);
+            continue;
+        }
         QDomElement unitElement = document.createElement(QStringLiteral("unit"));
 
         QDomElement unitIdElement = document.createElement(QStringLiteral("id"));
@@ -287,7 +299,9 @@ bool SkeletonResource::exportToFile(const QUrl &filePath) const
         qCWarning(ARTIKULATE_LOG()) << "Unable to open file " << filePath << " in write mode, aborting.";
         return false;
     }
-    file.write(d->serializedSkeleton().toByteArray());
+    QVector<std::shared_ptr<Unit>> unloadedUnits;
+    const QDomDocument document = d->serializedSkeleton(unloadedUnits);
+    file.write(CourseParser::splicedDocument(document, unloadedUnits));
 
     return true;
 }
@@ -305,23 +319,24 @@ bool SkeletonResource::createPhraseAfter(IPhrase *previousPhrase)
     }
 
     // find index
-    int index = parentUnit->phrases().size();
-    for (int i = 0; i < parentUnit->phrases().size(); ++i) {
-        if (parentUnit->phrases().at(i)->id() == previousPhrase->id()) {
-            index = i;
-            break;
-        }
+    parentUnit->ensureLoaded();
+    int index = parentUnit->phraseCount();
+    if (const auto containedPhrase = parentUnit->findPhrase(previousPhrase->id())) {
+        index = parentUnit->indexOf(containedPhrase.get());
     }
 
-    // find globally unique phrase id inside course
-    QStringList phraseIds;
-    for (auto unit : units()) {
-        for (auto &phrase : unit->phrases()) {
-            phraseIds.append(phrase->id());
+    // find globally unique phrase id inside course, units that are not loaded are only searched textually
+    auto isUsed = [this](const QString &id) {
+        const QByteArray encodedId = id.toUtf8();
+        for (const auto &unit : d->units()) {
+            if (unit->isLoaded() ? unit->findPhrase(id) != nullptr : unit->source().contains(encodedId)) {
+                return true;
+            }
         }
-    }
+        return false;
+    };
     QString id = QUuid::createUuid().toString();
-    while (phraseIds.contains(id)) {
+    while (isUsed(id)) {
         id = QUuid::createUuid().toString();
         qCWarning(ARTIKULATE_LOG) << "Phrase id generator has found a collision, recreating id.";
     }
@@ -379,6 +394,30 @@ void SkeletonResource::updateFrom(std::shared_ptr<ICourse>)
     // not supported
 }
 
+void SkeletonResource::beginUpdate()
+{
+    if (d->m_updateDepth++ > 0) {
+        return;
+    }
+    d->m_updatingUnits = d->units();
+    for (const auto &unit : qAsConst(d->m_updatingUnits)) {
+        unit->beginUpdate();
+    }
+}
+
+void SkeletonResource::endUpdate()
+{
+    Q_ASSERT(d->m_updateDepth > 0);
+    if (d->m_updateDepth <= 0 || --d->m_updateDepth > 0) {
+        return;
+    }
+    const auto units = d->m_updatingUnits;
+    d->m_updatingUnits.clear();
+    for (const auto &unit : units) {
+        unit->endUpdate();
+    }
+}
+
 bool SkeletonResource::isModified() const
 {
     return d->m_modified;
@@ -406,6 +445,17 @@ QVector<std::shared_ptr<Unit>> SkeletonResource::units()
     return d->units();
 }
 
+ConstRange<std::shared_ptr<Unit>> SkeletonResource::unitRange()
+{
+    const auto &units = d->units();
+    return ConstRange<std::shared_ptr<Unit>>(units.constData(), units.constData() + units.count());
+}
+
+int SkeletonResource::unitCount()
+{
+    return d->units().count();
+}
+
 QUrl SkeletonResource::file() const
 {
     return d->m_path;
@@ -41,6 +41,8 @@ public:
     QString languageTitle() const override;
     void setLanguage(std::shared_ptr<ILanguage> language) override;
     QVector<std::shared_ptr<Unit>> units() override;
+    ConstRange<std::shared_ptr<Unit>> unitRange() override;
+    int unitCount() override;
     QUrl file() const override;
     bool exportToFile(const QUrl &filePath) const override;
     Q_INVOKABLE bool createPhraseAfter(IPhrase *previousPhrase) override;
@@ -48,6 +50,8 @@ public:
     std::shared_ptr<Unit> addUnit(std::shared_ptr<Unit> unit) override;
     bool sync() override;
     void updateFrom(std::shared_ptr<ICourse>) override;
+    void beginUpdate() override;
+    void endUpdate() override;
     bool isModified() const override;
     std::shared_ptr<IEditableCourse> self() const override;
 
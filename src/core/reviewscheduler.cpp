@@ -0,0 +1,229 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "reviewscheduler.h"
+#include <QtMath>
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+namespace
+{
+// failed items are repeated within the same session after a short relearning step
+constexpr int relearnDelaySeconds {10 * 60};
+constexpr double minimumEasiness {1.3};
+}
+
+ReviewScheduler::ReviewScheduler() = default;
+
+void ReviewScheduler::clear()
+{
+    m_heap.clear();
+    m_items.clear();
+    m_sequence = 0;
+}
+
+void ReviewScheduler::insert(const QString &item, const LearnerProfile::ReviewState &state)
+{
+    push(item, state);
+}
+
+bool ReviewScheduler::contains(const QString &item) const
+{
+    return m_items.contains(item);
+}
+
+int ReviewScheduler::count() const
+{
+    return m_items.count();
+}
+
+LearnerProfile::ReviewState ReviewScheduler::state(const QString &item) const
+{
+    return m_items.value(item).state;
+}
+
+QString ReviewScheduler::next(const QDateTime &now)
+{
+    dropStaleEntries();
+    if (m_heap.empty() || m_heap.front().due > now.toMSecsSinceEpoch()) {
+        return QString();
+    }
+    return m_heap.front().item;
+}
+
+QStringList ReviewScheduler::upcoming(const QDateTime &now, int count) const
+{
+    QStringList result;
+    const qint64 nowKey = now.toMSecsSinceEpoch();
+    // best-first walk over the heap, children of an entry are never due earlier than the entry
+    auto laterIndex = [this](std::size_t lhs, std::size_t rhs) {
+        return later(m_heap[lhs], m_heap[rhs]);
+    };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(laterIndex)> frontier(laterIndex);
+    if (!m_heap.empty()) {
+        frontier.push(0);
+    }
+    while (!frontier.empty() && result.count() < count) {
+        const std::size_t index = frontier.top();
+        frontier.pop();
+        const Entry &entry = m_heap[index];
+        if (entry.due > nowKey) {
+            break;
+        }
+        auto iter = m_items.constFind(entry.item);
+        if (iter != m_items.constEnd() && iter->sequence == entry.sequence) {
+            result.append(entry.item);
+        }
+        for (std::size_t child = 2 * index + 1; child <= 2 * index + 2 && child < m_heap.size(); ++child) {
+            frontier.push(child);
+        }
+    }
+    return result;
+}
+
+bool ReviewScheduler::hasDueItem(const QDateTime &now, const QString &except) const
+{
+    dropStaleEntries();
+    const qint64 nowKey = now.toMSecsSinceEpoch();
+    if (m_heap.empty() || m_heap.front().due > nowKey) {
+        return false;
+    }
+    if (m_heap.front().item != except) {
+        return true;
+    }
+    // the earlier child of the root is the second item unless it is stale
+    while (m_heap.size() > 1) {
+        std::size_t child = 1;
+        if (child + 1 < m_heap.size() && later(m_heap[child], m_heap[child + 1])) {
+            ++child;
+        }
+        if (!isStale(m_heap[child])) {
+            return m_heap[child].due <= nowKey;
+        }
+        removeEntry(child);
+    }
+    return false;
+}
+
+int ReviewScheduler::dueCount(const QDateTime &now) const
+{
+    const qint64 nowKey = now.toMSecsSinceEpoch();
+    int count {0};
+    for (auto iter = m_items.constBegin(); iter != m_items.constEnd(); ++iter) {
+        if (dueKey(iter->state) <= nowKey) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+LearnerProfile::ReviewState ReviewScheduler::review(const QString &item, Grade grade, const QDateTime &now)
+{
+    const auto state = schedule(m_items.value(item).state, grade, now);
+    push(item, state);
+    return state;
+}
+
+LearnerProfile::ReviewState ReviewScheduler::schedule(const LearnerProfile::ReviewState &state, Grade grade, const QDateTime &now)
+{
+    LearnerProfile::ReviewState result {state};
+    const int quality = static_cast<int>(grade);
+    result.easiness = qMax(minimumEasiness, state.easiness + (0.1 - (5 - quality) * (0.08 + (5 - quality) * 0.02)));
+
+    if (quality < static_cast<int>(CorrectWithEffort)) {
+        result.repetitions = 0;
+        result.interval = 0;
+        result.due = now.addSecs(relearnDelaySeconds);
+        return result;
+    }
+    if (state.repetitions == 0) {
+        result.interval = 1;
+    } else if (state.repetitions == 1) {
+        result.interval = 6;
+    } else {
+        result.interval = qCeil(state.interval * state.easiness);
+    }
+    ++result.repetitions;
+    result.due = now.addDays(result.interval);
+    return result;
+}
+
+bool ReviewScheduler::later(const Entry &lhs, const Entry &rhs)
+{
+    if (lhs.due != rhs.due) {
+        return lhs.due > rhs.due;
+    }
+    return lhs.sequence > rhs.sequence;
+}
+
+qint64 ReviewScheduler::dueKey(const LearnerProfile::ReviewState &state)
+{
+    return state.due.isValid() ? state.due.toMSecsSinceEpoch() : std::numeric_limits<qint64>::min();
+}
+
+void ReviewScheduler::push(const QString &item, const LearnerProfile::ReviewState &state)
+{
+    const quint64 sequence = m_sequence++;
+    m_items.insert(item, Item {state, sequence});
+    m_heap.push_back(Entry {dueKey(state), sequence, item});
+    std::push_heap(m_heap.begin(), m_heap.end(), &ReviewScheduler::later);
+    if (m_heap.size() > 2 * static_cast<std::size_t>(m_items.count()) + 64) {
+        compact();
+    }
+}
+
+bool ReviewScheduler::isStale(const Entry &entry) const
+{
+    auto iter = m_items.constFind(entry.item);
+    return iter == m_items.constEnd() || iter->sequence != entry.sequence;
+}
+
+void ReviewScheduler::dropStaleEntries() const
+{
+    while (!m_heap.empty() && isStale(m_heap.front())) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), &ReviewScheduler::later);
+        m_heap.pop_back();
+    }
+}
+
+void ReviewScheduler::removeEntry(std::size_t index) const
+{
+    m_heap[index] = std::move(m_heap.back());
+    m_heap.pop_back();
+    if (index >= m_heap.size()) {
+        return;
+    }
+    // the moved entry either rises towards the root or sinks towards the leaves
+    while (index > 0 && later(m_heap[(index - 1) / 2], m_heap[index])) {
+        std::swap(m_heap[(index - 1) / 2], m_heap[index]);
+        index = (index - 1) / 2;
+    }
+    while (true) {
+        std::size_t earliest = index;
+        for (std::size_t child = 2 * index + 1; child <= 2 * index + 2 && child < m_heap.size(); ++child) {
+            if (later(m_heap[earliest], m_heap[child])) {
+                earliest = child;
+            }
+        }
+        if (earliest == index) {
+            return;
+        }
+        std::swap(m_heap[earliest], m_heap[index]);
+        index = earliest;
+    }
+}
+
+void ReviewScheduler::compact()
+{
+    m_heap.erase(std::remove_if(m_heap.begin(),
+                                m_heap.end(),
+                                [this](const Entry &entry) {
+                                    return isStale(entry);
+                                }),
+                 m_heap.end());
+    std::make_heap(m_heap.begin(), m_heap.end(), &ReviewScheduler::later);
+}
@@ -0,0 +1,98 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef REVIEWSCHEDULER_H
+#define REVIEWSCHEDULER_H
+
+#include "artikulatecore_export.h"
+#include "liblearnerprofile/src/reviewstate.h"
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <vector>
+
+/**
+ * \class ReviewScheduler
+ * SM-2 based spaced repetition scheduler for the phrases of a course.
+ *
+ * Items are kept in a min-heap ordered by due date; items that were never reviewed are due
+ * immediately and are handed out in insertion order. Picking the next item and rescheduling
+ * a reviewed item are O(log n) operations.
+ */
+class ARTIKULATECORE_EXPORT ReviewScheduler
+{
+public:
+    /**
+     * SM-2 quality of a response
+     */
+    enum Grade { Blackout = 0, Incorrect = 1, IncorrectButFamiliar = 2, CorrectWithEffort = 3, Correct = 4, Perfect = 5 };
+
+    ReviewScheduler();
+
+    void clear();
+    /**
+     * @brief add item with previously persisted @p state, an existing item is replaced
+     */
+    void insert(const QString &item, const LearnerProfile::ReviewState &state = LearnerProfile::ReviewState());
+    bool contains(const QString &item) const;
+    int count() const;
+    LearnerProfile::ReviewState state(const QString &item) const;
+    /**
+     * @return item with the earliest due date if it is due at @p now, otherwise an empty string
+     */
+    QString next(const QDateTime &now);
+    /**
+     * @return up to @p count items due at @p now in the order they will be returned by next()
+     * @note this operation is O(count log count) and does not modify the scheduler
+     */
+    QStringList upcoming(const QDateTime &now, int count) const;
+    /**
+     * @return true if any item other than @p except is due at @p now
+     * @note this operation is O(log n), amortized over the removal of rescheduled entries
+     */
+    bool hasDueItem(const QDateTime &now, const QString &except = QString()) const;
+    /**
+     * @return number of items due at @p now
+     * @note this operation is linear in the number of items
+     */
+    int dueCount(const QDateTime &now) const;
+    /**
+     * @brief reschedule @p item according to the given @p grade
+     * @return the updated state, which shall be persisted by the caller
+     */
+    LearnerProfile::ReviewState review(const QString &item, Grade grade, const QDateTime &now);
+    /**
+     * @brief compute SM-2 successor of @p state without modifying the scheduler
+     */
+    static LearnerProfile::ReviewState schedule(const LearnerProfile::ReviewState &state, Grade grade, const QDateTime &now);
+
+private:
+    struct Entry {
+        qint64 due;
+        quint64 sequence;
+        QString item;
+    };
+    struct Item {
+        LearnerProfile::ReviewState state;
+        quint64 sequence;
+    };
+    static bool later(const Entry &lhs, const Entry &rhs);
+    static qint64 dueKey(const LearnerProfile::ReviewState &state);
+    void push(const QString &item, const LearnerProfile::ReviewState &state);
+    bool isStale(const Entry &entry) const;
+    void dropStaleEntries() const;
+    /**
+     * @brief remove heap entry at @p index and restore the heap property
+     */
+    void removeEntry(std::size_t index) const;
+    void compact();
+
+    mutable std::vector<Entry> m_heap; //!< min-heap, may contain stale entries of rescheduled items
+    QHash<QString, Item> m_items;
+    quint64 m_sequence {0};
+};
+
+#endif
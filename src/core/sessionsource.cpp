@@ -0,0 +1,48 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "sessionsource.h"
+#include "icourse.h"
+
+SessionSource::~SessionSource() = default;
+
+void SessionSource::setFilter(const Filter &filter)
+{
+    m_filter = filter;
+}
+
+SessionSource::Filter SessionSource::filter() const
+{
+    return m_filter;
+}
+
+void SessionSource::setProgressProvider(ProgressProvider provider)
+{
+    m_progressProvider = std::move(provider);
+}
+
+bool SessionSource::accepts(const IPhrase *phrase, const QHash<QString, int> &progress) const
+{
+    if (m_filter.type != IPhrase::Type::AllTypes && phrase->type() != m_filter.type) {
+        return false;
+    }
+    if (m_filter.soundRequired && phrase->sound().isEmpty()) {
+        return false;
+    }
+    if (m_filter.maximumProgress >= 0 && progress.value(phrase->id(), 0) > m_filter.maximumProgress) {
+        return false;
+    }
+    return true;
+}
+
+QHash<QString, int> SessionSource::progressValues(ICourse *course) const
+{
+    // progress is only needed when filtering by it
+    if (!m_progressProvider || m_filter.maximumProgress < 0) {
+        return QHash<QString, int>();
+    }
+    return m_progressProvider(course);
+}
@@ -0,0 +1,70 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef SESSIONSOURCE_H
+#define SESSIONSOURCE_H
+
+#include "artikulatecore_export.h"
+#include "iphrase.h"
+#include <QHash>
+#include <functional>
+#include <memory>
+
+class ICourse;
+
+/**
+ * \class SessionSource
+ * Stream of phrases for a training session that is not bound to a single course.
+ *
+ * Implementations produce phrases lazily, i.e. course data is only accessed when the stream reaches it.
+ */
+class ARTIKULATECORE_EXPORT SessionSource
+{
+public:
+    struct Entry {
+        std::shared_ptr<IPhrase> phrase;
+        std::shared_ptr<ICourse> course;
+        bool isValid() const
+        {
+            return phrase != nullptr;
+        }
+    };
+    struct Filter {
+        IPhrase::Type type {IPhrase::Type::AllTypes};
+        /**
+         * phrases with a higher progress value are skipped, a negative value disables the check
+         */
+        int maximumProgress {-1};
+        bool soundRequired {true};
+    };
+    /**
+     * returns progress values of all phrases of a course, keyed by phrase id
+     */
+    using ProgressProvider = std::function<QHash<QString, int>(ICourse *course)>;
+
+    virtual ~SessionSource();
+    /**
+     * @return next phrase accepted by the filter or an invalid entry if the stream is exhausted
+     */
+    virtual Entry next() = 0;
+    virtual void reset() = 0;
+    void setFilter(const Filter &filter);
+    Filter filter() const;
+    void setProgressProvider(ProgressProvider provider);
+
+protected:
+    /**
+     * @brief test @p phrase against the filter, @p progress are the progress values of its course
+     */
+    bool accepts(const IPhrase *phrase, const QHash<QString, int> &progress) const;
+    QHash<QString, int> progressValues(ICourse *course) const;
+
+private:
+    Filter m_filter;
+    ProgressProvider m_progressProvider;
+};
+
+#endif
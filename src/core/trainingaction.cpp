@@ -6,6 +6,7 @@
 
 #include "trainingaction.h"
 #include "drawertrainingactions.h"
+#include "trainingactionpool.h"
 #include <QQmlEngine>
 
 TrainingAction::TrainingAction(QObject *parent)
@@ -24,20 +25,22 @@ TrainingAction::TrainingAction(const QString &text, QObject *parent)
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
 }
 
+TrainingAction::TrainingAction(const QString &text, TrainingActionPool *pool, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_text(text)
+    , m_icon(nullptr, QString())
+    , m_pool(pool)
+{
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+}
+
 TrainingAction::TrainingAction(std::shared_ptr<IPhrase> phrase, ISessionActions *session, QObject *parent)
     : QAbstractListModel(parent)
     , m_icon(nullptr, QString())
-    , m_phrase(phrase)
     , m_session(session)
 {
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
-    if (m_phrase) {
-        m_text = phrase->text();
-    }
-    connect(phrase.get(), &IPhrase::textChanged, this, [=]() {
-        m_text = phrase->text();
-        emit textChanged(m_text);
-    });
+    setPhrase(phrase);
 }
 
 QHash<int, QByteArray> TrainingAction::roleNames() const
@@ -71,7 +74,7 @@ QVariant TrainingAction::data(const QModelIndex &index, int role) const
 
     switch (role) {
         case ModelDataRole:
-            return QVariant::fromValue<QObject *>(m_actions.at(index.row()));
+            return QVariant::fromValue<QObject *>(action(index.row()));
         case Qt::DisplayRole:
             return m_text;
         default:
@@ -84,6 +87,7 @@ void TrainingAction::trigger()
     if (m_phrase && m_session) {
         m_session->setActivePhrase(m_phrase.get());
     }
+    emit triggered();
 }
 
 bool TrainingAction::enabled() const
@@ -138,9 +142,29 @@ IPhrase *TrainingAction::phrase() const
     return m_phrase.get();
 }
 
+void TrainingAction::setPhrase(std::shared_ptr<IPhrase> phrase)
+{
+    disconnect(m_phraseConnection);
+    m_phrase = std::move(phrase);
+    setChecked(false);
+    if (!m_phrase) {
+        setText(QString());
+        return;
+    }
+    setText(m_phrase->text());
+    m_phraseConnection = connect(m_phrase.get(), &IPhrase::textChanged, this, [this]() {
+        setText(m_phrase->text());
+    });
+}
+
 QVector<TrainingAction *> TrainingAction::actions() const
 {
-    return m_actions;
+    QVector<TrainingAction *> actions;
+    actions.reserve(m_actions.count());
+    for (int i = 0; i < m_actions.count(); ++i) {
+        actions.append(action(i));
+    }
+    return actions;
 }
 
 QAbstractListModel *TrainingAction::actionModel()
@@ -159,22 +183,124 @@ TrainingAction *TrainingAction::action(int index) const
         qWarning() << "index not in range, aborting";
         return nullptr;
     }
-    return m_actions.at(index);
+    SubAction &subAction = m_actions[index];
+    if (!subAction.action) {
+        Q_ASSERT(m_pool);
+        subAction.action = m_pool->acquire(subAction.phrase);
+    }
+    return subAction.action;
+}
+
+IPhrase *TrainingAction::phraseAt(int index) const
+{
+    if (index < 0 || index >= m_actions.count()) {
+        qWarning() << "index not in range, aborting";
+        return nullptr;
+    }
+    return m_actions.at(index).phrase.get();
+}
+
+int TrainingAction::indexOf(const IPhrase *phrase) const
+{
+    for (int i = 0; i < m_actions.count(); ++i) {
+        if (m_actions.at(i).phrase.get() == phrase) {
+            return i;
+        }
+    }
+    return -1;
 }
 
 void TrainingAction::appendAction(TrainingAction *action)
 {
     beginInsertRows(QModelIndex(), m_actions.count(), m_actions.count());
-    m_actions.append(action);
+    m_actions.append(SubAction {action->m_phrase, action});
     endInsertRows();
     emit actionsChanged();
 }
 
+void TrainingAction::appendPhrase(std::shared_ptr<IPhrase> phrase)
+{
+    insertPhrase(m_actions.count(), phrase);
+}
+
+void TrainingAction::insertPhrase(int index, std::shared_ptr<IPhrase> phrase)
+{
+    Q_ASSERT(index >= 0 && index <= m_actions.count());
+    beginInsertRows(QModelIndex(), index, index);
+    m_actions.insert(index, SubAction {phrase, nullptr});
+    endInsertRows();
+    emit actionsChanged();
+}
+
+void TrainingAction::removeAction(int index)
+{
+    if (index < 0 || index >= m_actions.count()) {
+        qWarning() << "index not in range, aborting";
+        return;
+    }
+    beginRemoveRows(QModelIndex(), index, index);
+    const auto subAction = m_actions.takeAt(index);
+    endRemoveRows();
+    releaseAction(subAction.action);
+    emit actionsChanged();
+}
+
 void TrainingAction::clearActions()
 {
     beginResetModel();
+    for (const auto &subAction : qAsConst(m_actions)) {
+        releaseAction(subAction.action);
+    }
+    m_actions.clear();
+    endResetModel();
+    emit actionsChanged();
+}
+
+void TrainingAction::releaseActions()
+{
+    if (!m_pool) {
+        return;
+    }
+    // nothing to release if no row was accessed since the last release
+    bool created {false};
+    for (const auto &subAction : qAsConst(m_actions)) {
+        if (subAction.action && subAction.action->parent() == m_pool) {
+            created = true;
+            break;
+        }
+    }
+    if (!created) {
+        return;
+    }
+    beginResetModel();
+    for (auto &subAction : m_actions) {
+        if (subAction.action && subAction.action->parent() == m_pool) {
+            releaseAction(subAction.action);
+            subAction.action = nullptr;
+        }
+    }
+    endResetModel();
+}
+
+void TrainingAction::setPhrases(ConstRange<std::shared_ptr<IPhrase>> phrases)
+{
+    beginResetModel();
+    for (const auto &subAction : qAsConst(m_actions)) {
+        releaseAction(subAction.action);
+    }
     m_actions.clear();
-    qDeleteAll(m_actions);
+    m_actions.reserve(phrases.count());
+    for (const auto &phrase : phrases) {
+        m_actions.append(SubAction {phrase, nullptr});
+    }
     endResetModel();
     emit actionsChanged();
 }
+
+void TrainingAction::releaseAction(TrainingAction *action)
+{
+    // only actions created from the pool are owned by this action
+    if (action && m_pool && action->parent() == m_pool) {
+        m_pool->release(action);
+    }
+}
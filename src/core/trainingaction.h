@@ -8,6 +8,7 @@
 #define TRAININGACTION_H
 
 #include "artikulatecore_export.h"
+#include "constrange.h"
 #include "iphrase.h"
 #include "trainingactionicon.h"
 #include "trainingsession.h"
@@ -16,6 +17,7 @@
 #include <QObject>
 
 class DrawerTrainingActions;
+class TrainingActionPool;
 
 class ARTIKULATECORE_EXPORT TrainingAction : public QAbstractListModel
 {
@@ -37,6 +39,10 @@ public:
 
     explicit TrainingAction(QObject *parent = nullptr);
     explicit TrainingAction(const QString &text, QObject *parent = nullptr);
+    /**
+     * @brief create action whose phrase sub-actions are taken from @p pool when first accessed
+     */
+    TrainingAction(const QString &text, TrainingActionPool *pool, QObject *parent = nullptr);
     TrainingAction(std::shared_ptr<IPhrase> phrase, ISessionActions *session, QObject *parent = nullptr);
     Q_INVOKABLE void trigger();
     bool enabled() const;
@@ -47,29 +53,76 @@ public:
     bool checked() const;
     QObject *icon();
     IPhrase *phrase() const;
+    /**
+     * @brief rebind action to @p phrase, used when recycling actions
+     */
+    void setPhrase(std::shared_ptr<IPhrase> phrase);
     QAbstractListModel *actionModel();
+    /**
+     * @return all sub-actions
+     * @note this creates action objects for all rows, prefer action() and phraseAt() for single rows
+     */
     QVector<TrainingAction *> actions() const;
     int actionsCount() const;
     bool hasActions()
     {
         return m_actions.count() > 0;
     }
+    /**
+     * @return sub-action at @p index, which is created on first access
+     */
     TrainingAction *action(int index) const;
+    /**
+     * @return phrase of sub-action at @p index without creating the action object
+     */
+    IPhrase *phraseAt(int index) const;
+    /**
+     * @return row of the sub-action of @p phrase or -1, linear in the number of sub-actions
+     */
+    int indexOf(const IPhrase *phrase) const;
     void appendAction(TrainingAction *action);
+    void appendPhrase(std::shared_ptr<IPhrase> phrase);
+    void insertPhrase(int index, std::shared_ptr<IPhrase> phrase);
+    /**
+     * @brief remove sub-action at @p index, a created action object is returned to the pool
+     */
+    void removeAction(int index);
     void clearActions();
+    /**
+     * @brief return all created sub-action objects to the pool, while keeping the rows
+     *
+     * Views showing the rows are reset and recreate the objects on their next access.
+     */
+    void releaseActions();
+    /**
+     * @brief replace all sub-actions by actions for @p phrases with a single model reset
+     */
+    void setPhrases(ConstRange<std::shared_ptr<IPhrase>> phrases);
     QHash<int, QByteArray> roleNames() const override;
     int columnCount(const QModelIndex &parent) const override;
     int rowCount(const QModelIndex &parent) const override;
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
 
 Q_SIGNALS:
+    /**
+     * @brief emitted by trigger(), used by sessions to open the unit of a unit action
+     */
+    void triggered();
     void actionsChanged();
     void enabledChanged(bool enabled);
     void checkedChanged(bool checked);
     void textChanged(QString text);
 
 private:
-    QVector<TrainingAction *> m_actions;
+    struct SubAction {
+        std::shared_ptr<IPhrase> phrase;
+        TrainingAction *action;
+    };
+    void releaseAction(TrainingAction *action);
+
+    mutable QVector<SubAction> m_actions;
+    TrainingActionPool *m_pool {nullptr};
+    QMetaObject::Connection m_phraseConnection;
     QString m_text;
     TrainingActionIcon m_icon;
     bool m_visible {true};
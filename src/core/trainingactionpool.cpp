@@ -0,0 +1,58 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "trainingactionpool.h"
+#include "isessionactions.h"
+#include "trainingaction.h"
+
+namespace
+{
+// upper bound of kept actions, roughly the number of rows a drawer can show at once several times over
+constexpr int maximumFreeActions {256};
+}
+
+TrainingActionPool::TrainingActionPool(ISessionActions *session)
+    : QObject(session)
+    , m_session(session)
+{
+}
+
+TrainingActionPool::~TrainingActionPool() = default;
+
+TrainingAction *TrainingActionPool::acquire(std::shared_ptr<IPhrase> phrase)
+{
+    if (!m_free.isEmpty()) {
+        auto action = m_free.takeLast();
+        action->setPhrase(phrase);
+        return action;
+    }
+    ++m_created;
+    return new TrainingAction(phrase, m_session, this);
+}
+
+void TrainingActionPool::release(TrainingAction *action)
+{
+    if (!action) {
+        return;
+    }
+    // drop reference to the phrase, such that phrases of closed courses can be released
+    action->setPhrase(nullptr);
+    if (m_free.count() >= maximumFreeActions) {
+        action->deleteLater();
+        return;
+    }
+    m_free.append(action);
+}
+
+int TrainingActionPool::freeCount() const
+{
+    return m_free.count();
+}
+
+int TrainingActionPool::createdCount() const
+{
+    return m_created;
+}
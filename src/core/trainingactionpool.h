@@ -0,0 +1,52 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef TRAININGACTIONPOOL_H
+#define TRAININGACTIONPOOL_H
+
+#include "artikulatecore_export.h"
+#include <QObject>
+#include <QVector>
+#include <memory>
+
+class IPhrase;
+class ISessionActions;
+class TrainingAction;
+
+/**
+ * \class TrainingActionPool
+ *
+ * Recycles phrase actions of a session. Unit actions only request phrase actions for rows that are
+ * actually accessed, e.g. by visible delegates, and return them here when the course changes.
+ */
+class ARTIKULATECORE_EXPORT TrainingActionPool : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TrainingActionPool(ISessionActions *session);
+    ~TrainingActionPool() override;
+    /**
+     * @return action for @p phrase, either recycled or newly created
+     */
+    TrainingAction *acquire(std::shared_ptr<IPhrase> phrase);
+    void release(TrainingAction *action);
+    /**
+     * @return number of actions available for reuse
+     */
+    int freeCount() const;
+    /**
+     * @return number of actions ever created by this pool
+     */
+    int createdCount() const;
+
+private:
+    ISessionActions *m_session;
+    QVector<TrainingAction *> m_free;
+    int m_created {0};
+};
+
+#endif
@@ -11,15 +11,31 @@
 #include "core/phrase.h"
 #include "core/unit.h"
 #include "learner.h"
+#include "phraseprefetcher.h"
 #include "profilemanager.h"
 #include "trainingaction.h"
+#include "trainingactionpool.h"
+#include <QDateTime>
 
 TrainingSession::TrainingSession(LearnerProfile::ProfileManager *manager, QObject *parent)
     : ISessionActions(parent)
     , m_profileManager(manager)
     , m_course(nullptr)
+    , m_actionPool(new TrainingActionPool(this))
+    , m_prefetcher(new PhrasePrefetcher(this))
+    , m_phonemeStatistics(manager)
+    , m_triesHistogram(static_cast<int>(IPhrase::Type::AllTypes))
 {
     Q_ASSERT(m_profileManager != nullptr);
+    connect(m_profileManager, &LearnerProfile::ProfileManager::activeProfileChanged, this, &TrainingSession::loadLearnerProgress);
+    connect(this, &TrainingSession::phraseChanged, this, &TrainingSession::prefetchUpcomingPhrases);
+    connect(this, &TrainingSession::completed, this, [this]() {
+        m_completed = true;
+    });
+    // the drawer returns to the unit list on closeUnit()
+    connect(this, &TrainingSession::closeUnit, this, [this]() {
+        setOpenUnit(-1);
+    });
 }
 
 ICourse *TrainingSession::course() const
@@ -33,24 +49,25 @@ void TrainingSession::setCourse(ICourse *course)
         updateTrainingActions();
         return;
     }
-    if (m_course == course) {
+    if (m_course == course && !m_source) {
         return;
     }
+    m_source.reset();
+    m_sourceEntry = SessionSource::Entry();
+    m_nextSourceEntry = SessionSource::Entry();
     m_course = course;
-    if (m_course && m_course->units().count() > 0) {
-        setUnit(m_course->units().constFirst().get());
+    if (m_course && m_course->unitCount() > 0) {
+        setUnit(m_course->unitRange().first().get());
     }
 
     // lazy loading of training data
-    LearnerProfile::LearningGoal *goal = m_profileManager->goal(LearnerProfile::LearningGoal::Language, m_course->id());
+    LearnerProfile::LearningGoal *goal = languageGoal(m_course);
     if (!goal) {
         goal = m_profileManager->registerGoal(LearnerProfile::LearningGoal::Language, course->language()->id(), course->language()->i18nTitle());
     }
     auto data = m_profileManager->progressValues(m_profileManager->activeProfile(), goal, m_course->id());
-    const auto unitList = m_course->units();
-    for (auto unit : qAsConst(unitList)) {
-        const auto phrases = unit->phrases();
-        for (auto &phrase : phrases) {
+    for (const auto &unit : m_course->unitRange()) {
+        for (const auto &phrase : unit->phraseRange()) {
             auto iter = data.find(phrase->id());
             if (iter != data.end()) {
                 //                phrase->setProgress(iter.value()); //FIXME add a decorator?
@@ -58,9 +75,43 @@ void TrainingSession::setCourse(ICourse *course)
         }
     }
     updateTrainingActions();
+    IPhrase *resumePhrase = restoreSessionSnapshot();
+    if (m_mode == SpacedRepetitionMode) {
+        selectNextScheduledPhrase();
+    } else if (m_mode == PhonemeFocusMode) {
+        startPhonemeFocus();
+    } else if (resumePhrase) {
+        setActivePhrase(resumePhrase);
+    }
     emit courseChanged();
 }
 
+void TrainingSession::setSource(std::unique_ptr<SessionSource> source)
+{
+    m_course = nullptr;
+    updateTrainingActions();
+    m_sourceCourses.clear();
+    m_source = std::move(source);
+    m_sourceEntry = SessionSource::Entry();
+    m_nextSourceEntry = SessionSource::Entry();
+    if (m_source) {
+        m_source->setProgressProvider([this](ICourse *course) {
+            return m_profileManager->progressValues(m_profileManager->activeProfile(), languageGoal(course), course->id());
+        });
+        m_source->reset();
+        m_nextSourceEntry = m_source->next();
+    }
+    emit courseChanged();
+    if (m_source) {
+        selectNextSourcePhrase();
+    }
+}
+
+SessionSource *TrainingSession::source() const
+{
+    return m_source.get();
+}
+
 IUnit *TrainingSession::activeUnit() const
 {
     if (auto phrase = activePhrase()) {
@@ -71,23 +122,10 @@ IUnit *TrainingSession::activeUnit() const
 
 void TrainingSession::setUnit(IUnit *unit)
 {
-    // checking phrases in increasing order ensures that always the first phrase is selected
-    for (int i = 0; i < m_actions.count(); ++i) {
-        for (int j = 0; j < m_actions.at(i)->actions().count(); ++j) {
-            const auto testPhrase = qobject_cast<TrainingAction *>(m_actions.at(i)->actions().at(j))->phrase();
-            if (unit == testPhrase->unit().get()) {
-                if (auto action = activeAction()) {
-                    action->setChecked(false);
-                }
-                m_indexUnit = i;
-                m_indexPhrase = j;
-                if (auto action = activeAction()) {
-                    action->setChecked(true);
-                }
-                emit phraseChanged();
-                return;
-            }
-        }
+    // unit actions always start with the unit's first phrase
+    auto iter = m_unitIndex.constFind(unit);
+    if (iter != m_unitIndex.constEnd()) {
+        selectAction(iter.value(), 0);
     }
 }
 
@@ -96,11 +134,14 @@ TrainingAction *TrainingSession::activeAction() const
     if (m_indexUnit < 0 || m_indexPhrase < 0) {
         return nullptr;
     }
-    return qobject_cast<TrainingAction *>(m_actions.at(m_indexUnit)->actions().at(m_indexPhrase));
+    return m_actions.at(m_indexUnit)->action(m_indexPhrase);
 }
 
 IPhrase *TrainingSession::activePhrase() const
 {
+    if (m_source) {
+        return m_sourceEntry.phrase.get();
+    }
     if (const auto action = activeAction()) {
         return action->phrase();
     }
@@ -109,85 +150,252 @@ IPhrase *TrainingSession::activePhrase() const
 
 void TrainingSession::setActivePhrase(IPhrase *phrase)
 {
-    for (int i = 0; i < m_actions.count(); ++i) {
-        for (int j = 0; j < m_actions.at(i)->actions().count(); ++j) {
-            const auto testPhrase = qobject_cast<TrainingAction *>(m_actions.at(i)->actions().at(j))->phrase();
-            if (phrase == testPhrase) {
-                if (auto action = activeAction()) {
-                    action->setChecked(false);
-                }
-                m_indexUnit = i;
-                m_indexPhrase = j;
-                if (auto action = activeAction()) {
-                    action->setChecked(true);
-                }
-                emit phraseChanged();
-                return;
-            }
-        }
+    if (!phrase || !phrase->unit()) {
+        return;
+    }
+    auto iter = m_unitIndex.constFind(phrase->unit().get());
+    if (iter == m_unitIndex.constEnd()) {
+        return;
+    }
+    const int phraseIndex = m_actions.at(iter.value())->indexOf(phrase);
+    if (phraseIndex >= 0) {
+        selectAction(iter.value(), phraseIndex);
+    }
+}
+
+void TrainingSession::selectAction(int unitIndex, int phraseIndex)
+{
+    if (auto action = activeAction()) {
+        action->setChecked(false);
     }
+    const int previousUnit = m_indexUnit;
+    m_indexUnit = unitIndex;
+    m_indexPhrase = phraseIndex;
+    // released objects are recycled for the rows of the new unit
+    releaseHiddenActions(previousUnit);
+    if (auto action = activeAction()) {
+        action->setChecked(true);
+    }
+    emit phraseChanged();
+}
+
+void TrainingSession::setOpenUnit(int unitIndex)
+{
+    const int previousUnit = m_openUnit;
+    m_openUnit = unitIndex;
+    releaseHiddenActions(previousUnit);
+}
+
+void TrainingSession::releaseHiddenActions(int unitIndex)
+{
+    if (unitIndex < 0 || unitIndex >= m_actions.count() || unitIndex == m_indexUnit || unitIndex == m_openUnit) {
+        return;
+    }
+    m_actions.at(unitIndex)->releaseActions();
 }
 
 void TrainingSession::accept()
 {
-    Q_ASSERT(m_indexUnit >= 0);
-    Q_ASSERT(m_indexPhrase >= 0);
-    if (m_indexUnit < 0 || m_indexPhrase < 0) {
+    Q_ASSERT(activePhrase() != nullptr);
+    if (!activePhrase()) {
         return;
     }
-    auto phrase = activePhrase();
 
+    // all records of a training step are written in a single transaction
+    m_profileManager->beginTransaction();
     // possibly update goals of learner
     updateGoal();
-    //    phrase->updateProgress(Phrase::Progress::Done); //FIXME
-
-    // store training activity
-    LearnerProfile::LearningGoal *goal = m_profileManager->goal(LearnerProfile::LearningGoal::Language, m_course->language()->id());
-    //    m_profileManager->recordProgress(m_profileManager->activeProfile(), //FIXME
-    //        goal,
-    //        m_course->id(),
-    //        phrase->id(),
-    //        static_cast<int>(LearnerProfile::ProfileManager::Skip),
-    //        phrase->progress()
-    //    );
-
+    updateTriesStatistics(activePhrase(), true);
+    reviewActivePhrase(ReviewScheduler::Correct, static_cast<int>(LearnerProfile::ProfileManager::Next));
+    m_completed = false;
     selectNextPhrase();
+    storeSessionPosition();
+    m_profileManager->commitTransaction();
 }
 
 void TrainingSession::skip()
 {
-    Q_ASSERT(m_indexUnit >= 0);
-    Q_ASSERT(m_indexPhrase >= 0);
-    if (m_indexUnit < 0 || m_indexPhrase < 0) {
+    Q_ASSERT(activePhrase() != nullptr);
+    if (!activePhrase()) {
         return;
     }
 
+    // all records of a training step are written in a single transaction
+    m_profileManager->beginTransaction();
     // possibly update goals of learner
     updateGoal();
+    updateTriesStatistics(activePhrase(), false);
+    reviewActivePhrase(ReviewScheduler::Incorrect, static_cast<int>(LearnerProfile::ProfileManager::Skip));
+    m_completed = false;
+    selectNextPhrase();
+    storeSessionPosition();
+    m_profileManager->commitTransaction();
+}
+
+void TrainingSession::reviewActivePhrase(ReviewScheduler::Grade grade, int logPayload)
+{
     auto phrase = activePhrase();
-    //    phrase->updateProgress(Phrase::Progress::Skip); //FIXME
-
-    // store training activity
-    LearnerProfile::LearningGoal *goal = m_profileManager->goal(LearnerProfile::LearningGoal::Language, m_course->language()->id());
-    //    m_profileManager->recordProgress(m_profileManager->activeProfile(),
-    //        goal,
-    //        m_course->id(),
-    //        phrase->id(),
-    //        static_cast<int>(LearnerProfile::ProfileManager::Skip),
-    //        phrase->progress()
-    //    ); // FIXME
+    if (!phrase) {
+        return;
+    }
+    ICourse *course = activeCourse();
+    if (m_source) {
+        loadSourceProgress(course);
+    }
+    // reviews are tracked in every mode, such that switching to spaced repetition uses the full history
+    const auto state = m_scheduler.review(reviewItem(course, phrase->id()), grade, QDateTime::currentDateTime());
+    m_phonemeStatistics.record(phrase, grade >= ReviewScheduler::CorrectWithEffort);
 
-    selectNextPhrase();
+    // store training activity, only the reviewed item is written
+    LearnerProfile::Learner *learner = m_profileManager->activeProfile();
+    LearnerProfile::LearningGoal *goal = languageGoal(course);
+    if (!learner || !goal) {
+        return;
+    }
+    m_profileManager->recordReviewState(learner, goal, course->id(), phrase->id(), state);
+    m_profileManager->recordProgress(learner, goal, course->id(), phrase->id(), logPayload, state.repetitions);
+}
+
+void TrainingSession::updateTriesStatistics(const IPhrase *phrase, bool accepted)
+{
+    if (!accepted) {
+        ++m_failedTries[phrase];
+    } else {
+        const int tries = m_failedTries.take(phrase) + 1;
+        // phrases are counted once, a phrase accepted again moves to its new bucket
+        const int previousTries = m_acceptedTries.value(phrase, 0);
+        if (previousTries > 0 && changeTriesCount(phrase->type(), previousTries, -1)) {
+            emit triesStatisticsChanged(phrase->type(), previousTries);
+        }
+        m_acceptedTries.insert(phrase, tries);
+        if (changeTriesCount(phrase->type(), tries, 1)) {
+            emit triesStatisticsChanged(phrase->type(), tries);
+        }
+    }
+    storeSessionItem(phrase);
+}
+
+bool TrainingSession::changeTriesCount(IPhrase::Type type, int tries, int delta)
+{
+    const int index = static_cast<int>(type);
+    if (index < 0 || index >= m_triesHistogram.count() || tries <= 0) {
+        return false;
+    }
+    QVector<int> &histogram = m_triesHistogram[index];
+    if (histogram.count() <= tries) {
+        histogram.resize(tries + 1);
+    }
+    histogram[tries] += delta;
+    m_maximumTries = qMax(m_maximumTries, tries);
+    if (delta > 0) {
+        m_maximumPhrasesPerTry = qMax(m_maximumPhrasesPerTry, histogram.at(tries));
+    } else if (histogram.at(tries) - delta == m_maximumPhrasesPerTry) {
+        // the phrase left a largest bucket
+        updateMaximumPhrasesPerTry();
+    }
+    return true;
+}
+
+void TrainingSession::updateMaximumPhrasesPerTry()
+{
+    m_maximumPhrasesPerTry = 0;
+    for (const auto &histogram : qAsConst(m_triesHistogram)) {
+        for (const int count : histogram) {
+            m_maximumPhrasesPerTry = qMax(m_maximumPhrasesPerTry, count);
+        }
+    }
+}
+
+void TrainingSession::storeSessionItem(const IPhrase *phrase)
+{
+    // snapshots are kept for course sessions only, a source can not be resumed
+    if (m_source || !m_course) {
+        return;
+    }
+    LearnerProfile::SessionSnapshot::Item item;
+    item.failedTries = m_failedTries.value(phrase, 0);
+    item.acceptedTries = m_acceptedTries.value(phrase, 0);
+    m_profileManager->recordSessionItem(m_profileManager->activeProfile(), languageGoal(m_course), m_course->id(), phrase->id(), item);
+}
+
+void TrainingSession::storeSessionPosition()
+{
+    if (m_source || !m_course) {
+        return;
+    }
+    LearnerProfile::Learner *learner = m_profileManager->activeProfile();
+    if (m_completed) {
+        m_profileManager->clearSessionSnapshot(learner, languageGoal(m_course), m_course->id());
+        return;
+    }
+    const IPhrase *phrase = activePhrase();
+    m_profileManager->recordSessionPosition(learner, languageGoal(m_course), m_course->id(), phrase ? phrase->id() : QString());
+}
+
+IPhrase *TrainingSession::restoreSessionSnapshot()
+{
+    const auto snapshot = m_profileManager->sessionSnapshot(m_profileManager->activeProfile(), languageGoal(m_course), m_course->id());
+    if (snapshot.isEmpty()) {
+        return nullptr;
+    }
+    for (auto iter = snapshot.items.constBegin(); iter != snapshot.items.constEnd(); ++iter) {
+        // phrases removed from the course since the snapshot are dropped
+        const IPhrase *phrase = phraseByItem(reviewItem(m_course, iter.key()));
+        if (!phrase) {
+            continue;
+        }
+        if (iter->failedTries > 0) {
+            m_failedTries.insert(phrase, iter->failedTries);
+        }
+        if (iter->acceptedTries > 0) {
+            m_acceptedTries.insert(phrase, iter->acceptedTries);
+            changeTriesCount(phrase->type(), iter->acceptedTries, 1);
+        }
+    }
+    updateMaximumPhrasesPerTry();
+    emit triesStatisticsReset();
+    return phraseByItem(reviewItem(m_course, snapshot.activeItem));
+}
+
+int TrainingSession::numberPhrasesGroupedByTries(IPhrase::Type type, int tries) const
+{
+    const int index = static_cast<int>(type);
+    if (index < 0 || index >= m_triesHistogram.count() || tries < 0) {
+        return 0;
+    }
+    return m_triesHistogram.at(index).value(tries, 0);
+}
+
+int TrainingSession::maximumTries() const
+{
+    return m_maximumTries;
+}
+
+int TrainingSession::maximumPhrasesPerTry() const
+{
+    return m_maximumPhrasesPerTry;
 }
 
 void TrainingSession::selectNextPhrase()
 {
+    if (m_source) {
+        selectNextSourcePhrase();
+        return;
+    }
+    if (m_mode == SpacedRepetitionMode) {
+        selectNextScheduledPhrase();
+        return;
+    }
+    if (m_mode == PhonemeFocusMode) {
+        selectNextFocusPhrase();
+        return;
+    }
     if (auto action = activeAction()) {
         action->setChecked(false);
     }
     // try to find next phrase, otherwise return completed
     // 1. case: last phrase in unit
-    if (m_indexPhrase >= m_actions.at(m_indexUnit)->actions().count() - 1) {
+    if (m_indexPhrase >= m_actions.at(m_indexUnit)->actionsCount() - 1) {
         // close current unit
         emit closeUnit();
         qDebug() << "switching to next unit";
@@ -196,6 +404,7 @@ void TrainingSession::selectNextPhrase()
         } else {
             ++m_indexUnit;
             m_indexPhrase = 0;
+            releaseHiddenActions(m_indexUnit - 1);
             // currently there is no way to automatically enter a submenu, at least inform user about new unit
             m_actions.at(m_indexUnit)->setChecked(true);
         }
@@ -209,6 +418,83 @@ void TrainingSession::selectNextPhrase()
     emit phraseChanged();
 }
 
+void TrainingSession::selectNextScheduledPhrase()
+{
+    const QString id = m_scheduler.next(QDateTime::currentDateTime());
+    IPhrase *phrase = phraseByItem(id);
+    if (!phrase) {
+        emit completed();
+        emit phraseChanged();
+        return;
+    }
+    const IUnit *currentUnit = activeUnit();
+    if (currentUnit && currentUnit != phrase->unit().get()) {
+        emit closeUnit();
+    }
+    setActivePhrase(phrase);
+}
+
+void TrainingSession::selectNextFocusPhrase()
+{
+    if (m_focusPosition + 1 >= m_focusPhrases.count()) {
+        emit completed();
+        emit phraseChanged();
+        return;
+    }
+    ++m_focusPosition;
+    setActivePhrase(m_focusPhrases.at(m_focusPosition));
+}
+
+void TrainingSession::selectNextSourcePhrase()
+{
+    // units of different courses interleave, hence no closeUnit() notifications
+    m_sourceEntry = m_nextSourceEntry;
+    m_nextSourceEntry = m_sourceEntry.isValid() ? m_source->next() : SessionSource::Entry();
+    if (m_sourceEntry.isValid()) {
+        loadSourceProgress(m_sourceEntry.course.get());
+    } else {
+        emit completed();
+    }
+    emit phraseChanged();
+}
+
+void TrainingSession::loadSourceProgress(ICourse *course)
+{
+    LearnerProfile::LearningGoal *goal = languageGoal(course);
+    if (m_phonemeStatistics.goal() != goal) {
+        m_phonemeStatistics.load(m_profileManager->activeProfile(), goal);
+    }
+    // without goal nothing was stored yet, states are loaded once the goal is registered
+    if (!goal || m_sourceCourses.contains(course->id())) {
+        return;
+    }
+    m_sourceCourses.insert(course->id());
+    const auto states = m_profileManager->reviewStates(m_profileManager->activeProfile(), goal, course->id());
+    for (auto iter = states.constBegin(); iter != states.constEnd(); ++iter) {
+        m_scheduler.insert(reviewItem(course, iter.key()), iter.value());
+    }
+}
+
+void TrainingSession::startPhonemeFocus()
+{
+    // number of weakest phonemes and maximal number of phrases per focus session
+    const int phonemeCount {3};
+    const int phraseCount {20};
+
+    // only this mode needs the phonemes of all phrases
+    if (m_phonemeIndex.isEmpty()) {
+        for (const auto &unitAction : qAsConst(m_actions)) {
+            for (int i = 0; i < unitAction->actionsCount(); ++i) {
+                m_phonemeIndex.addPhrase(unitAction->phraseAt(i));
+            }
+        }
+    }
+    m_focusPhonemes = m_phonemeStatistics.weakestPhonemes(m_phonemeIndex.phonemes(), phonemeCount);
+    m_focusPhrases = m_phonemeIndex.collect(m_focusPhonemes, phraseCount);
+    m_focusPosition = -1;
+    selectNextFocusPhrase();
+}
+
 bool TrainingSession::hasPrevious() const
 {
     return m_indexUnit > 0 || m_indexPhrase > 0;
@@ -216,17 +502,99 @@ bool TrainingSession::hasPrevious() const
 
 bool TrainingSession::hasNext() const
 {
+    if (m_source) {
+        return m_nextSourceEntry.isValid();
+    }
+    if (m_mode == SpacedRepetitionMode) {
+        // the active phrase stays due until it is reviewed
+        const IPhrase *phrase = activePhrase();
+        return m_scheduler.hasDueItem(QDateTime::currentDateTime(), phrase ? reviewItem(m_course, phrase->id()) : QString());
+    }
+    if (m_mode == PhonemeFocusMode) {
+        return m_focusPosition + 1 < m_focusPhrases.count();
+    }
     if (m_indexUnit < m_actions.count() - 1) {
         return true;
     }
     if (!m_actions.isEmpty() && m_actions.constLast()) {
-        if (m_indexPhrase < m_actions.constLast()->actions().count() - 1) {
+        if (m_indexPhrase < m_actions.constLast()->actionsCount() - 1) {
             return true;
         }
     }
     return false;
 }
 
+TrainingSession::Mode TrainingSession::mode() const
+{
+    return m_mode;
+}
+
+void TrainingSession::setMode(Mode mode)
+{
+    if (mode == m_mode) {
+        return;
+    }
+    m_mode = mode;
+    if (m_mode == PhonemeFocusMode && m_course) {
+        startPhonemeFocus();
+    }
+    emit modeChanged();
+    if (m_mode == SpacedRepetitionMode && m_course) {
+        selectNextScheduledPhrase();
+    }
+}
+
+QStringList TrainingSession::focusPhonemes() const
+{
+    return m_mode == PhonemeFocusMode ? m_focusPhonemes : QStringList();
+}
+
+QVector<IPhrase *> TrainingSession::upcomingPhrases(int count) const
+{
+    QVector<IPhrase *> phrases;
+    const IPhrase *active = activePhrase();
+    if (m_source) {
+        // only a single phrase of the source is read ahead
+        if (m_nextSourceEntry.isValid() && count > 0) {
+            phrases.append(m_nextSourceEntry.phrase.get());
+        }
+    } else if (m_mode == SpacedRepetitionMode) {
+        // the active phrase stays due until it is reviewed
+        const QStringList ids = m_scheduler.upcoming(QDateTime::currentDateTime(), count + 1);
+        for (const auto &id : ids) {
+            IPhrase *phrase = phraseByItem(id);
+            if (phrase && phrase != active && phrases.count() < count) {
+                phrases.append(phrase);
+            }
+        }
+    } else if (m_mode == PhonemeFocusMode) {
+        for (int i = m_focusPosition + 1; i < m_focusPhrases.count() && phrases.count() < count; ++i) {
+            phrases.append(m_focusPhrases.at(i));
+        }
+    } else if (m_indexUnit >= 0) {
+        int unit = m_indexUnit;
+        int phrase = m_indexPhrase + 1;
+        while (unit < m_actions.count() && phrases.count() < count) {
+            if (phrase < m_actions.at(unit)->actionsCount()) {
+                phrases.append(m_actions.at(unit)->phraseAt(phrase++));
+            } else {
+                ++unit;
+                phrase = 0;
+            }
+        }
+    }
+    return phrases;
+}
+
+void TrainingSession::prefetchUpcomingPhrases()
+{
+    // number of phrases prepared ahead of the active one
+    const int prefetchCount {3};
+
+    // action objects are not created ahead, they carry no icon and are cheap to create on access
+    m_prefetcher->prefetch(upcomingPhrases(prefetchCount));
+}
+
 void TrainingSession::updateGoal()
 {
     if (!m_profileManager) {
@@ -238,11 +606,78 @@ void TrainingSession::updateGoal()
         qCWarning(ARTIKULATE_LOG()) << "No active Learner registered, aborting operation";
         return;
     }
-    LearnerProfile::LearningGoal *goal = m_profileManager->goal(LearnerProfile::LearningGoal::Language, m_course->language()->id());
+    ICourse *course = activeCourse();
+    if (!course || !course->language()) {
+        return;
+    }
+    LearnerProfile::LearningGoal *goal = languageGoal(course);
+    if (!goal) {
+        goal = m_profileManager->registerGoal(LearnerProfile::LearningGoal::Language, course->language()->id(), course->language()->i18nTitle());
+    }
     learner->addGoal(goal);
     learner->setActiveGoal(goal);
 }
 
+ICourse *TrainingSession::activeCourse() const
+{
+    if (m_source) {
+        return m_sourceEntry.course.get();
+    }
+    return m_course;
+}
+
+LearnerProfile::LearningGoal *TrainingSession::languageGoal(ICourse *course) const
+{
+    if (!course || !course->language()) {
+        return nullptr;
+    }
+    return m_profileManager->goal(LearnerProfile::LearningGoal::Language, course->language()->id());
+}
+
+IPhrase *TrainingSession::phraseByItem(const QString &item) const
+{
+    // only spaced repetition and resumed sessions look up phrases by identifier
+    if (m_phrasesById.isEmpty() && m_course) {
+        for (const auto &unitAction : qAsConst(m_actions)) {
+            for (int i = 0; i < unitAction->actionsCount(); ++i) {
+                IPhrase *phrase = unitAction->phraseAt(i);
+                m_phrasesById.insert(reviewItem(m_course, phrase->id()), phrase);
+            }
+        }
+    }
+    return m_phrasesById.value(item);
+}
+
+QString TrainingSession::reviewItem(const ICourse *course, const QString &phraseId)
+{
+    return course->id() + QLatin1Char('\n') + phraseId;
+}
+
+void TrainingSession::loadLearnerProgress()
+{
+    m_scheduler.clear();
+    m_phonemeStatistics.clear();
+    m_sourceCourses.clear();
+    if (m_source) {
+        // progress of further source courses is loaded when their phrases are drawn
+        if (ICourse *course = activeCourse()) {
+            loadSourceProgress(course);
+        }
+        return;
+    }
+    if (!m_course) {
+        return;
+    }
+    m_phonemeStatistics.load(m_profileManager->activeProfile(), languageGoal(m_course));
+    const auto states = m_profileManager->reviewStates(m_profileManager->activeProfile(), languageGoal(m_course), m_course->id());
+    for (const auto &unitAction : qAsConst(m_actions)) {
+        for (int i = 0; i < unitAction->actionsCount(); ++i) {
+            const QString id = unitAction->phraseAt(i)->id();
+            m_scheduler.insert(reviewItem(m_course, id), states.value(id));
+        }
+    }
+}
+
 QVector<TrainingAction *> TrainingSession::trainingActions() const
 {
     return m_actions;
@@ -251,28 +686,48 @@ QVector<TrainingAction *> TrainingSession::trainingActions() const
 void TrainingSession::updateTrainingActions()
 {
     for (const auto &action : qAsConst(m_actions)) {
+        action->clearActions();
         action->deleteLater();
     }
     m_actions.clear();
+    m_phrasesById.clear();
+    m_unitIndex.clear();
+    m_phonemeIndex.clear();
+    m_focusPhrases.clear();
+    m_focusPosition = -1;
+    m_failedTries.clear();
+    m_acceptedTries.clear();
+    m_triesHistogram = QVector<QVector<int>>(static_cast<int>(IPhrase::Type::AllTypes));
+    m_maximumTries = 0;
+    m_maximumPhrasesPerTry = 0;
+    emit triesStatisticsReset();
 
+    m_openUnit = -1;
     if (!m_course) {
+        m_scheduler.clear();
         m_indexUnit = -1;
         m_indexPhrase = -1;
         return;
     }
 
-    const auto unitList = m_course->units();
-    for (const auto &unit : qAsConst(unitList)) {
-        auto action = new TrainingAction(unit->title(), this);
-        const auto phraseList = unit->phrases();
-        for (const auto &phrase : qAsConst(phraseList)) {
+    // rows only hold the phrase, they give the row counts and the linear order of the session without
+    // creating action objects; lookup tables by identifier and phoneme are built by the modes needing them
+    for (const auto &unit : m_course->unitRange()) {
+        auto action = new TrainingAction(unit->title(), m_actionPool, this);
+        for (const auto &phrase : unit->phraseRange()) {
             if (phrase->sound().isEmpty()) {
                 continue;
             }
-            action->appendAction(new TrainingAction(phrase, this, unit.get()));
+            action->appendPhrase(phrase);
         }
-        if (action->actions().count() > 0) {
+        if (action->actionsCount() > 0) {
+            const int unitIndex = m_actions.count();
+            m_unitIndex.insert(unit.get(), unitIndex);
             m_actions.append(action);
+            // the drawer triggers unit actions when it opens their phrase list
+            connect(action, &TrainingAction::triggered, this, [this, unitIndex]() {
+                setOpenUnit(unitIndex);
+            });
         } else {
             action->deleteLater();
         }
@@ -281,10 +736,12 @@ void TrainingSession::updateTrainingActions()
     // update indices
     m_indexUnit = -1;
     m_indexPhrase = -1;
-    if (m_course->units().count() > 0) {
+    const auto units = m_course->unitRange();
+    if (!units.isEmpty()) {
         m_indexUnit = 0;
-        if (m_course->units().constFirst()->phrases().count() > 0) {
+        if (units.first()->phraseCount() > 0) {
             m_indexPhrase = 0;
         }
     }
+    loadLearnerProgress();
 }
@@ -9,16 +9,26 @@
 
 #include "artikulatecore_export.h"
 #include "isessionactions.h"
+#include "phonemeindex.h"
+#include "phonemestatistics.h"
 #include "phrase.h"
+#include "reviewscheduler.h"
+#include "sessionsource.h"
+#include <QHash>
+#include <QSet>
 #include <QVector>
+#include <memory>
 
 class Language;
 class ICourse;
 class Unit;
 class TrainingAction;
+class TrainingActionPool;
+class PhrasePrefetcher;
 
 namespace LearnerProfile
 {
+class LearningGoal;
 class ProfileManager;
 }
 
@@ -33,12 +43,34 @@ class ARTIKULATECORE_EXPORT TrainingSession : public ISessionActions
     Q_PROPERTY(IUnit *unit READ activeUnit WRITE setUnit NOTIFY phraseChanged)
     Q_PROPERTY(IPhrase *phrase READ activePhrase WRITE setActivePhrase NOTIFY phraseChanged)
     Q_PROPERTY(bool hasNext READ hasNext NOTIFY phraseChanged)
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY modeChanged)
+    /**
+     * @brief identifiers of the phonemes trained in PhonemeFocusMode
+     */
+    Q_PROPERTY(QStringList focusPhonemes READ focusPhonemes NOTIFY modeChanged)
 
 public:
+    /**
+     * @brief Order in which phrases are presented
+     *
+     * - LinearMode walks through all phrases in course order
+     * - SpacedRepetitionMode presents due phrases as scheduled by the learner's review history
+     * - PhonemeFocusMode presents phrases that exercise the learner's weakest phonemes
+     */
+    enum Mode { LinearMode, SpacedRepetitionMode, PhonemeFocusMode };
+    Q_ENUM(Mode)
+
     explicit TrainingSession(LearnerProfile::ProfileManager *manager, QObject *parent = nullptr);
 
     ICourse *course() const;
     void setCourse(ICourse *course);
+    /**
+     * @brief Train the phrases provided by @p source instead of a single course
+     *
+     * The session takes ownership of the source. Setting a course ends training from the source.
+     */
+    void setSource(std::unique_ptr<SessionSource> source);
+    SessionSource *source() const;
     IUnit *activeUnit() const;
     void setUnit(IUnit *unit);
     TrainingAction *activeAction() const override;
@@ -46,6 +78,21 @@ public:
     void setActivePhrase(IPhrase *phrase) override;
     bool hasPrevious() const;
     bool hasNext() const;
+    Mode mode() const;
+    void setMode(Mode mode);
+    QStringList focusPhonemes() const;
+    /**
+     * @return number of phrases of type @p type that were accepted at the @p tries-th attempt
+     */
+    int numberPhrasesGroupedByTries(IPhrase::Type type, int tries) const;
+    /**
+     * @return largest number of attempts needed for any accepted phrase in this session
+     */
+    int maximumTries() const;
+    /**
+     * @return largest current value of numberPhrasesGroupedByTries() over all types and tries
+     */
+    int maximumPhrasesPerTry() const;
     Q_INVOKABLE void accept();
     Q_INVOKABLE void skip();
     /**
@@ -65,18 +112,99 @@ Q_SIGNALS:
      */
     void completed();
     void closeUnit();
+    void modeChanged();
+    /**
+     * @brief Emitted when the number of phrases of type @p type accepted at the @p tries-th attempt changed
+     */
+    void triesStatisticsChanged(IPhrase::Type type, int tries);
+    /**
+     * @brief Emitted when the tries statistics are cleared, e.g. on course changes
+     */
+    void triesStatisticsReset();
 
 private:
     Q_DISABLE_COPY(TrainingSession)
     void updateTrainingActions();
+    void selectAction(int unitIndex, int phraseIndex);
+    /**
+     * @brief set unit action @p unitIndex as the unit opened in the drawer, -1 if none is opened
+     */
+    void setOpenUnit(int unitIndex);
+    /**
+     * @brief return the phrase actions of unit action @p unitIndex to the pool unless the unit is active or opened
+     */
+    void releaseHiddenActions(int unitIndex);
+    /**
+     * @return phrase of scheduler item @p item, the lookup table is built on first use
+     */
+    IPhrase *phraseByItem(const QString &item) const;
     void selectNextPhrase();
+    void selectNextScheduledPhrase();
+    void selectNextFocusPhrase();
+    void selectNextSourcePhrase();
+    /**
+     * @brief load review states and phoneme statistics of a source course when its phrases are drawn
+     */
+    void loadSourceProgress(ICourse *course);
+    void startPhonemeFocus();
+    void reviewActivePhrase(ReviewScheduler::Grade grade, int logPayload);
+    void updateTriesStatistics(const IPhrase *phrase, bool accepted);
+    /**
+     * @return true if the histogram bucket of @p type and @p tries could be changed by @p delta
+     */
+    bool changeTriesCount(IPhrase::Type type, int tries, int delta);
+    void updateMaximumPhrasesPerTry();
+    void storeSessionItem(const IPhrase *phrase);
+    void storeSessionPosition();
+    /**
+     * @brief restore attempt counters of the learner's last session over the current course
+     * @return phrase that was active when the session was left, or nullptr
+     */
+    IPhrase *restoreSessionSnapshot();
+    void loadLearnerProgress();
+    /**
+     * @return up to @p count phrases following the active phrase in the order of the current mode
+     */
+    QVector<IPhrase *> upcomingPhrases(int count) const;
+    void prefetchUpcomingPhrases();
     void updateGoal();
+    /**
+     * @return course of the active phrase
+     */
+    ICourse *activeCourse() const;
+    LearnerProfile::LearningGoal *languageGoal(ICourse *course) const;
+    /**
+     * @return scheduler item of phrase @p phraseId, phrase identifiers are only unique within their course
+     */
+    static QString reviewItem(const ICourse *course, const QString &phraseId);
     LearnerProfile::ProfileManager *m_profileManager;
     ICourse *m_course;
+    TrainingActionPool *m_actionPool;
+    PhrasePrefetcher *m_prefetcher;
     QVector<TrainingAction *> m_actions;
+    Mode m_mode {LinearMode};
+    ReviewScheduler m_scheduler;
+    mutable QHash<QString, IPhrase *> m_phrasesById; //!< keyed by reviewItem(), built by phraseByItem()
+    QHash<const IUnit *, int> m_unitIndex;           //!< unit to unit action index
+    PhonemeIndex m_phonemeIndex;                     //!< built when phoneme focus mode starts
+    PhonemeStatistics m_phonemeStatistics;
+    QStringList m_focusPhonemes;
+    QVector<IPhrase *> m_focusPhrases;
+    int m_focusPosition {-1};
+    std::unique_ptr<SessionSource> m_source;
+    SessionSource::Entry m_sourceEntry;
+    SessionSource::Entry m_nextSourceEntry; //!< lookahead for hasNext()
+    QSet<QString> m_sourceCourses;          //!< courses whose review states are loaded
+    QHash<const IPhrase *, int> m_failedTries;  //!< skips since the phrase was last accepted
+    QHash<const IPhrase *, int> m_acceptedTries; //!< tries needed when the phrase was last accepted
+    QVector<QVector<int>> m_triesHistogram;     //!< per phrase type, number of phrases by tries
+    int m_maximumTries {0};
+    int m_maximumPhrasesPerTry {0};
+    bool m_completed {false}; //!< set when the last step completed the session
 
     int m_indexUnit {-1};
     int m_indexPhrase {-1};
+    int m_openUnit {-1}; //!< unit action opened in the drawer
 };
 
 #endif
@@ -10,6 +10,7 @@
 
 #include <QMap>
 #include <QQmlEngine>
+#include <QThread>
 #include <QUuid>
 
 #include "artikulate_debug.h"
@@ -39,6 +40,11 @@ std::shared_ptr<Unit> Unit::create()
             unit->emitPhrasesChanged(unit);
         }
     });
+    connect(unit.get(), &IUnit::phrasesReset, unit.get(), [unitParameter]() {
+        if (auto unit = unitParameter.lock()) {
+            unit->emitPhrasesChanged(unit);
+        }
+    });
     return unit;
 }
 
@@ -59,6 +65,7 @@ QString Unit::id() const
 
 void Unit::setId(const QString &id)
 {
+    ensureLoaded();
     if (id != m_id) {
         m_id = id;
         emit idChanged();
@@ -73,6 +80,7 @@ QString Unit::foreignId() const
 
 void Unit::setForeignId(const QString &id)
 {
+    ensureLoaded();
     m_foreignId = id;
 }
 
@@ -97,6 +105,7 @@ QString Unit::title() const
 
 void Unit::setTitle(const QString &title)
 {
+    ensureLoaded();
     if (QString::compare(title, m_title) != 0) {
         m_title = title;
         emit titleChanged();
@@ -123,38 +132,185 @@ QVector<std::shared_ptr<IPhrase>> Unit::phrases() const
     return m_phrases;
 }
 
-void Unit::addPhrase(std::shared_ptr<IEditablePhrase> phrase, int index)
+ConstRange<std::shared_ptr<IPhrase>> Unit::phraseRange() const
+{
+    return ConstRange<std::shared_ptr<IPhrase>>(m_phrases.constData(), m_phrases.constData() + m_phrases.count());
+}
+
+int Unit::phraseCount() const
+{
+    return m_phrases.count();
+}
+
+int Unit::indexOf(const IPhrase *phrase) const
+{
+    updatePositions();
+    return m_positions.value(phrase, -1);
+}
+
+std::shared_ptr<IPhrase> Unit::findPhrase(const QString &id) const
+{
+    if (!m_idsValid) {
+        m_ids.clear();
+        m_ids.reserve(m_phrases.count());
+        for (const auto &phrase : m_phrases) {
+            m_ids.insert(phrase->id(), phrase.get());
+        }
+        m_idsValid = true;
+    }
+    const IPhrase *phrase = m_ids.value(id);
+    if (!phrase) {
+        return nullptr;
+    }
+    return m_phrases.at(indexOf(phrase));
+}
+
+void Unit::updatePositions() const
+{
+    for (int i = m_validPositions; i < m_phrases.count(); ++i) {
+        m_positions.insert(m_phrases.at(i).get(), i);
+    }
+    m_validPositions = m_phrases.count();
+}
+
+void Unit::invalidateIds()
+{
+    m_idsValid = false;
+}
+
+void Unit::setSource(const QByteArray &document, int begin, int end, std::function<QVector<std::shared_ptr<Phrase>>(const QByteArray &element)> loader)
+{
+    Q_ASSERT(m_phrases.isEmpty());
+    Q_ASSERT(begin >= 0 && begin <= end && end <= document.size());
+    m_sourceDocument = document;
+    m_sourceBegin = begin;
+    m_sourceEnd = end;
+    m_loader = std::move(loader);
+}
+
+bool Unit::isLoaded() const
+{
+    return !m_loader;
+}
+
+QByteArray Unit::source() const
+{
+    if (isLoaded()) {
+        return QByteArray();
+    }
+    return m_sourceDocument.mid(m_sourceBegin, m_sourceEnd - m_sourceBegin);
+}
+
+void Unit::ensureLoaded()
 {
-    auto iter = m_phrases.constBegin();
-    while (iter != m_phrases.constEnd()) {
-        if (phrase->id() == (*iter)->id()) {
-            qCWarning(ARTIKULATE_LOG()) << "Phrase is already contained in this unit, aborting";
-            return;
+    if (!isLoaded()) {
+        load();
+    }
+}
+
+void Unit::load()
+{
+    Q_ASSERT(QThread::currentThread() == thread());
+    const auto phrases = m_loader(source());
+    m_loader = nullptr;
+    m_sourceDocument.clear();
+
+    for (const auto &phrase : phrases) {
+        if (findPhrase(phrase->id())) {
+            qCWarning(ARTIKULATE_LOG()) << "Phrase is already contained in this unit, skipping" << phrase->id();
+            continue;
         }
-        ++iter;
+        phrase->setUnit(m_self.lock());
+        m_phrases.append(phrase);
+        if (m_idsValid) {
+            m_ids.insert(phrase->id(), phrase.get());
+        }
+        connect(phrase.get(), &Phrase::modified, this, &Unit::modified);
+        connect(phrase.get(), &IPhrase::idChanged, this, &Unit::invalidateIds);
+    }
+    emit loaded();
+}
+
+void Unit::addPhrase(std::shared_ptr<IEditablePhrase> phrase, int index)
+{
+    ensureLoaded();
+    if (findPhrase(phrase->id())) {
+        qCWarning(ARTIKULATE_LOG()) << "Phrase is already contained in this unit, aborting";
+        return;
     }
     phrase->setUnit(m_self.lock());
-    emit phraseAboutToBeAdded(phrase, index);
+    const bool batched = m_updateDepth > 0;
+    if (batched) {
+        prepareReset();
+    } else {
+        emit phraseAboutToBeAdded(phrase, index);
+    }
     m_phrases.insert(index, phrase);
-    emit phraseAdded(phrase);
+    // positions behind the new phrase are shifted and only recomputed on the next lookup
+    m_validPositions = qMin(m_validPositions, index);
+    if (m_idsValid) {
+        m_ids.insert(phrase->id(), phrase.get());
+    }
+    if (!batched) {
+        emit phraseAdded(phrase);
+    }
 
     connect(phrase.get(), &Phrase::modified, this, &Unit::modified);
-    emit modified();
+    connect(phrase.get(), &IPhrase::idChanged, this, &Unit::invalidateIds);
+    if (!batched) {
+        emit modified();
+    }
 }
 
 void Unit::removePhrase(std::shared_ptr<IPhrase> phrase)
 {
-    int index = -1;
-    for (int i = 0; i < m_phrases.count(); ++i) {
-        if (m_phrases.at(i)->id() == phrase->id()) {
-            index = i;
-            break;
-        }
-    }
+    ensureLoaded();
+    const auto containedPhrase = findPhrase(phrase->id());
+    const int index = containedPhrase ? indexOf(containedPhrase.get()) : -1;
     Q_ASSERT(index >= 0);
-    emit phraseAboutToBeRemoved(index);
+    if (index < 0) {
+        return;
+    }
+    const bool batched = m_updateDepth > 0;
+    if (batched) {
+        prepareReset();
+    } else {
+        emit phraseAboutToBeRemoved(index);
+    }
     m_phrases.removeAt(index);
-    emit phraseRemoved();
+    m_positions.remove(containedPhrase.get());
+    m_ids.remove(containedPhrase->id());
+    m_validPositions = qMin(m_validPositions, index);
+    disconnect(containedPhrase.get(), nullptr, this, nullptr);
+    if (!batched) {
+        emit phraseRemoved();
+    }
+}
+
+void Unit::beginUpdate()
+{
+    ++m_updateDepth;
+}
+
+void Unit::endUpdate()
+{
+    Q_ASSERT(m_updateDepth > 0);
+    if (m_updateDepth <= 0 || --m_updateDepth > 0) {
+        return;
+    }
+    if (m_resetPending) {
+        m_resetPending = false;
+        emit phrasesReset();
+        emit modified();
+    }
+}
+
+void Unit::prepareReset()
+{
+    if (!m_resetPending) {
+        m_resetPending = true;
+        emit phrasesAboutToBeReset();
+    }
 }
 
 void Unit::emitPhrasesChanged(std::shared_ptr<IEditableUnit> unit)
@@ -9,9 +9,12 @@
 
 #include "artikulatecore_export.h"
 #include "ieditableunit.h"
+#include <QByteArray>
+#include <QHash>
 #include <QObject>
 #include <QStringList>
 #include <QVector>
+#include <functional>
 #include <memory>
 
 class QString;
@@ -40,16 +43,67 @@ public:
     QString i18nTitle() const override;
     void setI18nTitle(const QString &title) override;
     QVector<std::shared_ptr<IPhrase>> phrases() const override;
+    ConstRange<std::shared_ptr<IPhrase>> phraseRange() const override;
+    int phraseCount() const override;
+    int indexOf(const IPhrase *phrase) const override;
+    std::shared_ptr<IPhrase> findPhrase(const QString &id) const override;
     void addPhrase(std::shared_ptr<IEditablePhrase> phrase, int index) override;
     void removePhrase(std::shared_ptr<IPhrase> phrase) override;
+    void beginUpdate() override;
+    void endUpdate() override;
     std::shared_ptr<IUnit> self() const override;
     void emitPhrasesChanged(std::shared_ptr<IEditableUnit> unit);
+    /**
+     * @brief defer creation of the phrases until ensureLoaded() is called or the unit is modified
+     *
+     * Until then the unit reports no phrases. Loading emits loaded() but no phrase signals.
+     *
+     * @param document serialized course that contains the unit element, shared between its units
+     * @param begin byte offset of the unit element in @p document
+     * @param end byte offset behind the unit element
+     * @param loader parses the phrases of the given unit element
+     */
+    void setSource(const QByteArray &document, int begin, int end, std::function<QVector<std::shared_ptr<Phrase>>(const QByteArray &element)> loader);
+    /**
+     * @return true if the phrases of the unit exist, i.e. no deferred source is pending
+     */
+    bool isLoaded() const;
+    /**
+     * @brief create the phrases from the deferred source, if any
+     *
+     * Must be called from the thread of the unit, i.e. the GUI thread, before the phrases of an opened unit are read.
+     */
+    void ensureLoaded();
+    /**
+     * @return the unmodified unit element as long as the unit is not loaded, otherwise an empty array
+     */
+    QByteArray source() const;
+
+Q_SIGNALS:
+    /**
+     * @brief emitted after the phrases of the unit were created from its deferred source
+     */
+    void loaded();
 
 protected:
     explicit Unit(QObject *parent = nullptr);
 
 private:
     void setSelf(std::shared_ptr<IUnit> self) override;
+    /**
+     * @brief update positions of all phrases behind the last valid index position
+     *
+     * After adding or removing a phrase at index i, the next lookup recomputes the positions from i on.
+     * This is linear in the number of shifted phrases, as is the shift of the phrase vector itself, hence
+     * changes at the front of a unit are linear in the unit size and only appending is constant.
+     */
+    void updatePositions() const;
+    void invalidateIds();
+    void load();
+    /**
+     * @brief announce the reset of the current batch before its first phrase change
+     */
+    void prepareReset();
     Q_DISABLE_COPY(Unit)
     std::weak_ptr<IUnit> m_self;
     QString m_id;
@@ -58,6 +112,16 @@ private:
     QString m_title;
     QString m_i18nTitle;
     QVector<std::shared_ptr<IPhrase>> m_phrases;
+    mutable QHash<const IPhrase *, int> m_positions; //!< valid for positions below m_validPositions, see updatePositions()
+    mutable int m_validPositions {0};
+    mutable QHash<QString, IPhrase *> m_ids; //!< rebuilt on demand after phrase id changes
+    mutable bool m_idsValid {true};
+    int m_updateDepth {0};
+    bool m_resetPending {false};
+    std::function<QVector<std::shared_ptr<Phrase>>(const QByteArray &element)> m_loader; //!< set until the phrases are loaded
+    QByteArray m_sourceDocument;
+    int m_sourceBegin {0};
+    int m_sourceEnd {0};
 };
 
 #endif // UNIT_H
@@ -5,6 +5,8 @@
 */
 
 #include "coursefiltermodel.h"
+#include "../core/icourse.h"
+#include "../core/iresourcerepository.h"
 #include "../core/language.h"
 #include "artikulate_debug.h"
 #include "models/coursemodel.h"
@@ -33,6 +35,8 @@ void CourseFilterModel::setLanguage(Language *language)
         return;
     }
     m_language = language;
+    m_languageId = m_language ? m_language->id() : QString();
+    m_languageCoursesValid = false;
     emit languageChanged();
     invalidateFilter();
     emit filteredCountChanged();
@@ -44,6 +48,22 @@ void CourseFilterModel::setCourseModel(CourseModel *courseModel)
         return;
     }
     m_courseModel = courseModel;
+    m_languageCoursesValid = false;
+
+    // connected before setting the source model, so that the course set is dropped before the proxy filters new rows
+    for (const auto &connection : qAsConst(m_sourceConnections)) {
+        disconnect(connection);
+    }
+    m_sourceConnections.clear();
+    if (m_courseModel) {
+        auto invalidateCourses = [this]() {
+            m_languageCoursesValid = false;
+        };
+        m_sourceConnections.append(connect(m_courseModel, &QAbstractItemModel::rowsInserted, this, invalidateCourses));
+        m_sourceConnections.append(connect(m_courseModel, &QAbstractItemModel::rowsRemoved, this, invalidateCourses));
+        m_sourceConnections.append(connect(m_courseModel, &QAbstractItemModel::modelReset, this, invalidateCourses));
+        m_sourceConnections.append(connect(m_courseModel, &QAbstractItemModel::layoutChanged, this, invalidateCourses));
+    }
 
     setSourceModel(m_courseModel);
     sort(0);
@@ -63,17 +83,33 @@ bool CourseFilterModel::lessThan(const QModelIndex &left, const QModelIndex &rig
 
 bool CourseFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
 {
-    QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
-
     if (m_language == nullptr) {
         return true;
-    } else if (sourceModel()->data(index, CourseModel::LanguageRole).value<Language *>()->id() == m_language->id()) {
-        return true;
     }
-    return false;
+    if (!m_courseModel || sourceModel() != m_courseModel) {
+        const QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+        auto language = sourceModel()->data(index, CourseModel::LanguageRole).value<Language *>();
+        return language && language->id() == m_languageId;
+    }
+    const auto course = m_courseModel->courseAt(sourceRow);
+    return course && languageCourses().contains(course.get());
+}
+
+const QSet<const ICourse *> &CourseFilterModel::languageCourses() const
+{
+    if (!m_languageCoursesValid) {
+        m_languageCourses.clear();
+        if (m_courseModel && m_courseModel->resourceRepository()) {
+            for (const auto &course : m_courseModel->resourceRepository()->courseRange(m_languageId)) {
+                m_languageCourses.insert(course.get());
+            }
+        }
+        m_languageCoursesValid = true;
+    }
+    return m_languageCourses;
 }
 
 QVariant CourseFilterModel::course(int row) const
 {
-    return m_courseModel->data(m_courseModel->index(row, 0), CourseModel::DataRole);
+    return data(index(row, 0), CourseModel::DataRole);
 }
@@ -7,13 +7,17 @@
 #ifndef COURSEFILTERMODEL_H
 #define COURSEFILTERMODEL_H
 
+#include "artikulatecore_export.h"
+#include <QSet>
 #include <QSortFilterProxyModel>
+#include <QVector>
 
 class Course;
 class CourseModel;
+class ICourse;
 class Language;
 
-class CourseFilterModel : public QSortFilterProxyModel
+class ARTIKULATECORE_EXPORT CourseFilterModel : public QSortFilterProxyModel
 {
     Q_OBJECT
     Q_PROPERTY(CourseModel *courseModel READ courseModel WRITE setCourseModel NOTIFY courseModelChanged)
@@ -37,8 +41,17 @@ Q_SIGNALS:
     void languageChanged();
 
 private:
+    /**
+     * @return courses of the filtered language as provided by the repository of the course model
+     */
+    const QSet<const ICourse *> &languageCourses() const;
+
     CourseModel *m_courseModel {nullptr};
     Language *m_language {nullptr};
+    QString m_languageId; //!< id of m_language, looked up once instead of for every filtered row
+    mutable QSet<const ICourse *> m_languageCourses;
+    mutable bool m_languageCoursesValid {false};
+    QVector<QMetaObject::Connection> m_sourceConnections;
 };
 
 #endif
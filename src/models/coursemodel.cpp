@@ -11,6 +11,7 @@
 #include "core/ilanguage.h"
 #include "core/iresourcerepository.h"
 #include <KLocalizedString>
+#include <algorithm>
 
 CourseModel::CourseModel(QObject *parent)
     : CourseModel(artikulateApp->resourceRepository(), parent)
@@ -59,23 +60,20 @@ void CourseModel::setResourceRepository(IResourceRepository *resourceRepository)
         disconnect(m_resourceRepository, &IResourceRepository::courseAboutToBeAdded, this, &CourseModel::onCourseAboutToBeAdded);
         disconnect(m_resourceRepository, &IResourceRepository::courseAdded, this, &CourseModel::onCourseAdded);
         disconnect(m_resourceRepository, &IResourceRepository::courseAboutToBeRemoved, this, &CourseModel::onCourseAboutToBeRemoved);
+        disconnect(m_resourceRepository, &IResourceRepository::courseRemoved, this, &CourseModel::onCourseRemoved);
     }
     m_resourceRepository = resourceRepository;
     if (m_resourceRepository) {
         connect(m_resourceRepository, &IResourceRepository::courseAboutToBeAdded, this, &CourseModel::onCourseAboutToBeAdded);
         connect(m_resourceRepository, &IResourceRepository::courseAdded, this, &CourseModel::onCourseAdded);
         connect(m_resourceRepository, &IResourceRepository::courseAboutToBeRemoved, this, &CourseModel::onCourseAboutToBeRemoved);
+        connect(m_resourceRepository, &IResourceRepository::courseRemoved, this, &CourseModel::onCourseRemoved);
     }
     if (m_resourceRepository) {
-        auto courses = m_resourceRepository->courses();
+        const auto courses = m_resourceRepository->courseRange();
         for (int i = 0; i < courses.count(); ++i) {
-            auto course = courses.at(i);
             // TODO only title changed is connected, change this to a general changed signal
-            auto connection = connect(course.get(), &ICourse::titleChanged, this, [=]() {
-                const auto row = m_resourceRepository->courses().indexOf(course);
-                emit dataChanged(index(row, 0), index(row, 0));
-            });
-            m_updateConnections.insert(i, connection);
+            m_updateConnections.insert(i, connectCourse(courses.at(i).get()));
         }
     }
     endResetModel();
@@ -95,7 +93,7 @@ QVariant CourseModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    auto const course = m_resourceRepository->courses().at(index.row());
+    const auto &course = m_resourceRepository->courseRange().at(index.row());
 
     switch (role) {
         case Qt::DisplayRole:
@@ -124,17 +122,28 @@ int CourseModel::rowCount(const QModelIndex &) const
     if (!m_resourceRepository) {
         return 0;
     }
-    return m_resourceRepository->courses().count();
+    return m_resourceRepository->courseCount();
 }
 
-void CourseModel::onCourseAboutToBeAdded(std::shared_ptr<ICourse> course, int row)
+QMetaObject::Connection CourseModel::connectCourse(ICourse *course)
 {
-    beginInsertRows(QModelIndex(), row, row);
-    auto connection = connect(course.get(), &ICourse::titleChanged, this, [=]() {
-        const auto row = m_resourceRepository->courses().indexOf(course);
+    return connect(course, &ICourse::titleChanged, this, [=]() {
+        const auto courses = m_resourceRepository->courseRange();
+        const auto iter = std::find_if(courses.begin(), courses.end(), [course](const std::shared_ptr<ICourse> &candidate) {
+            return candidate.get() == course;
+        });
+        if (iter == courses.end()) {
+            return;
+        }
+        const int row = static_cast<int>(iter - courses.begin());
         emit dataChanged(index(row, 0), index(row, 0));
     });
-    m_updateConnections.insert(row, connection);
+}
+
+void CourseModel::onCourseAboutToBeAdded(std::shared_ptr<ICourse> course, int row)
+{
+    beginInsertRows(QModelIndex(), row, row);
+    m_updateConnections.insert(row, connectCourse(course.get()));
 }
 
 void CourseModel::onCourseAdded()
@@ -147,6 +156,10 @@ void CourseModel::onCourseAboutToBeRemoved(int row)
     beginRemoveRows(QModelIndex(), row, row);
     QObject::disconnect(m_updateConnections.at(row));
     m_updateConnections.removeAt(row);
+}
+
+void CourseModel::onCourseRemoved()
+{
     endRemoveRows();
 }
 
@@ -165,3 +178,11 @@ QVariant CourseModel::course(int row) const
 {
     return data(index(row, 0), CourseModel::DataRole);
 }
+
+std::shared_ptr<ICourse> CourseModel::courseAt(int row) const
+{
+    if (row < 0 || row >= rowCount()) {
+        return nullptr;
+    }
+    return m_resourceRepository->course(row);
+}
@@ -31,6 +31,10 @@ public:
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
     Q_INVOKABLE QVariant course(int index) const;
+    /**
+     * @return course at @p row or nullptr if the row does not exist
+     */
+    std::shared_ptr<ICourse> courseAt(int row) const;
 
 protected:
     void setResourceRepository(IResourceRepository *resourceRepository);
@@ -39,8 +43,11 @@ private Q_SLOTS:
     void onCourseAboutToBeAdded(std::shared_ptr<ICourse> course, int index);
     void onCourseAdded();
     void onCourseAboutToBeRemoved(int row);
+    void onCourseRemoved();
 
 private:
+    QMetaObject::Connection connectCourse(ICourse *course);
+
     IResourceRepository *m_resourceRepository {nullptr};
     QVector<QMetaObject::Connection> m_updateConnections;
 };
@@ -116,7 +116,7 @@ void LanguageResourceModel::onLanguageAboutToBeRemoved(int index)
         return;
     }
 
-    ILanguage *originalLanguage = m_repository->languages().at(index).get();
+    ILanguage *originalLanguage = m_repository->languageRange().at(index).get();
     int modelIndex = m_languages.indexOf(originalLanguage);
 
     if (modelIndex == -1) {
@@ -165,7 +165,7 @@ void LanguageResourceModel::updateDisplayedLanguages()
     m_languages.clear();
     if (m_repository) {
         m_languages.clear();
-        for (auto language : m_repository->languages()) {
+        for (const auto &language : m_repository->languageRange()) {
             m_languages.append(language.get());
         }
     }
@@ -12,6 +12,7 @@
 LearningProgressModel::LearningProgressModel(QObject *parent)
     : QAbstractTableModel(parent)
     , m_session(nullptr)
+    , m_maximumTries(0)
 {
 }
 
@@ -27,11 +28,11 @@ QHash<int, QByteArray> LearningProgressModel::roleNames() const
 int LearningProgressModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent)
-    if (m_session == 0) {
+    if (m_session == nullptr) {
         return 0;
     }
     // row for every try, plus extra column for 0st and (max + 1)st try
-    return m_session->maximumTries() + 2;
+    return m_maximumTries + 2;
 }
 
 int LearningProgressModel::columnCount(const QModelIndex &parent) const
@@ -56,8 +57,12 @@ void LearningProgressModel::setSession(TrainingSession *session)
         m_session->disconnect(this);
     }
     m_session = session;
-    connect(session, SIGNAL(finished()), this, SLOT(updateResults()));
-    connect(session, SIGNAL(finished()), this, SIGNAL(maximumTriesChanged()));
+    m_maximumTries = 0;
+    if (m_session) {
+        m_maximumTries = m_session->maximumTries();
+        connect(m_session, &TrainingSession::triesStatisticsChanged, this, &LearningProgressModel::updateCell);
+        connect(m_session, &TrainingSession::triesStatisticsReset, this, &LearningProgressModel::updateResults);
+    }
     endResetModel();
     emit sessionChanged();
 }
@@ -97,24 +102,15 @@ QVariant LearningProgressModel::data(const QModelIndex &index, int role) const
     }
 
     // handle special rows
-    if (index.row() == 0 || index.row() == m_session->maximumTries() + 1) {
+    if (index.row() == 0 || index.row() == m_maximumTries + 1) {
         return QVariant(0);
     }
 
-    // normal tries
-    int tries = index.row();
-    switch (index.column()) {
-        case Phrase::Word:
-            return QVariant(m_session->numberPhrasesGroupedByTries(TrainingSession::Word, tries));
-        case Phrase::Sentence:
-            return QVariant(m_session->numberPhrasesGroupedByTries(TrainingSession::Sentence, tries));
-        case Phrase::Expression:
-            return QVariant(m_session->numberPhrasesGroupedByTries(TrainingSession::Expression, tries));
-        case Phrase::Paragraph:
-            return QVariant(m_session->numberPhrasesGroupedByTries(TrainingSession::Paragraph, tries));
-        default:
-            return QVariant();
+    // normal tries, the session keeps the histogram such that this is a lookup
+    if (index.column() < 0 || index.column() >= columnCount()) {
+        return QVariant();
     }
+    return QVariant(m_session->numberPhrasesGroupedByTries(static_cast<IPhrase::Type>(index.column()), index.row()));
 }
 
 QVariant LearningProgressModel::headerData(int section, Qt::Orientation orientation, int role) const
@@ -127,14 +123,14 @@ QVariant LearningProgressModel::headerData(int section, Qt::Orientation orientat
         return QAbstractTableModel::headerData(section, orientation, role);
     }
 
-    switch (section) {
-        case Phrase::Word:
+    switch (static_cast<IPhrase::Type>(section)) {
+        case IPhrase::Type::Word:
             return QVariant(i18n("Words"));
-        case Phrase::Sentence:
+        case IPhrase::Type::Sentence:
             return QVariant(i18n("Sentences"));
-        case Phrase::Expression:
+        case IPhrase::Type::Expression:
             return QVariant(i18n("Expressions"));
-        case Phrase::Paragraph:
+        case IPhrase::Type::Paragraph:
             return QVariant(i18n("Paragraphs"));
         default:
             return QVariant();
@@ -144,6 +140,21 @@ QVariant LearningProgressModel::headerData(int section, Qt::Orientation orientat
 void LearningProgressModel::updateResults()
 {
     beginResetModel();
-    // nothing to do
+    m_maximumTries = m_session ? m_session->maximumTries() : 0;
     endResetModel();
+    emit maximumTriesChanged();
+}
+
+void LearningProgressModel::updateCell(IPhrase::Type type, int tries)
+{
+    if (tries > m_maximumTries) {
+        // new rows are inserted in front of the trailing (max + 1)st row
+        beginInsertRows(QModelIndex(), m_maximumTries + 1, tries);
+        m_maximumTries = tries;
+        endInsertRows();
+    }
+    const QModelIndex cell = index(tries, static_cast<int>(type));
+    emit dataChanged(cell, cell, {Qt::DisplayRole});
+    // also covers changes of maximumPhrasesPerTry
+    emit maximumTriesChanged();
 }
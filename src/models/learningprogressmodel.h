@@ -7,6 +7,7 @@
 #ifndef LEARNINGPROGRESSMODEL_H
 #define LEARNINGPROGRESSMODEL_H
 
+#include "core/iphrase.h"
 #include <QAbstractItemModel>
 #include <QAbstractTableModel>
 
@@ -42,6 +43,10 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void updateResults();
+    /**
+     * @brief propagate a single changed cell, rows are only inserted when the maximum number of tries grows
+     */
+    void updateCell(IPhrase::Type type, int tries);
 
 private:
     TrainingSession *m_session;
@@ -8,8 +8,7 @@
 #include "core/icourse.h"
 #include "core/phonemegroup.h"
 #include "core/unit.h"
-
-#include <QSignalMapper>
+#include "rowchangerouter.h"
 
 #include "artikulate_debug.h"
 #include <KLocalizedString>
@@ -18,9 +17,9 @@ PhonemeUnitModel::PhonemeUnitModel(QObject *parent)
     : QAbstractListModel(parent)
     , m_course(nullptr)
     , m_phonemeGroup(nullptr)
-    , m_signalMapper(new QSignalMapper(this))
+    , m_router(new RowChangeRouter(this))
 {
-    connect(m_signalMapper, SIGNAL(mapped(int)), SLOT(emitUnitChanged(int)));
+    connect(m_router, &RowChangeRouter::rowsChanged, this, &PhonemeUnitModel::emitUnitsChanged);
     connect(this, &PhonemeUnitModel::phonemeGroupChanged, this, &PhonemeUnitModel::countChanged);
     connect(this, &PhonemeUnitModel::courseChanged, this, &PhonemeUnitModel::countChanged);
 }
@@ -48,6 +47,7 @@ void PhonemeUnitModel::setCourse(ICourse *course)
     if (m_course) {
         m_course->disconnect(this);
     }
+    m_router->clear();
 
     m_course = course;
 
@@ -142,20 +142,21 @@ int PhonemeUnitModel::rowCount(const QModelIndex &parent) const
 
 void PhonemeUnitModel::onUnitAboutToBeAdded(PhonemeGroup *phonemeGroup, int index)
 {
-    connect(phonemeGroup, SIGNAL(titleChanged()), m_signalMapper, SLOT(map()));
+    m_router->insert(index, phonemeGroup);
+    m_router->watch(phonemeGroup, &PhonemeGroup::titleChanged);
     // TODO add missing signals
     beginInsertRows(QModelIndex(), index, index);
 }
 
 void PhonemeUnitModel::onUnitAdded()
 {
-    updateMappings();
     endInsertRows();
     emit countChanged();
 }
 
 void PhonemeUnitModel::onUnitsAboutToBeRemoved(int first, int last)
 {
+    m_router->remove(first, last);
     beginRemoveRows(QModelIndex(), first, last);
 }
 
@@ -165,10 +166,12 @@ void PhonemeUnitModel::onUnitsRemoved()
     emit countChanged();
 }
 
-void PhonemeUnitModel::emitUnitChanged(int row)
+void PhonemeUnitModel::emitUnitsChanged(int first, int last)
 {
-    emit unitChanged(row);
-    emit dataChanged(index(row, 0), index(row, 0));
+    for (int row = first; row <= last; ++row) {
+        emit unitChanged(row);
+    }
+    emit dataChanged(index(first, 0), index(last, 0));
 }
 
 QVariant PhonemeUnitModel::headerData(int section, Qt::Orientation orientation, int role) const
@@ -191,11 +194,3 @@ int PhonemeUnitModel::count() const
     //    }
     //    return m_course->phonemeUnitList(m_phonemeGroup).count();
 }
-
-void PhonemeUnitModel::updateMappings()
-{
-    //    int units = m_course->phonemeUnitList(m_phonemeGroup).count();
-    //    for (int i = 0; i < units; i++) {
-    //        m_signalMapper->setMapping(m_course->phonemeUnitList(m_phonemeGroup).at(i), i);
-    //    }
-}
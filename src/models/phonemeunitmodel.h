@@ -13,7 +13,7 @@ class PhonemeGroup;
 class ICourse;
 class Unit;
 class PhonemeGroup;
-class QSignalMapper;
+class RowChangeRouter;
 
 class PhonemeUnitModel : public QAbstractListModel
 {
@@ -50,13 +50,12 @@ private Q_SLOTS:
     void onUnitAdded();
     void onUnitsAboutToBeRemoved(int first, int last);
     void onUnitsRemoved();
-    void emitUnitChanged(int row);
+    void emitUnitsChanged(int first, int last);
 
 private:
-    void updateMappings();
     ICourse *m_course;
     PhonemeGroup *m_phonemeGroup;
-    QSignalMapper *m_signalMapper;
+    RowChangeRouter *m_router;
 };
 
 #endif // PHONEMEUNITMODEL_H
@@ -17,7 +17,10 @@ PhraseFilterModel::PhraseFilterModel(QObject *parent)
     , m_phraseModel(nullptr)
     , m_hideExcluded(true)
 {
+    // changed phrases are filtered again on dataChanged of the phrase model
+    setDynamicSortFilter(true);
     setHideExcluded(true);
+    connect(this, &QSortFilterProxyModel::sortRoleChanged, this, &PhraseFilterModel::invalidateSortKeys);
 }
 
 PhraseListModel *PhraseFilterModel::phraseModel() const
@@ -55,7 +58,22 @@ void PhraseFilterModel::setPhraseModel(PhraseListModel *phraseModel)
         return;
     }
 
+    for (auto &connection : m_sourceConnections) {
+        QObject::disconnect(connection);
+    }
+    m_sourceConnections.clear();
+    invalidateSortKeys();
+
     m_phraseModel = phraseModel;
+    // sort keys must be updated before the proxy handles the same signals, thus connect first
+    if (m_phraseModel) {
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::rowsInserted, this, &PhraseFilterModel::onSourceRowsInserted));
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::rowsRemoved, this, &PhraseFilterModel::onSourceRowsRemoved));
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::dataChanged, this, &PhraseFilterModel::onSourceDataChanged));
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::modelReset, this, &PhraseFilterModel::invalidateSortKeys));
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::layoutChanged, this, &PhraseFilterModel::invalidateSortKeys));
+        m_sourceConnections.append(connect(m_phraseModel, &QAbstractItemModel::rowsMoved, this, &PhraseFilterModel::invalidateSortKeys));
+    }
     setSourceModel(m_phraseModel);
     sort(0);
 
@@ -65,7 +83,7 @@ void PhraseFilterModel::setPhraseModel(PhraseListModel *phraseModel)
 void PhraseFilterModel::setSortOption(PhraseFilterModel::SortOption option)
 {
     m_sortOption = option;
-    invalidateFilter();
+    invalidate();
     emit sortOptionChanged();
 }
 
@@ -81,20 +99,93 @@ int PhraseFilterModel::filteredCount() const
 
 bool PhraseFilterModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
 {
+    if (!m_phraseModel || sourceModel() != m_phraseModel) {
+        return QSortFilterProxyModel::lessThan(left, right);
+    }
+    const SortKey &leftKey = sortKey(left.row());
+    const SortKey &rightKey = sortKey(right.row());
     if (m_sortOption == Type) {
-        return sourceModel()->data(left, PhraseListModel::TypeRole).toInt() < sourceModel()->data(right, PhraseListModel::TypeRole).toInt();
+        return leftKey.type < rightKey.type;
     }
-    return QSortFilterProxyModel::lessThan(left, right);
+    if (isSortLocaleAware()) {
+        return QString::localeAwareCompare(leftKey.text, rightKey.text) < 0;
+    }
+    return QString::compare(leftKey.text, rightKey.text, sortCaseSensitivity()) < 0;
 }
 
 bool PhraseFilterModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
 {
+    Q_UNUSED(source_parent)
     int result = true;
     if (m_hideNotRecorded || m_hideExcluded) {
-        QModelIndex index = sourceModel()->index(source_row, 0, source_parent);
-        bool notRecorded = sourceModel()->data(index, PhraseListModel::SoundFileRole).toUrl().isEmpty();
-        bool excluded = sourceModel()->data(index, PhraseListModel::ExcludedRole).toBool();
+        const IPhrase *const phrase = m_phraseModel ? m_phraseModel->phrase(source_row) : nullptr;
+        if (!phrase) {
+            return true;
+        }
+        bool notRecorded = phrase->sound().isEmpty();
+        bool excluded = m_phraseModel->isExcluded(source_row);
         result = !(notRecorded || excluded);
     }
     return result;
 }
+
+const PhraseFilterModel::SortKey &PhraseFilterModel::sortKey(int sourceRow) const
+{
+    if (!m_sortKeysValid) {
+        const int rows = m_phraseModel->rowCount();
+        m_sortKeys.clear();
+        m_sortKeys.reserve(rows);
+        for (int row = 0; row < rows; ++row) {
+            m_sortKeys.append(createSortKey(row));
+        }
+        m_sortKeysValid = true;
+    }
+    Q_ASSERT(sourceRow >= 0 && sourceRow < m_sortKeys.count());
+    return m_sortKeys.at(sourceRow);
+}
+
+PhraseFilterModel::SortKey PhraseFilterModel::createSortKey(int sourceRow) const
+{
+    SortKey key;
+    if (const IPhrase *phrase = m_phraseModel->phrase(sourceRow)) {
+        key.type = static_cast<int>(phrase->type());
+    }
+    // text is taken from the sort role, such that the order matches QSortFilterProxyModel::lessThan
+    key.text = m_phraseModel->data(m_phraseModel->index(sourceRow), sortRole()).toString();
+    return key;
+}
+
+void PhraseFilterModel::invalidateSortKeys()
+{
+    m_sortKeysValid = false;
+    m_sortKeys.clear();
+}
+
+void PhraseFilterModel::onSourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (!m_sortKeysValid || parent.isValid()) {
+        return;
+    }
+    m_sortKeys.insert(first, last - first + 1, SortKey());
+    for (int row = first; row <= last; ++row) {
+        m_sortKeys[row] = createSortKey(row);
+    }
+}
+
+void PhraseFilterModel::onSourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!m_sortKeysValid || parent.isValid()) {
+        return;
+    }
+    m_sortKeys.remove(first, last - first + 1);
+}
+
+void PhraseFilterModel::onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    if (!m_sortKeysValid) {
+        return;
+    }
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row) {
+        m_sortKeys[row] = createSortKey(row);
+    }
+}
@@ -9,6 +9,7 @@
 #define PHRASEFILTERMODEL_H
 
 #include <QSortFilterProxyModel>
+#include <QVector>
 
 class PhraseListModel;
 
@@ -45,10 +46,27 @@ Q_SIGNALS:
     void filteredCountChanged();
 
 private:
+    /**
+     * Sort key of a source row, computed once per row instead of once per comparison
+     */
+    struct SortKey {
+        int type {0};
+        QString text;
+    };
+    const SortKey &sortKey(int sourceRow) const;
+    SortKey createSortKey(int sourceRow) const;
+    void invalidateSortKeys();
+    void onSourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void onSourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+
     PhraseListModel *m_phraseModel;
     bool m_hideExcluded;
-    bool m_hideNotRecorded;
-    SortOption m_sortOption;
+    bool m_hideNotRecorded {false};
+    SortOption m_sortOption {Id};
+    mutable QVector<SortKey> m_sortKeys;
+    mutable bool m_sortKeysValid {false};
+    QVector<QMetaObject::Connection> m_sourceConnections;
 };
 
 #endif
@@ -6,15 +6,15 @@
 
 #include "phraselistmodel.h"
 #include "core/unit.h"
+#include "rowchangerouter.h"
 #include <KLocalizedString>
-#include <QSignalMapper>
 
 PhraseListModel::PhraseListModel(QObject *parent)
     : QAbstractListModel(parent)
     , m_unit(nullptr)
-    , m_signalMapper(new QSignalMapper(this))
+    , m_router(new RowChangeRouter(this))
 {
-    connect(m_signalMapper, SIGNAL(mapped(int)), SLOT(emitPhraseChanged(int)));
+    connect(m_router, &RowChangeRouter::rowsChanged, this, &PhraseListModel::emitPhrasesChanged);
 
     // connect all phrase number operations to single signal
     connect(this, &PhraseListModel::typeChanged, this, &PhraseListModel::countChanged);
@@ -44,27 +44,26 @@ void PhraseListModel::setUnit(Unit *unit)
 
     if (m_unit) {
         m_unit->disconnect(this);
-        for (auto &phrase : m_unit->phrases()) {
-            phrase->disconnect(this);
-        }
     }
+    m_router->clear();
 
     m_unit = unit;
     if (m_unit) {
+        // the listed unit is opened
+        m_unit->ensureLoaded();
         // initial setting of signal mappings
         connect(m_unit, &Unit::phraseAboutToBeAdded, this, &PhraseListModel::onPhraseAboutToBeAdded);
         connect(m_unit, &Unit::phraseAdded, this, &PhraseListModel::onPhraseAdded);
         connect(m_unit, &Unit::phraseAboutToBeRemoved, this, &PhraseListModel::onPhraseAboutToBeRemoved);
         connect(m_unit, &Unit::phraseRemoved, this, &PhraseListModel::onPhrasesRemoved);
+        connect(m_unit, &Unit::phrasesAboutToBeReset, this, &PhraseListModel::onPhrasesAboutToBeReset);
+        connect(m_unit, &Unit::phrasesReset, this, &PhraseListModel::onPhrasesReset);
 
-        // insert and connect all already existing phrases
-        int phrases = m_unit->phrases().count();
-        for (int i = 0; i < phrases; ++i) {
-            onPhraseAboutToBeAdded(m_unit->phrases().at(i), i);
-            endInsertRows();
-            emit countChanged();
+        // connect all already existing phrases
+        const auto phrases = m_unit->phraseRange();
+        for (int i = 0; i < phrases.count(); ++i) {
+            watchPhrase(phrases.at(i).get(), i);
         }
-        updateMappings();
     }
 
     // emit done
@@ -85,11 +84,12 @@ QVariant PhraseListModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    if (index.row() >= m_unit->phrases().count()) {
+    if (index.row() >= m_unit->phraseCount()) {
         return QVariant();
     }
 
-    std::shared_ptr<IPhrase> const phrase = m_unit->phrases().at(index.row());
+    // neither the phrase list nor the phrase pointer are copied for each data() call
+    IPhrase *const phrase = m_unit->phraseRange().at(index.row()).get();
 
     switch (role) {
         case Qt::DisplayRole:
@@ -104,10 +104,10 @@ QVariant PhraseListModel::data(const QModelIndex &index, int role) const
             return phrase->id();
         case TypeRole:
             return QVariant::fromValue<IPhrase::Type>(phrase->type());
-            //    case ExcludedRole: //FIXME
-            //        return phrase->isExcluded();
+        case ExcludedRole:
+            return isExcluded(index.row());
         case DataRole:
-            return QVariant::fromValue<QObject *>(phrase.get());
+            return QVariant::fromValue<QObject *>(phrase);
         default:
             return QVariant();
     }
@@ -122,26 +122,50 @@ int PhraseListModel::rowCount(const QModelIndex &parent) const
     if (parent.isValid()) {
         return 0;
     }
-    return m_unit->phrases().count();
+    return m_unit->phraseCount();
+}
+
+IPhrase *PhraseListModel::phrase(int row) const
+{
+    if (!m_unit || row < 0 || row >= m_unit->phraseCount()) {
+        return nullptr;
+    }
+    return m_unit->phraseRange().at(row).get();
+}
+
+bool PhraseListModel::isExcluded(int row) const
+{
+    // only editable phrases can be excluded from their unit
+    const auto editablePhrase = qobject_cast<const Phrase *>(phrase(row));
+    return editablePhrase && editablePhrase->isExcluded();
+}
+
+void PhraseListModel::watchPhrase(IPhrase *phrase, int row)
+{
+    m_router->insert(row, phrase);
+    m_router->watch(phrase, &IPhrase::textChanged);
+    m_router->watch(phrase, &IPhrase::typeChanged);
+    m_router->watch(phrase, &IPhrase::soundChanged);
+    if (auto editablePhrase = qobject_cast<Phrase *>(phrase)) {
+        m_router->watch(editablePhrase, &Phrase::excludedChanged);
+    }
 }
 
 void PhraseListModel::onPhraseAboutToBeAdded(std::shared_ptr<IPhrase> phrase, int index)
 {
-    connect(phrase.get(), SIGNAL(textChanged()), m_signalMapper, SLOT(map()));
-    connect(phrase.get(), SIGNAL(typeChanged()), m_signalMapper, SLOT(map()));
-    connect(phrase.get(), SIGNAL(excludedChanged()), m_signalMapper, SLOT(map()));
+    watchPhrase(phrase.get(), index);
     beginInsertRows(QModelIndex(), index, index);
 }
 
 void PhraseListModel::onPhraseAdded()
 {
-    updateMappings();
     endInsertRows();
     emit countChanged();
 }
 
 void PhraseListModel::onPhraseAboutToBeRemoved(int index)
 {
+    m_router->remove(index, index);
     beginRemoveRows(QModelIndex(), index, index);
 }
 
@@ -151,14 +175,29 @@ void PhraseListModel::onPhrasesRemoved()
     emit countChanged();
 }
 
-void PhraseListModel::emitPhraseChanged(int row)
+void PhraseListModel::onPhrasesAboutToBeReset()
 {
     beginResetModel();
+    m_router->clear();
+}
+
+void PhraseListModel::onPhrasesReset()
+{
+    const auto phrases = m_unit->phraseRange();
+    for (int i = 0; i < phrases.count(); ++i) {
+        watchPhrase(phrases.at(i).get(), i);
+    }
     endResetModel();
-    // FIXME very inefficient, but workaround to force new filtering in phrasefiltermodel
-    //      to exclude possible new excluded phrases
-    emit phraseChanged(row);
-    emit dataChanged(index(row, 0), index(row, 0));
+    emit countChanged();
+}
+
+void PhraseListModel::emitPhrasesChanged(int first, int last)
+{
+    for (int row = first; row <= last; ++row) {
+        emit phraseChanged(row);
+    }
+    // the dynamic filter of PhraseFilterModel re-evaluates changed rows
+    emit dataChanged(index(first, 0), index(last, 0));
 }
 
 QVariant PhraseListModel::headerData(int section, Qt::Orientation orientation, int role) const
@@ -177,16 +216,5 @@ int PhraseListModel::count() const
     if (!m_unit) {
         return 0;
     }
-    return m_unit->phrases().count();
-}
-
-void PhraseListModel::updateMappings()
-{
-    if (!m_unit) {
-        return;
-    }
-    int phrases = m_unit->phrases().count();
-    for (int i = 0; i < phrases; ++i) {
-        m_signalMapper->setMapping(m_unit->phrases().at(i).get(), i);
-    }
+    return m_unit->phraseCount();
 }
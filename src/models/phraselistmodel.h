@@ -10,8 +10,8 @@
 #include "core/phrase.h"
 #include <QAbstractListModel>
 
+class RowChangeRouter;
 class Unit;
-class QSignalMapper;
 
 class PhraseListModel : public QAbstractListModel
 {
@@ -41,6 +41,16 @@ public:
      */
     int count() const;
 
+    /**
+     * \return phrase at @p row or nullptr if the row does not exist
+     */
+    IPhrase *phrase(int row) const;
+
+    /**
+     * \return true if the phrase at @p row is excluded from its unit
+     */
+    bool isExcluded(int row) const;
+
 Q_SIGNALS:
     void phraseChanged(int index);
     void unitChanged();
@@ -52,12 +62,15 @@ private Q_SLOTS:
     void onPhraseAdded();
     void onPhraseAboutToBeRemoved(int index);
     void onPhrasesRemoved();
-    void emitPhraseChanged(int row);
+    void onPhrasesAboutToBeReset();
+    void onPhrasesReset();
+    void emitPhrasesChanged(int first, int last);
 
 private:
-    void updateMappings();
+    void watchPhrase(IPhrase *phrase, int row);
+
     Unit *m_unit;
-    QSignalMapper *m_signalMapper;
+    RowChangeRouter *m_router;
 };
 
 #endif
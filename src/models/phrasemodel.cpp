@@ -8,25 +8,15 @@
 #include "artikulate_debug.h"
 #include "core/icourse.h"
 #include "core/unit.h"
+#include "rowchangerouter.h"
 #include <KLocalizedString>
-#include <QSignalMapper>
 
 PhraseModel::PhraseModel(QObject *parent)
     : QAbstractItemModel(parent)
     , m_course(nullptr)
-    , m_unitSignalMapper(new QSignalMapper)
-    , m_phraseSignalMapper(new QSignalMapper)
+    , m_unitRouter(new RowChangeRouter(this))
 {
-#if QT_VERSION < QT_VERSION_CHECK(5, 15, 0)
-    connect(m_unitSignalMapper, static_cast<void (QSignalMapper::*)(int)>(&QSignalMapper::mapped), this, &PhraseModel::onUnitChanged);
-#else
-    connect(m_unitSignalMapper, &QSignalMapper::mappedInt, this, &PhraseModel::onUnitChanged);
-#endif
-#if QT_VERSION < QT_VERSION_CHECK(5, 15, 0)
-    connect(m_phraseSignalMapper, static_cast<void (QSignalMapper::*)(QObject *)>(&QSignalMapper::mapped), this, &PhraseModel::onPhraseChanged);
-#else
-    connect(m_phraseSignalMapper, &QSignalMapper::mappedObject, this, &PhraseModel::onPhraseChanged);
-#endif
+    connect(m_unitRouter, &RowChangeRouter::rowsChanged, this, &PhraseModel::onUnitsChanged);
 }
 
 QHash<int, QByteArray> PhraseModel::roleNames() const
@@ -44,17 +34,22 @@ void PhraseModel::setCourse(ICourse *course)
         return;
     }
 
-    beginResetModel();
+    // a pending batch reset is continued as reset of the course change
+    if (!m_resetting) {
+        beginResetModel();
+    }
+    m_resetting = false;
+    m_resettingUnits.clear();
 
     if (m_course) {
         m_course->disconnect(this);
-        for (auto unit : m_course->units()) {
+        for (const auto &unit : m_course->unitRange()) {
             unit->disconnect(this);
-            for (auto &phrase : unit->phrases()) {
-                phrase->disconnect(this);
-            }
         }
     }
+    m_unitRouter->clear();
+    qDeleteAll(m_phraseRouters);
+    m_phraseRouters.clear();
 
     m_course = course;
     if (m_course) {
@@ -64,24 +59,10 @@ void PhraseModel::setCourse(ICourse *course)
         connect(m_course, &ICourse::unitsAboutToBeRemoved, this, &PhraseModel::onUnitsAboutToBeRemoved);
         connect(m_course, &ICourse::unitsRemoved, this, &PhraseModel::onUnitsRemoved);
 
-        // initial setting of signal mappings
-        for (auto unit : m_course->units()) {
-            // connect to phrase changes
-            connect(unit.get(), &Unit::phraseAboutToBeAdded, this, &PhraseModel::onPhraseAboutToBeAdded);
-            connect(unit.get(), &Unit::phraseAdded, this, &PhraseModel::onPhraseAdded);
-            connect(unit.get(), &Unit::phraseAboutToBeRemoved, this, &PhraseModel::onPhraseAboutToBeRemoved);
-            connect(unit.get(), &Unit::phraseRemoved, this, &PhraseModel::onPhrasesRemoved);
-            connect(unit.get(), &Unit::titleChanged, m_unitSignalMapper, static_cast<void (QSignalMapper::*)()>(&QSignalMapper::map));
-
-            // insert and connect all already existing phrases
-            int phrases = unit->phrases().count();
-            for (int i = 0; i < phrases; ++i) {
-                onPhraseAboutToBeAdded(unit->phrases().at(i), i);
-                endInsertRows();
-            }
+        const auto units = m_course->unitRange();
+        for (int i = 0; i < units.count(); ++i) {
+            addUnit(units.at(i).get(), i);
         }
-        updateUnitMappings();
-        updatePhraseMappings();
     }
 
     // emit done
@@ -94,6 +75,98 @@ ICourse *PhraseModel::course() const
     return m_course;
 }
 
+void PhraseModel::addUnit(Unit *unit, int row)
+{
+    m_unitRouter->insert(row, unit);
+    m_unitRouter->watch(unit, &IUnit::titleChanged);
+
+    auto phraseRouter = new RowChangeRouter(this);
+    m_phraseRouters.insert(unit, phraseRouter);
+    // phrases of units that are not loaded yet are listed once the unit is fetched, see fetchMore()
+    trackPhrases(unit, phraseRouter);
+    connect(unit, &Unit::loaded, this, [this, unit, phraseRouter]() {
+        const int count = unit->phraseCount();
+        if (m_resetting || count == 0) {
+            trackPhrases(unit, phraseRouter);
+            return;
+        }
+        beginInsertRows(indexUnit(unit), 0, count - 1);
+        trackPhrases(unit, phraseRouter);
+        endInsertRows();
+    });
+    connect(phraseRouter, &RowChangeRouter::rowsChanged, this, [this, unit](int first, int last) {
+        const QModelIndex parent = indexUnit(unit);
+        emit dataChanged(index(first, 0, parent), index(last, 0, parent));
+    });
+
+    connect(unit, &Unit::phraseAboutToBeAdded, this, [this, unit, phraseRouter](std::shared_ptr<IPhrase> phrase, int index) {
+        phraseRouter->insert(index, phrase.get());
+        phraseRouter->watch(phrase.get(), &IPhrase::textChanged);
+        if (!m_resetting) {
+            beginInsertRows(indexUnit(unit), index, index);
+        }
+    });
+    connect(unit, &Unit::phraseAdded, this, [this]() {
+        if (!m_resetting) {
+            endInsertRows();
+        }
+    });
+    connect(unit, &Unit::phraseAboutToBeRemoved, this, [this, unit, phraseRouter](int index) {
+        phraseRouter->remove(index, index);
+        if (!m_resetting) {
+            beginRemoveRows(indexUnit(unit), index, index);
+        }
+    });
+    connect(unit, &Unit::phraseRemoved, this, [this]() {
+        if (!m_resetting) {
+            endRemoveRows();
+        }
+    });
+    // batched phrase changes cannot be expressed per parent, thus the whole model is reset
+    connect(unit, &Unit::phrasesAboutToBeReset, this, [this, unit, phraseRouter]() {
+        beginUnitReset(unit);
+        phraseRouter->clear();
+    });
+    connect(unit, &Unit::phrasesReset, this, [this, unit, phraseRouter]() {
+        trackPhrases(unit, phraseRouter);
+        endUnitReset(unit);
+    });
+}
+
+void PhraseModel::trackPhrases(Unit *unit, RowChangeRouter *phraseRouter)
+{
+    phraseRouter->clear();
+    const auto phrases = unit->phraseRange();
+    for (int i = 0; i < phrases.count(); ++i) {
+        phraseRouter->insert(i, phrases.at(i).get());
+        phraseRouter->watch(phrases.at(i).get(), &IPhrase::textChanged);
+    }
+}
+
+void PhraseModel::beginUnitReset(const IUnit *unit)
+{
+    // all units of a course batch announce their reset before the first of them finishes
+    if (!m_resetting) {
+        m_resetting = true;
+        beginResetModel();
+    }
+    m_resettingUnits.insert(unit);
+}
+
+void PhraseModel::endUnitReset(const IUnit *unit)
+{
+    m_resettingUnits.remove(unit);
+    finishReset();
+}
+
+void PhraseModel::finishReset()
+{
+    if (m_resetting && m_resettingUnits.isEmpty()) {
+        m_resetting = false;
+        endResetModel();
+    }
+}
+
 QVariant PhraseModel::data(const QModelIndex &index, int role) const
 {
     Q_ASSERT(m_course);
@@ -103,10 +176,10 @@ QVariant PhraseModel::data(const QModelIndex &index, int role) const
     }
 
     if (!index.internalPointer()) {
-        if (!m_course || m_course->units().size() == 0) {
+        if (!m_course || m_course->unitCount() == 0) {
             return QVariant();
         }
-        auto unit = m_course->units().at(index.row());
+        const auto &unit = m_course->unitRange().at(index.row());
         switch (role) {
             case TextRole:
                 return unit->title();
@@ -119,9 +192,9 @@ QVariant PhraseModel::data(const QModelIndex &index, int role) const
         Unit *unit = static_cast<Unit *>(index.internalPointer());
         switch (role) {
             case TextRole:
-                return unit->phrases().at(index.row())->text();
+                return unit->phraseRange().at(index.row())->text();
             case DataRole:
-                return QVariant::fromValue<QObject *>(unit->phrases().at(index.row()).get());
+                return QVariant::fromValue<QObject *>(unit->phraseRange().at(index.row()).get());
             default:
                 return QVariant();
         }
@@ -136,7 +209,7 @@ int PhraseModel::rowCount(const QModelIndex &parent) const
 
     // no valid index -> must be (invisible) root
     if (!parent.isValid()) {
-        return m_course->units().count();
+        return m_course->unitCount();
     }
 
     // internal pointer -> must be a phrase
@@ -144,9 +217,36 @@ int PhraseModel::rowCount(const QModelIndex &parent) const
         return 0;
     }
 
-    // else -> must be a unit
-    Unit *unit = m_course->units().at(parent.row()).get();
-    return unit->phrases().count();
+    // else -> must be a unit, counted by the phrases announced to views so far
+    const RowChangeRouter *phraseRouter = m_phraseRouters.value(m_course->unitRange().at(parent.row()).get());
+    return phraseRouter ? phraseRouter->count() : 0;
+}
+
+bool PhraseModel::hasChildren(const QModelIndex &parent) const
+{
+    if (!m_course || !parent.isValid() || parent.internalPointer()) {
+        return QAbstractItemModel::hasChildren(parent);
+    }
+    // units that are not loaded cannot tell yet, they are assumed to have phrases
+    const auto &unit = m_course->unitRange().at(parent.row());
+    return !unit->isLoaded() || unit->phraseCount() > 0;
+}
+
+bool PhraseModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (!m_course || !parent.isValid() || parent.internalPointer()) {
+        return false;
+    }
+    return !m_course->unitRange().at(parent.row())->isLoaded();
+}
+
+void PhraseModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent)) {
+        return;
+    }
+    // rows are inserted when the unit reports it is loaded
+    m_course->unitRange().at(parent.row())->ensureLoaded();
 }
 
 int PhraseModel::columnCount(const QModelIndex &parent) const
@@ -160,13 +260,7 @@ QModelIndex PhraseModel::parent(const QModelIndex &child) const
     if (!child.internalPointer() || !m_course) {
         return QModelIndex();
     }
-    Unit *parent = static_cast<Unit *>(child.internalPointer());
-    for (int i = 0; i < m_course->units().count(); ++i) {
-        if (m_course->units().at(i).get() == parent) {
-            return createIndex(i, 0);
-        }
-    }
-    return QModelIndex();
+    return indexUnit(static_cast<Unit *>(child.internalPointer()));
 }
 
 QModelIndex PhraseModel::index(int row, int column, const QModelIndex &parent) const
@@ -174,7 +268,7 @@ QModelIndex PhraseModel::index(int row, int column, const QModelIndex &parent) c
     if (!parent.isValid()) { // unit elements
         return createIndex(row, column);
     } else { // phrase elements
-        auto unit = m_course->units().at(parent.row());
+        const auto &unit = m_course->unitRange().at(parent.row());
         if (unit) {
             return createIndex(row, column, unit.get());
         }
@@ -188,7 +282,7 @@ QModelIndex PhraseModel::indexPhrase(Phrase *phrase) const
         return QModelIndex();
     }
     auto unit = phrase->unit();
-    return createIndex(unit->phrases().indexOf(phrase->self()), 0, unit.get());
+    return createIndex(unit->indexOf(phrase), 0, unit.get());
 }
 
 QModelIndex PhraseModel::indexUnit(Unit *unit) const
@@ -196,14 +290,8 @@ QModelIndex PhraseModel::indexUnit(Unit *unit) const
     if (!unit || !m_course) {
         return QModelIndex();
     }
-    int uIndex {-1};
-    for (int i = 0; i < m_course->units().size(); ++i) {
-        if (m_course->units().at(i)->id() == unit->id()) {
-            uIndex = i;
-            break;
-        }
-    }
-    return createIndex(uIndex, 0);
+    const int row = m_unitRouter->row(unit);
+    return row >= 0 ? createIndex(row, 0) : QModelIndex();
 }
 
 bool PhraseModel::isUnit(const QModelIndex &index) const
@@ -211,76 +299,48 @@ bool PhraseModel::isUnit(const QModelIndex &index) const
     return (index.internalPointer() == nullptr);
 }
 
-void PhraseModel::onPhraseAboutToBeAdded(std::shared_ptr<IPhrase> phrase, int index)
-{
-    int uIndex {-1};
-    for (int i = 0; i < m_course->units().size(); ++i) {
-        if (m_course->units().at(i)->id() == phrase->unit()->id()) {
-            uIndex = i;
-            break;
-        }
-    }
-    connect(phrase.get(), &IPhrase::textChanged, m_phraseSignalMapper, static_cast<void (QSignalMapper::*)()>(&QSignalMapper::map));
-    beginInsertRows(createIndex(uIndex, 0), index, index);
-}
-
-void PhraseModel::onPhraseAdded()
-{
-    endInsertRows();
-    updatePhraseMappings();
-}
-
-void PhraseModel::onPhraseAboutToBeRemoved(int index)
-{
-    Q_UNUSED(index)
-    // TODO better solution requires access to unit
-    // TODO remove connections from m_phraseSignalMapper
-    beginResetModel();
-}
-
-void PhraseModel::onPhrasesRemoved()
-{
-    endResetModel();
-}
-
-void PhraseModel::onPhraseChanged(QObject *phrase)
-{
-    Phrase *changedPhrase = qobject_cast<Phrase *>(phrase);
-    Q_ASSERT(changedPhrase);
-    QModelIndex index = indexPhrase(changedPhrase);
-    emit dataChanged(index, index);
-}
-
 void PhraseModel::onUnitAboutToBeAdded(std::shared_ptr<Unit> unit, int index)
 {
-    Q_UNUSED(unit)
-    beginInsertRows(QModelIndex(), index, index);
-    connect(unit.get(), &Unit::titleChanged, m_unitSignalMapper, static_cast<void (QSignalMapper::*)()>(&QSignalMapper::map));
+    if (!m_resetting) {
+        beginInsertRows(QModelIndex(), index, index);
+    }
+    addUnit(unit.get(), index);
 }
 
 void PhraseModel::onUnitAdded()
 {
-    endInsertRows();
-    updateUnitMappings();
+    if (!m_resetting) {
+        endInsertRows();
+    }
 }
 
 void PhraseModel::onUnitsAboutToBeRemoved(int first, int last)
 {
+    const auto units = m_course->unitRange();
     for (int i = first; i <= last; ++i) {
-        auto unit = m_course->units().at(i);
-        disconnect(unit.get(), &Unit::titleChanged, m_unitSignalMapper, static_cast<void (QSignalMapper::*)()>(&QSignalMapper::map));
+        units.at(i)->disconnect(this);
+        delete m_phraseRouters.take(units.at(i).get());
+        // removed units do not report the end of their batch anymore
+        m_resettingUnits.remove(units.at(i).get());
+    }
+    m_unitRouter->remove(first, last);
+    if (!m_resetting) {
+        beginRemoveRows(QModelIndex(), first, last);
     }
-    beginRemoveRows(QModelIndex(), first, last);
 }
 
 void PhraseModel::onUnitsRemoved()
 {
-    endRemoveRows();
+    if (m_resetting) {
+        finishReset();
+    } else {
+        endRemoveRows();
+    }
 }
 
-void PhraseModel::onUnitChanged(int index)
+void PhraseModel::onUnitsChanged(int first, int last)
 {
-    emit dataChanged(createIndex(index, 0), createIndex(index, 0));
+    emit dataChanged(createIndex(first, 0), createIndex(last, 0));
 }
 
 QVariant PhraseModel::headerData(int section, Qt::Orientation orientation, int role) const
@@ -306,34 +366,16 @@ IPhrase *PhraseModel::phrase(const QModelIndex &index) const
 {
     if (index.internalPointer()) {
         Unit *unit = static_cast<Unit *>(index.internalPointer());
-        return unit->phrases().at(index.row()).get();
+        return unit->phraseRange().at(index.row()).get();
     }
-    if (!m_course->units().at(index.row())->phrases().isEmpty()) {
-        return m_course->units().at(index.row())->phrases().first().get();
+    const auto phrases = m_course->unitRange().at(index.row())->phraseRange();
+    if (!phrases.isEmpty()) {
+        return phrases.first().get();
     }
     return nullptr;
 }
 
 Unit *PhraseModel::unit(const QModelIndex &index) const
 {
-    return m_course->units().at(index.row()).get();
-}
-
-void PhraseModel::updateUnitMappings()
-{
-    int units = m_course->units().count();
-    for (int i = 0; i < units; ++i) {
-        m_unitSignalMapper->setMapping(m_course->units().at(i).get(), i);
-    }
-}
-
-void PhraseModel::updatePhraseMappings()
-{
-    // TODO this might be quite costly for long units
-    // better, implement access based on index pairs
-    for (auto unit : m_course->units()) {
-        for (const auto &phrase : unit->phrases()) {
-            m_phraseSignalMapper->setMapping(phrase.get(), phrase.get());
-        }
-    }
+    return m_course->unitRange().at(index.row()).get();
 }
@@ -9,10 +9,11 @@
 
 #include "core/phrase.h"
 #include <QAbstractItemModel>
+#include <QSet>
 #include <memory>
 
 class ICourse;
-class QSignalMapper;
+class RowChangeRouter;
 
 class PhraseModel : public QAbstractItemModel
 {
@@ -28,6 +29,12 @@ public:
     ICourse *course() const;
     virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
     virtual int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    virtual bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    /**
+     * @brief units are loaded when their phrases are fetched, see Unit::ensureLoaded()
+     */
+    virtual bool canFetchMore(const QModelIndex &parent) const override;
+    virtual void fetchMore(const QModelIndex &parent) override;
     virtual int columnCount(const QModelIndex &parent = QModelIndex()) const override;
     virtual QModelIndex parent(const QModelIndex &child) const override;
     virtual QModelIndex index(int row, int column, const QModelIndex &parent) const override;
@@ -45,24 +52,36 @@ Q_SIGNALS:
     void typeChanged();
 
 private Q_SLOTS:
-    void onPhraseAboutToBeAdded(std::shared_ptr<IPhrase> phrase, int index);
-    void onPhraseAdded();
-    void onPhraseAboutToBeRemoved(int index);
-    void onPhrasesRemoved();
-    void onPhraseChanged(QObject *phrase);
     void onUnitAboutToBeAdded(std::shared_ptr<Unit> unit, int index);
     void onUnitAdded();
     void onUnitsAboutToBeRemoved(int first, int last);
     void onUnitsRemoved();
-    void onUnitChanged(int index);
+    void onUnitsChanged(int first, int last);
 
 private:
-    void updateUnitMappings();
-    void updatePhraseMappings();
+    /**
+     * @brief track unit @p unit at @p row and its phrases
+     */
+    void addUnit(Unit *unit, int row);
+    /**
+     * @brief list the current phrases of @p unit in @p phraseRouter
+     */
+    void trackPhrases(Unit *unit, RowChangeRouter *phraseRouter);
+    /**
+     * @brief start the model reset for a batch of @p unit, the model is reset once for all units of a course batch
+     */
+    void beginUnitReset(const IUnit *unit);
+    void endUnitReset(const IUnit *unit);
+    /**
+     * @brief end the model reset once no unit of the batch is pending
+     */
+    void finishReset();
 
     ICourse *m_course;
-    QSignalMapper *m_unitSignalMapper;
-    QSignalMapper *m_phraseSignalMapper;
+    RowChangeRouter *m_unitRouter;
+    QHash<const IUnit *, RowChangeRouter *> m_phraseRouters; //!< phrase rows per unit
+    QSet<const IUnit *> m_resettingUnits; //!< units whose batch is not finished
+    bool m_resetting {false};             //!< model reset is started, row signals are covered by it
 };
 
 #endif
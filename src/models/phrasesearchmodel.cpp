@@ -0,0 +1,145 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "phrasesearchmodel.h"
+#include "application.h"
+#include "core/icourse.h"
+#include "core/iphrase.h"
+
+PhraseSearchModel::PhraseSearchModel(QObject *parent)
+    : PhraseSearchModel(artikulateApp->phraseSearchIndex(), parent)
+{
+}
+
+PhraseSearchModel::PhraseSearchModel(PhraseSearchIndex *index, QObject *parent)
+    : QAbstractListModel(parent)
+{
+    setPhraseSearchIndex(index);
+}
+
+void PhraseSearchModel::setPhraseSearchIndex(PhraseSearchIndex *index)
+{
+    if (m_index == index) {
+        return;
+    }
+    if (m_index) {
+        disconnect(m_index, &PhraseSearchIndex::indexChanged, this, &PhraseSearchModel::updateResults);
+    }
+    m_index = index;
+    if (m_index) {
+        connect(m_index, &PhraseSearchIndex::indexChanged, this, &PhraseSearchModel::updateResults);
+    }
+    updateResults();
+}
+
+PhraseSearchIndex *PhraseSearchModel::phraseSearchIndex() const
+{
+    return m_index;
+}
+
+QHash<int, QByteArray> PhraseSearchModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[TextRole] = "text";
+    roles[I18nTextRole] = "i18nText";
+    roles[IdRole] = "id";
+    roles[UnitIdRole] = "unitId";
+    roles[UnitTitleRole] = "unitTitle";
+    roles[CourseIdRole] = "courseId";
+    roles[CourseTitleRole] = "courseTitle";
+    roles[ScoreRole] = "score";
+    roles[DataRole] = "dataRole";
+
+    return roles;
+}
+
+QVariant PhraseSearchModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || m_index == nullptr || index.row() >= m_results.count()) {
+        return QVariant();
+    }
+    const auto &result = m_results.at(index.row());
+    const auto &document = m_index->document(result.document);
+    switch (role) {
+        case Qt::DisplayRole:
+            return !document.i18nText.isEmpty() ? document.i18nText : document.text;
+        case TextRole:
+            return document.text;
+        case I18nTextRole:
+            return document.i18nText;
+        case IdRole:
+            return document.phraseId;
+        case UnitIdRole:
+            return document.unitId;
+        case UnitTitleRole:
+            return document.unitTitle;
+        case CourseIdRole: {
+            const auto course = m_index->course(result.document);
+            return course ? course->id() : QString();
+        }
+        case CourseTitleRole: {
+            const auto course = m_index->course(result.document);
+            return course ? course->i18nTitle() : QString();
+        }
+        case ScoreRole:
+            return result.score;
+        case DataRole:
+            // only resolved on request, as this loads courses restored from the cache
+            return QVariant::fromValue<QObject *>(m_index->phrase(result.document));
+        default:
+            return QVariant();
+    }
+}
+
+int PhraseSearchModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_results.count();
+}
+
+void PhraseSearchModel::setQuery(const QString &query)
+{
+    if (m_query == query) {
+        return;
+    }
+    m_query = query;
+    emit queryChanged();
+    updateResults();
+}
+
+QString PhraseSearchModel::query() const
+{
+    return m_query;
+}
+
+void PhraseSearchModel::setMaximumResults(int maximum)
+{
+    if (m_maximumResults == maximum) {
+        return;
+    }
+    m_maximumResults = maximum;
+    emit maximumResultsChanged();
+    updateResults();
+}
+
+int PhraseSearchModel::maximumResults() const
+{
+    return m_maximumResults;
+}
+
+void PhraseSearchModel::updateResults()
+{
+    beginResetModel();
+    if (m_index) {
+        m_results = m_index->search(m_query, m_maximumResults);
+    } else {
+        m_results.clear();
+    }
+    endResetModel();
+    emit countChanged();
+}
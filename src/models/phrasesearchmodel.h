@@ -0,0 +1,56 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef PHRASESEARCHMODEL_H
+#define PHRASESEARCHMODEL_H
+
+#include "artikulatecore_export.h"
+#include "core/phrasesearchindex.h"
+#include <QAbstractListModel>
+
+/**
+ * \class PhraseSearchModel
+ * Results of a phrase search over all courses, ordered by relevance.
+ */
+class ARTIKULATECORE_EXPORT PhraseSearchModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged)
+    Q_PROPERTY(int maximumResults READ maximumResults WRITE setMaximumResults NOTIFY maximumResultsChanged)
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum searchRoles { TextRole = Qt::UserRole + 1, I18nTextRole, IdRole, UnitIdRole, UnitTitleRole, CourseIdRole, CourseTitleRole, ScoreRole, DataRole };
+
+    explicit PhraseSearchModel(QObject *parent = nullptr);
+    explicit PhraseSearchModel(PhraseSearchIndex *index, QObject *parent = nullptr);
+    /**
+     * Set the index that is searched, a null index yields no results
+     */
+    void setPhraseSearchIndex(PhraseSearchIndex *index);
+    PhraseSearchIndex *phraseSearchIndex() const;
+    QHash<int, QByteArray> roleNames() const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    void setQuery(const QString &query);
+    QString query() const;
+    void setMaximumResults(int maximum);
+    int maximumResults() const;
+
+Q_SIGNALS:
+    void queryChanged();
+    void maximumResultsChanged();
+    void countChanged();
+
+private:
+    void updateResults();
+    PhraseSearchIndex *m_index {nullptr};
+    QString m_query;
+    int m_maximumResults {100};
+    QVector<PhraseSearchIndex::Result> m_results;
+};
+
+#endif
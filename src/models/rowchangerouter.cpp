@@ -0,0 +1,106 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#include "rowchangerouter.h"
+#include <algorithm>
+
+RowChangeRouter::RowChangeRouter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+void RowChangeRouter::clear()
+{
+    for (auto object : qAsConst(m_objects)) {
+        disconnect(object, nullptr, this, nullptr);
+    }
+    m_objects.clear();
+    m_rows.clear();
+    m_validRows = 0;
+    m_changed.clear();
+}
+
+void RowChangeRouter::insert(int row, QObject *object)
+{
+    Q_ASSERT(row >= 0 && row <= m_objects.count());
+    m_objects.insert(row, object);
+    m_validRows = qMin(m_validRows, row);
+}
+
+void RowChangeRouter::remove(int first, int last)
+{
+    Q_ASSERT(first >= 0 && first <= last && last < m_objects.count());
+    for (int i = first; i <= last; ++i) {
+        disconnect(m_objects.at(i), nullptr, this, nullptr);
+        m_rows.remove(m_objects.at(i));
+    }
+    m_objects.remove(first, last - first + 1);
+    m_validRows = qMin(m_validRows, first);
+}
+
+int RowChangeRouter::row(const QObject *object) const
+{
+    auto iter = m_rows.constFind(object);
+    if (iter != m_rows.constEnd() && iter.value() < m_validRows) {
+        return iter.value();
+    }
+    // renumber until the object is found, later lookups continue from there
+    for (int i = m_validRows; i < m_objects.count(); ++i) {
+        m_rows.insert(m_objects.at(i), i);
+        m_validRows = i + 1;
+        if (m_objects.at(i) == object) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+QObject *RowChangeRouter::object(int row) const
+{
+    return m_objects.value(row, nullptr);
+}
+
+int RowChangeRouter::count() const
+{
+    return m_objects.count();
+}
+
+void RowChangeRouter::notify(QObject *object)
+{
+    m_changed.append(object);
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        QMetaObject::invokeMethod(this, &RowChangeRouter::flush, Qt::QueuedConnection);
+    }
+}
+
+void RowChangeRouter::flush()
+{
+    m_flushScheduled = false;
+    if (m_changed.isEmpty()) {
+        return;
+    }
+    QVector<int> rows;
+    rows.reserve(m_changed.count());
+    for (const auto object : qAsConst(m_changed)) {
+        // objects removed in the meantime are not reported
+        const int row = this->row(object);
+        if (row >= 0) {
+            rows.append(row);
+        }
+    }
+    m_changed.clear();
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    int first {0};
+    for (int i = 1; i <= rows.count(); ++i) {
+        if (i == rows.count() || rows.at(i) != rows.at(i - 1) + 1) {
+            emit rowsChanged(rows.at(first), rows.at(i - 1));
+            first = i;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+*/
+
+#ifndef ROWCHANGEROUTER_H
+#define ROWCHANGEROUTER_H
+
+#include "artikulatecore_export.h"
+#include <QHash>
+#include <QObject>
+#include <QVector>
+
+/**
+ * \class RowChangeRouter
+ * Routes change signals of the objects shown as rows of a list to coalesced row ranges.
+ *
+ * Insertions and removals only patch the row list. Rows behind a structural change are
+ * renumbered lazily on the next lookup, such that bulk edits stay linear. Changes are collected
+ * and reported once per event loop iteration, or on flush(), as ranges of consecutive rows.
+ */
+class ARTIKULATECORE_EXPORT RowChangeRouter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RowChangeRouter(QObject *parent = nullptr);
+    void clear();
+    void insert(int row, QObject *object);
+    /**
+     * @brief remove rows @p first to @p last, including, and disconnect their objects
+     */
+    void remove(int first, int last);
+    /**
+     * @brief report @p changeSignal of @p object, which must be inserted before, as change of its row
+     */
+    template<typename Sender, typename Signal> void watch(Sender *object, Signal changeSignal)
+    {
+        QObject *target = object;
+        connect(object, changeSignal, this, [this, target]() {
+            notify(target);
+        });
+    }
+    /**
+     * @return row of @p object or -1 if it is not contained
+     */
+    int row(const QObject *object) const;
+    QObject *object(int row) const;
+    int count() const;
+    /**
+     * @brief emit all collected changes immediately
+     */
+    void flush();
+
+Q_SIGNALS:
+    void rowsChanged(int first, int last);
+
+private:
+    void notify(QObject *object);
+
+    QVector<QObject *> m_objects;
+    mutable QHash<const QObject *, int> m_rows;
+    mutable int m_validRows {0}; //!< rows before this position are up to date in m_rows
+    QVector<const QObject *> m_changed;
+    bool m_flushScheduled {false};
+};
+
+#endif
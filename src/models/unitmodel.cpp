@@ -9,8 +9,7 @@
 #include "core/language.h"
 #include "core/phrase.h"
 #include "core/unit.h"
-
-#include <QSignalMapper>
+#include "rowchangerouter.h"
 
 #include "artikulate_debug.h"
 #include <KLocalizedString>
@@ -18,9 +17,9 @@
 UnitModel::UnitModel(QObject *parent)
     : QAbstractListModel(parent)
     , m_course(nullptr)
-    , m_signalMapper(new QSignalMapper(this))
+    , m_router(new RowChangeRouter(this))
 {
-    connect(m_signalMapper, SIGNAL(mapped(int)), SLOT(emitUnitChanged(int)));
+    connect(m_router, &RowChangeRouter::rowsChanged, this, &UnitModel::emitUnitsChanged);
 }
 
 QHash<int, QByteArray> UnitModel::roleNames() const
@@ -45,6 +44,7 @@ void UnitModel::setCourse(ICourse *course)
     if (m_course) {
         m_course->disconnect(this);
     }
+    m_router->clear();
 
     m_course = course;
 
@@ -53,6 +53,12 @@ void UnitModel::setCourse(ICourse *course)
         connect(m_course, &ICourse::unitAdded, this, &UnitModel::onUnitAdded);
         connect(m_course, &ICourse::unitsAboutToBeRemoved, this, &UnitModel::onUnitsAboutToBeRemoved);
         connect(m_course, &ICourse::unitsRemoved, this, &UnitModel::onUnitsRemoved);
+
+        const auto units = m_course->unitRange();
+        for (int i = 0; i < units.count(); ++i) {
+            m_router->insert(i, units.at(i).get());
+            m_router->watch(units.at(i).get(), &IUnit::titleChanged);
+        }
     }
 
     endResetModel();
@@ -73,11 +79,12 @@ QVariant UnitModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    if (index.row() >= m_course->units().count()) {
+    const auto units = m_course->unitRange();
+    if (index.row() >= units.count()) {
         return QVariant();
     }
 
-    auto unit = m_course->units().at(index.row());
+    const auto &unit = units.at(index.row());
 
     switch (role) {
         case Qt::DisplayRole:
@@ -87,7 +94,7 @@ QVariant UnitModel::data(const QModelIndex &index, int role) const
         case TitleRole:
             return unit->title();
         case ContainsTrainingData:
-            for (const auto &phrase : unit->phrases()) {
+            for (const auto &phrase : unit->phraseRange()) {
                 //            if (phrase->editState() == Phrase::Completed) { //TODO introduce editablephrase
                 //                return true;
                 //            }
@@ -112,24 +119,25 @@ int UnitModel::rowCount(const QModelIndex &parent) const
         return 0;
     }
 
-    return m_course->units().count();
+    return m_course->unitCount();
 }
 
 void UnitModel::onUnitAboutToBeAdded(std::shared_ptr<Unit> unit, int index)
 {
-    connect(unit.get(), SIGNAL(titleChanged()), m_signalMapper, SLOT(map()));
+    m_router->insert(index, unit.get());
+    m_router->watch(unit.get(), &IUnit::titleChanged);
     // TODO add missing signals
     beginInsertRows(QModelIndex(), index, index);
 }
 
 void UnitModel::onUnitAdded()
 {
-    updateMappings();
     endInsertRows();
 }
 
 void UnitModel::onUnitsAboutToBeRemoved(int first, int last)
 {
+    m_router->remove(first, last);
     beginRemoveRows(QModelIndex(), first, last);
 }
 
@@ -138,10 +146,12 @@ void UnitModel::onUnitsRemoved()
     endRemoveRows();
 }
 
-void UnitModel::emitUnitChanged(int row)
+void UnitModel::emitUnitsChanged(int first, int last)
 {
-    emit unitChanged(row);
-    emit dataChanged(index(row, 0), index(row, 0));
+    for (int row = first; row <= last; ++row) {
+        emit unitChanged(row);
+    }
+    emit dataChanged(index(first, 0), index(last, 0));
 }
 
 QVariant UnitModel::headerData(int section, Qt::Orientation orientation, int role) const
@@ -154,11 +164,3 @@ QVariant UnitModel::headerData(int section, Qt::Orientation orientation, int rol
     }
     return QVariant(i18nc("@title:column", "Unit"));
 }
-
-void UnitModel::updateMappings()
-{
-    int units = m_course->units().count();
-    for (int i = 0; i < units; i++) {
-        m_signalMapper->setMapping(m_course->units().at(i).get(), i);
-    }
-}
@@ -11,8 +11,8 @@
 #include <memory>
 
 class ICourse;
+class RowChangeRouter;
 class Unit;
-class QSignalMapper;
 
 class UnitModel : public QAbstractListModel
 {
@@ -47,12 +47,11 @@ private Q_SLOTS:
     void onUnitAdded();
     void onUnitsAboutToBeRemoved(int first, int last);
     void onUnitsRemoved();
-    void emitUnitChanged(int row);
+    void emitUnitsChanged(int first, int last);
 
 private:
-    void updateMappings();
     ICourse *m_course;
-    QSignalMapper *m_signalMapper;
+    RowChangeRouter *m_router;
 };
 
 #endif // UNITMODEL_H
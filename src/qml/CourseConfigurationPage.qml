@@ -48,14 +48,12 @@ Kirigami.Page {
         }
 
         Kirigami.Separator {
-            visible: !g_editorSession.skeletonMode
             Kirigami.FormData.label: i18n("Prototype")
             Kirigami.FormData.isSection: true
         }
         Button {
             visible: !g_editorSession.skeletonMode
             Kirigami.FormData.label: i18n("Update from Prototype:")
-            enabled: g_editorSession.skeletonMode
             Layout.minimumWidth: 200
             text: i18n("Update")
             icon.name: "view-refresh"
@@ -65,6 +63,47 @@ Kirigami.Page {
             ToolTip.text: i18n("Update the course with elements from prototype.")
             onClicked: g_editorSession.updateCourseFromSkeleton()
         }
+        Button {
+            visible: !g_editorSession.skeletonMode
+            Kirigami.FormData.label: i18n("Changes of Prototype:")
+            Layout.minimumWidth: 200
+            text: i18n("Preview")
+            icon.name: "document-preview"
+            ToolTip.visible: hovered
+            ToolTip.delay: 1000
+            ToolTip.timeout: 5000
+            ToolTip.text: i18n("Show all changes of the prototype, including removed elements.")
+            onClicked: g_editorSession.previewSkeletonChanges()
+        }
+        Label {
+            readonly property var changes: g_editorSession.skeletonChanges
+            visible: !g_editorSession.skeletonMode && changes.added !== undefined
+            text: i18n("%1 added, %2 moved, %3 retitled, %4 kept translations, %5 removed",
+                       changes.added, changes.moved, changes.retitled, changes.conflicts, changes.removed)
+        }
+        Button {
+            visible: !g_editorSession.skeletonMode && g_editorSession.skeletonChanges.added !== undefined
+            Layout.minimumWidth: 200
+            text: i18n("Apply All")
+            icon.name: "dialog-ok-apply"
+            ToolTip.visible: hovered
+            ToolTip.delay: 1000
+            ToolTip.timeout: 5000
+            ToolTip.text: i18n("Apply the previewed changes, removed elements stay in the course but are unlinked from prototype.")
+            onClicked: g_editorSession.applySkeletonChanges()
+        }
+        Button {
+            visible: g_editorSession.skeletonMode
+            Kirigami.FormData.label: i18n("Update Courses:")
+            Layout.minimumWidth: 200
+            text: i18n("Update All")
+            icon.name: "view-refresh"
+            ToolTip.visible: hovered
+            ToolTip.delay: 1000
+            ToolTip.timeout: 5000
+            ToolTip.text: i18n("Update the courses of all languages with elements from this prototype.")
+            onClicked: g_editorSession.updateCoursesFromSkeleton()
+        }
 
 // TODO add export functionalities
 //        Kirigami.Separator {
@@ -126,6 +126,23 @@ Kirigami.GlobalDrawer {
                 }
             }
         }
+        ActionListItem {
+            visible: g_editorSession.soundProcessingAvailable
+            action: Kirigami.Action {
+                text: g_editorSession.processingSoundFiles
+                      ? i18n("Cancel Normalizing (%1/%2)", g_editorSession.processedSoundFiles, g_editorSession.totalSoundFiles)
+                      : i18n("Normalize Recordings")
+                iconName: g_editorSession.processingSoundFiles ? "process-stop" : "audio-volume-high"
+                enabled: g_editorSession.course !== null
+                onTriggered: {
+                    if (g_editorSession.processingSoundFiles) {
+                        g_editorSession.cancelSoundFileProcessing()
+                    } else {
+                        g_editorSession.normalizeSoundFiles()
+                    }
+                }
+            }
+        }
 
         Kirigami.Separator {
             Layout.fillWidth: true
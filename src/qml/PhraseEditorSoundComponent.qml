@@ -45,6 +45,7 @@ Item {
             }
             SoundRecorder {
                 id: recorder
+                purpose: Recorder.ArchiveRecording
             }
             SoundPlayer {
                 fileUrl: recorder.outputFileUrl
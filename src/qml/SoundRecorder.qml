@@ -23,6 +23,11 @@ Item {
      */
     readonly property string outputFileUrl: recorderBackend.recordingFile
 
+    /**
+     * purpose of the recording, either Recorder.ComparisonRecording or Recorder.ArchiveRecording
+     */
+    property alias purpose: recorderBackend.purpose
+
     function storeToFile(filePath) {
         recorderBackend.storeToFile(filePath);
         phrase.setSoundFileUrl()
@@ -0,0 +1,103 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "iconimagecache.h"
+#include <QPainter>
+
+namespace
+{
+// cost is counted in KiB of image data, which allows a few hundred icons of usual sizes
+constexpr int maximumCost {16 * 1024};
+}
+
+bool IconImageCache::Key::operator==(const Key &other) const
+{
+    return name == other.name && size == other.size && mode == other.mode && qFuzzyCompare(devicePixelRatio, other.devicePixelRatio);
+}
+
+uint qHash(const IconImageCache::Key &key, uint seed)
+{
+    return qHash(key.name, seed) ^ qHash(key.size.width(), seed) ^ qHash(key.size.height() << 16, seed) ^ qHash(static_cast<int>(key.mode), seed)
+        ^ qHash(qRound(key.devicePixelRatio * 100), seed);
+}
+
+IconImageCache::IconImageCache()
+    : m_images(maximumCost)
+{
+}
+
+IconImageCache::~IconImageCache() = default;
+
+IconImageCache::Key IconImageCache::key(const QIcon &icon, const QSize &size, QIcon::Mode mode, qreal devicePixelRatio)
+{
+    Key key;
+    // icons without theme name are identified by their cache key, which is shared by all copies
+    key.name = !icon.name().isEmpty() ? icon.name() : QStringLiteral("#%1").arg(icon.cacheKey());
+    key.size = size;
+    key.mode = mode;
+    key.devicePixelRatio = devicePixelRatio;
+    return key;
+}
+
+bool IconImageCache::lookup(const Key &key, QImage *image)
+{
+    // null icons yield a null image, which is cached as well
+    if (const QImage *cached = m_images.object(key)) {
+        ++m_hits;
+        *image = *cached;
+        return true;
+    }
+    ++m_misses;
+    return false;
+}
+
+QImage IconImageCache::request(const QIcon &icon, const Key &key)
+{
+    if (const QImage *cached = m_images.object(key)) {
+        return *cached;
+    }
+    const QImage image = rasterize(icon, key);
+    insert(key, image);
+    return image;
+}
+
+int IconImageCache::hits() const
+{
+    return m_hits;
+}
+
+int IconImageCache::misses() const
+{
+    return m_misses;
+}
+
+void IconImageCache::clear()
+{
+    m_images.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+QImage IconImageCache::rasterize(const QIcon &icon, const Key &key)
+{
+    if (icon.isNull()) {
+        return QImage();
+    }
+    // the icon paints in logical pixels into an image of device pixels
+    QImage image(key.size * key.devicePixelRatio, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(key.devicePixelRatio);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    icon.paint(&painter, QRect(QPoint(0, 0), key.size), Qt::AlignCenter, key.mode, QIcon::On);
+    painter.end();
+    return image;
+}
+
+void IconImageCache::insert(const Key &key, const QImage &image)
+{
+    const int cost = qMax(1, static_cast<int>(image.sizeInBytes() / 1024));
+    m_images.insert(key, new QImage(image), cost);
+}
@@ -0,0 +1,76 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef ICONIMAGECACHE_H
+#define ICONIMAGECACHE_H
+
+#include "artikulatecore_export.h"
+#include <QCache>
+#include <QIcon>
+#include <QImage>
+#include <QSize>
+
+/**
+ * @short Cache of rasterized icon images
+ *
+ * Images are identified by icon name, size, mode and device pixel ratio. Icon engines, including
+ * the theme icon loader, may only be used from the GUI thread, thus icons are rasterized there
+ * when requested by an item and never in its paint node update on the render thread. A cached
+ * image is returned as the same implicitly shared QImage, such that all items showing the same
+ * icon share one texture through ImageTexturesCache. Null icons are cached as null images.
+ *
+ * The cache must only be used from the GUI thread.
+ *
+ * @see IconItem
+ */
+class ARTIKULATECORE_EXPORT IconImageCache
+{
+public:
+    struct Key {
+        QString name;
+        QSize size;
+        QIcon::Mode mode {QIcon::Normal};
+        qreal devicePixelRatio {1.0};
+
+        bool operator==(const Key &other) const;
+    };
+
+    IconImageCache();
+    ~IconImageCache();
+
+    /**
+     * @return cache key of @p icon for the given rendering parameters
+     */
+    static Key key(const QIcon &icon, const QSize &size, QIcon::Mode mode, qreal devicePixelRatio);
+
+    /**
+     * @brief look up the image for @p key and count the lookup as hit or miss
+     * @return true if @p image was set to the cached image
+     */
+    bool lookup(const Key &key, QImage *image);
+
+    /**
+     * @brief rasterize @p icon for @p key and add the image to the cache
+     * @return the cached image, which is null for null icons
+     */
+    QImage request(const QIcon &icon, const Key &key);
+
+    int hits() const;
+    int misses() const;
+    void clear();
+
+private:
+    static QImage rasterize(const QIcon &icon, const Key &key);
+    void insert(const Key &key, const QImage &image);
+
+    QCache<Key, QImage> m_images;
+    int m_hits {0};
+    int m_misses {0};
+};
+
+uint qHash(const IconImageCache::Key &key, uint seed = 0);
+
+#endif
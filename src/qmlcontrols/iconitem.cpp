@@ -9,11 +9,13 @@
 
 #include "imagetexturescache.h"
 #include "managedtexturenode.h"
+#include <QGuiApplication>
 #include <QIcon>
 #include <QQuickWindow>
 #include <QSGSimpleTextureNode>
 
 Q_GLOBAL_STATIC(ImageTexturesCache, s_iconImageCache)
+Q_GLOBAL_STATIC(IconImageCache, s_iconRasterCache)
 
 IconItem::IconItem(QQuickItem *parent)
     : QQuickItem(parent)
@@ -37,8 +39,7 @@ void IconItem::setIcon(const QVariant &icon)
     } else {
         m_icon = QIcon();
     }
-    m_changed = true;
-    update();
+    updateImage();
 }
 
 QIcon IconItem::icon() const
@@ -58,9 +59,8 @@ void IconItem::setState(IconItem::State state)
     }
 
     m_state = state;
-    m_changed = true;
+    updateImage();
     emit stateChanged(state);
-    update();
 }
 
 bool IconItem::enabled() const
@@ -104,7 +104,7 @@ bool IconItem::smooth() const
 
 QSGNode *IconItem::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData * /*data*/)
 {
-    if (m_icon.isNull()) {
+    if (m_image.isNull()) {
         delete node;
         return nullptr;
     }
@@ -118,25 +118,9 @@ QSGNode *IconItem::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDat
             mNode = new ManagedTextureNode;
         }
 
-        QIcon::Mode mode;
-        switch (m_state) {
-            case DefaultState:
-                mode = QIcon::Normal;
-                break;
-            case ActiveState:
-                mode = QIcon::Active;
-                break;
-            case DisabledState:
-                mode = QIcon::Disabled;
-                break;
-        }
-
-        QImage img;
+        // cached images share their cache key, such that equal icons share one atlas texture
         const QSize size(static_cast<int>(width()), static_cast<int>(height()));
-        if (!size.isEmpty()) {
-            img = m_icon.pixmap(size, mode, QIcon::On).toImage();
-        }
-        mNode->setTexture(s_iconImageCache->loadTexture(window(), img));
+        mNode->setTexture(s_iconImageCache->loadTexture(window(), m_image, QQuickWindow::TextureCanUseAtlas));
         mNode->setRect(QRect(QPoint(0, 0), size));
         node = mNode;
     }
@@ -144,11 +128,67 @@ QSGNode *IconItem::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDat
     return node;
 }
 
+IconImageCache *IconItem::imageCache()
+{
+    return s_iconRasterCache();
+}
+
+void IconItem::updateImage()
+{
+    const QSize size(static_cast<int>(width()), static_cast<int>(height()));
+    if (m_icon.isNull() || size.isEmpty()) {
+        setImage(QImage());
+        return;
+    }
+
+    QIcon::Mode mode = QIcon::Normal;
+    switch (m_state) {
+        case DefaultState:
+            mode = QIcon::Normal;
+            break;
+        case ActiveState:
+            mode = QIcon::Active;
+            break;
+        case DisabledState:
+            mode = QIcon::Disabled;
+            break;
+    }
+    const qreal devicePixelRatio = window() ? window()->effectiveDevicePixelRatio() : qApp->devicePixelRatio();
+    const auto key = IconImageCache::key(m_icon, size, mode, devicePixelRatio);
+    if (key == m_imageKey && !m_image.isNull()) {
+        if (m_changed) {
+            update();
+        }
+        return;
+    }
+    QImage image;
+    if (!s_iconRasterCache->lookup(key, &image)) {
+        image = s_iconRasterCache->request(m_icon, key);
+    }
+    m_imageKey = key;
+    setImage(image);
+}
+
+void IconItem::setImage(const QImage &image)
+{
+    m_image = image;
+    m_changed = true;
+    update();
+}
+
 void IconItem::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
     if (newGeometry.size() != oldGeometry.size()) {
         m_changed = true;
-        update();
+        updateImage();
     }
     QQuickItem::geometryChanged(newGeometry, oldGeometry);
 }
+
+void IconItem::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    if (change == ItemSceneChange || change == ItemDevicePixelRatioHasChanged) {
+        updateImage();
+    }
+    QQuickItem::itemChange(change, value);
+}
@@ -7,10 +7,12 @@
 #define ICONITEM_H
 
 #include <QIcon>
+#include <QImage>
 #include <QQuickItem>
 #include <QVariant>
 
 #include "artikulatecore_export.h"
+#include "iconimagecache.h"
 
 class ARTIKULATECORE_EXPORT IconItem : public QQuickItem
 {
@@ -52,17 +54,33 @@ public:
 
     QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *data) override;
 
+    /**
+     * @return cache of rasterized icons shared by all icon items
+     */
+    static IconImageCache *imageCache();
+
 Q_SIGNALS:
     void stateChanged(State state);
 
 protected:
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
 
 private:
+    /**
+     * @brief take the image for the current icon, size and state from the cache or rasterize it
+     *
+     * Rasterization happens on the GUI thread and never in updatePaintNode() on the render thread.
+     */
+    void updateImage();
+    void setImage(const QImage &image);
+
     QIcon m_icon;
     bool m_smooth;
     State m_state;
     bool m_changed;
+    QImage m_image;
+    IconImageCache::Key m_imageKey; //!< key of the shown image
 };
 
 #endif